@@ -1,12 +1,13 @@
 //Dear emacs, this is -*-c++-*-
 /*
-  Copyright (C) 2002-2018 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef CALOCONDITIONS_CALONOISE_H
 #define CALOCONDITIONS_CALONOISE_H
 
 #include <boost/multi_array.hpp>
+#include <memory>
 #include "CaloIdentifier/CaloCell_ID.h"
 #include "CaloCondBlobObjs/CaloCondUtils.h" 
 #include "CaloCondBlobObjs/CaloCondBlobFlt.h"
@@ -30,14 +31,24 @@ class CaloNoise {
   CaloNoise(const size_t nLArCells, const size_t nLArGains, const size_t nTileCells, const size_t nTileGains,
 	    const CaloCell_Base_ID* caloCellId, const NOISETYPE noisetype);
 
+  /// Constructor using an already filled, read-only storage, e.g. shared between processes.
+  /// The storage holds the LAr noise [nLArGains][nLArCells] followed by the Tile noise [nTileGains][nTileCells].
+  CaloNoise(const size_t nLArCells, const size_t nLArGains, const size_t nTileCells, const size_t nTileGains,
+	    const CaloCell_Base_ID* caloCellId, const NOISETYPE noisetype,
+	    std::shared_ptr<const void> storage);
+
+  /// The storage accessors refer to this object
+  CaloNoise(const CaloNoise&) = delete;
+  CaloNoise& operator=(const CaloNoise&) = delete;
+
   /// Accessor by IdentifierHash and gain.
   float getNoise(const IdentifierHash h, const int gain) const {
     if (h<m_tileHashOffset) {
-      return m_larNoise[gain][h];
+      return m_larView[gain][h];
     }
     else {
       const unsigned int dbGain = CaloCondUtils::getDbCaloGain(gain);
-      return m_tileNoise[dbGain][h-m_tileHashOffset];
+      return m_tileView[dbGain][h-m_tileHashOffset];
     }
   }
   
@@ -56,20 +67,20 @@ class CaloNoise {
   float getEffectiveSigma(const Identifier id, const int gain, const float energy) const {
     IdentifierHash h=m_caloCellId->calo_cell_hash(id);
     if (h<m_tileHashOffset) {
-      return m_larNoise[gain][h];
+      return m_larView[gain][h];
     }
     else {
       return getTileEffSigma(h-m_tileHashOffset,gain,energy);
     }
   }
 
-  /// Non-const accessor to underlying storage for filling:
+  /// Non-const accessor to underlying storage for filling (empty if the storage was given to the constructor):
   boost::multi_array<float, 2>& larStorage() {return m_larNoise;}
   boost::multi_array<float, 2>& tileStorage() {return m_tileNoise;}
 
   ///Const accessor to underlying storage for GPU data structures.
-  const boost::multi_array<float, 2>& larStorage() const {return m_larNoise;}
-  const boost::multi_array<float, 2>& tileStorage() const {return m_tileNoise;}
+  const boost::const_multi_array_ref<float, 2>& larStorage() const {return m_larView;}
+  const boost::const_multi_array_ref<float, 2>& tileStorage() const {return m_tileView;}
 
   
   void setTileBlob(const CaloCondBlobFlt* flt, const float lumi);
@@ -91,6 +102,11 @@ class CaloNoise {
   //Flat structure, choosen based on profiling done by Scott in Nov 2013
   boost::multi_array<float, 2> m_larNoise;
   boost::multi_array<float, 2> m_tileNoise;
+  //Storage given to the constructor, if any
+  std::shared_ptr<const void> m_storage;
+  //Views of the storage in use, either of the above
+  boost::const_multi_array_ref<float, 2> m_larView;
+  boost::const_multi_array_ref<float, 2> m_tileView;
   unsigned m_tileHashOffset;
 
 
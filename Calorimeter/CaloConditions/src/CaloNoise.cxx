@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "CaloConditions/CaloNoise.h"
@@ -15,14 +15,30 @@ CaloNoise::CaloNoise(const size_t nLArCells,
                      const CaloCell_Base_ID* caloCellId,
                      const NOISETYPE noisetype)
   : m_caloCellId(caloCellId)
+  , m_larNoise(boost::extents[nLArGains][nLArCells])
+  , m_tileNoise(boost::extents[nTileGains][nTileCells])
+  , m_larView(m_larNoise.data(), boost::extents[nLArGains][nLArCells])
+  , m_tileView(m_tileNoise.data(), boost::extents[nTileGains][nTileCells])
   , m_noiseType(noisetype)
 {
+  IdentifierHash h1,h2;
+  m_caloCellId->calo_cell_hash_range(CaloCell_ID::TILE, h1,h2);
+  m_tileHashOffset=h1;
+}
 
-  boost::multi_array_types::extent_gen lar_extent_gen;
-  m_larNoise.resize(lar_extent_gen[nLArGains][nLArCells]);
-  boost::multi_array_types::extent_gen tile_extent_gen;
-  m_tileNoise.resize(tile_extent_gen[nTileGains][nTileCells]);
-  
+CaloNoise::CaloNoise(const size_t nLArCells,
+                     const size_t nLArGains,
+                     const size_t nTileCells,
+                     const size_t nTileGains,
+                     const CaloCell_Base_ID* caloCellId,
+                     const NOISETYPE noisetype,
+                     std::shared_ptr<const void> storage)
+  : m_caloCellId(caloCellId)
+  , m_storage(std::move(storage))
+  , m_larView(static_cast<const float*>(m_storage.get()), boost::extents[nLArGains][nLArCells])
+  , m_tileView(static_cast<const float*>(m_storage.get()) + nLArGains*nLArCells, boost::extents[nTileGains][nTileCells])
+  , m_noiseType(noisetype)
+{
   IdentifierHash h1,h2;
   m_caloCellId->calo_cell_hash_range(CaloCell_ID::TILE, h1,h2);
   m_tileHashOffset=h1;
@@ -83,7 +99,7 @@ float CaloNoise::getTileEffSigma(const IdentifierHash subHash, const int gain, c
   const unsigned int dbGain = CaloCondUtils::getDbCaloGain(gain);
   if (!m_tileBlob) {
     //No data (pilup-noise only): return cached noise
-    return m_tileNoise[dbGain][subHash];
+    return m_tileView[dbGain][subHash];
   }
 
   const float sigma=calcSig(subHash,dbGain,e);
@@ -0,0 +1,90 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CaloConditions/test/CaloNoise_test.cxx
+ * @date Oct, 2026
+ * @brief Unit test for CaloNoise, with its own storage and with external storage.
+ */
+
+
+#undef NDEBUG
+#include "CaloConditions/CaloNoise.h"
+#include "CaloIdentifier/CaloHelpersTest.h"
+#include <cassert>
+#include <iostream>
+#include <memory>
+
+
+namespace {
+
+constexpr size_t nLArGains = 3;
+constexpr size_t nTileGains = 4;
+// LAr gains, followed by the Tile gains (TILELOWLOW ... TILEONEHIGH)
+constexpr int gains[] = {0, 1, 2, -16, -15, -12, -11, -4, -3};
+
+float noiseValue (size_t gain, size_t hash, bool tile)
+{
+  return (tile ? 100 : 1) + gain + hash*1e-3;
+}
+
+} // anonymous namespace
+
+
+// The noise read through external storage, e.g. shared between processes,
+// is the same as with the object's own storage.
+void test1 (const CaloCell_ID& caloID)
+{
+  std::cout << "test1\n";
+
+  IdentifierHash tileMin, tileMax;
+  caloID.calo_cell_hash_range (CaloCell_ID::TILE, tileMin, tileMax);
+  const size_t nLArCells = tileMin;
+  const size_t nTileCells = caloID.calo_cell_hash_max() - tileMin;
+
+  CaloNoise own (nLArCells, nLArGains, nTileCells, nTileGains, &caloID, CaloNoise::TOTAL);
+  const size_t size = nLArGains*nLArCells + nTileGains*nTileCells;
+  std::shared_ptr<float[]> storage (new float[size]);
+  for (size_t g = 0; g < nLArGains; ++g) {
+    for (size_t h = 0; h < nLArCells; ++h) {
+      own.larStorage()[g][h] = noiseValue (g, h, false);
+      storage[g*nLArCells + h] = noiseValue (g, h, false);
+    }
+  }
+  for (size_t g = 0; g < nTileGains; ++g) {
+    for (size_t h = 0; h < nTileCells; ++h) {
+      own.tileStorage()[g][h] = noiseValue (g, h, true);
+      storage[nLArGains*nLArCells + g*nTileCells + h] = noiseValue (g, h, true);
+    }
+  }
+
+  const CaloNoise external (nLArCells, nLArGains, nTileCells, nTileGains, &caloID, CaloNoise::TOTAL,
+                            std::shared_ptr<const void> (storage, storage.get()));
+  assert (external.larStorage().num_elements() == nLArGains*nLArCells);
+  assert (external.tileStorage().num_elements() == nTileGains*nTileCells);
+
+  for (size_t h = 0; h < caloID.calo_cell_hash_max(); ++h) {
+    const bool tile = h >= tileMin;
+    const Identifier id = caloID.cell_id (IdentifierHash (h));
+    for (int gain : gains) {
+      if (tile != (gain < 0)) continue;
+      const unsigned int dbGain = CaloCondUtils::getDbCaloGain (gain);
+      const float expected = noiseValue (dbGain, tile ? h - tileMin : h, tile);
+      assert (own.getNoise (IdentifierHash (h), gain) == expected);
+      assert (external.getNoise (IdentifierHash (h), gain) == expected);
+      assert (external.getNoise (id, gain) == expected);
+      // Without Tile blob, the effective sigma is the cached noise
+      assert (own.getEffectiveSigma (id, gain, 1000) == expected);
+      assert (external.getEffectiveSigma (id, gain, 1000) == expected);
+    }
+  }
+}
+
+
+int main()
+{
+  std::cout << "CaloConditions/CaloNoise_test\n";
+  CaloHelpersTest helpers;
+  test1 (helpers.caloID());
+  return 0;
+}
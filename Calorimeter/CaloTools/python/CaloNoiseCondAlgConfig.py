@@ -1,4 +1,4 @@
-#  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+#  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
 from AthenaConfiguration.ComponentFactory import CompFactory
@@ -33,6 +33,11 @@ def CaloNoiseCondAlgCfg(flags, noisetype="totalNoise"):
 
     theCaloNoiseAlg=CaloNoiseCondAlg(noiseAlgName,OutputKey=noisetype)
 
+    if flags.MP.UseSharedConditions and flags.Concurrency.NumProcs > 0:
+        log.info("Sharing the noise tables between the AthenaMP workers")
+        theCaloNoiseAlg.UseSharedMemory=True
+        result.addService(CompFactory.SharedCondBufferSvc())
+
     if flags.Common.isOnline:
         log.info("Configuring CaloNoiseCondAlg for online case")
         #online mode:
@@ -1,9 +1,9 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "CaloNoiseCondAlg.h" 
-#include <forward_list>
+#include <sstream>
 #include "CaloCondBlobObjs/CaloCondBlobFlt.h"
 #include "CaloIdentifier/CaloCell_ID.h"
 
@@ -65,6 +65,10 @@ StatusCode CaloNoiseCondAlg::initialize() {
 
   m_hashRange=std::make_unique<CaloNoiseHashRanges>(m_caloCellID);
 
+  if (m_useSharedMemory) {
+    ATH_CHECK(m_sharedCondBufferSvc.retrieve());
+  }
+
   return StatusCode::SUCCESS;
 }
 
@@ -104,7 +108,7 @@ StatusCode CaloNoiseCondAlg::execute(const EventContext& ctx) const {
   }
   
   //Get noise-blobs out of all COOL-channels in all COOL Folders we know about:
-  std::forward_list<std::pair<unsigned, const coral::Blob&> > blobList;  
+  BlobList_t blobList;
   for (const auto& attrListColl : attrListNoise) {
     for (const auto& coll : *attrListColl) {
       ATH_MSG_DEBUG("Working on channel " << coll.first);
@@ -155,13 +159,75 @@ StatusCode CaloNoiseCondAlg::execute(const EventContext& ctx) const {
   }
 
 
-  const size_t maxCells=m_caloCellID->calo_cell_hash_max();
   //Create the CaloNoise CDO:
   const size_t nLArCells=m_hashRange->maxLArCells();
   const size_t nTileCells=m_hashRange->maxTileCells();
-  std::unique_ptr<CaloNoise> caloNoiseObj=std::make_unique<CaloNoise>(nLArCells,3,
-								      nTileCells,4,
-								      m_caloCellID,m_noiseType);
+  std::unique_ptr<CaloNoise> caloNoiseObj;
+
+  if (m_useSharedMemory) {
+    //Workers seeing the same input ranges compute the same noise
+    std::ostringstream bufferKey;
+    bufferKey << name() << " " << writeHandle.getRange() << " " << lumi;
+    auto fill=[&](void* buffer, size_t) {
+      float* storage=static_cast<float*>(buffer);
+      boost::multi_array_ref<float, 2> larNoise(storage,boost::extents[3][nLArCells]);
+      boost::multi_array_ref<float, 2> tileNoise(storage+3*nLArCells,boost::extents[4][nTileCells]);
+      return fillNoise(blobList,larHVCorr,lumi,larNoise,tileNoise);
+    };
+    std::shared_ptr<const void> storage=m_sharedCondBufferSvc->get(bufferKey.str(),(3*nLArCells+4*nTileCells)*sizeof(float),fill);
+    if (storage) {
+      caloNoiseObj=std::make_unique<CaloNoise>(nLArCells,3,nTileCells,4,
+					       m_caloCellID,m_noiseType,std::move(storage));
+    }
+    else {
+      ATH_MSG_DEBUG("No shared memory for noise tables " << bufferKey.str() << ", using a private copy");
+    }
+  }
+
+  if (!caloNoiseObj) {
+    caloNoiseObj=std::make_unique<CaloNoise>(nLArCells,3,
+					     nTileCells,4,
+					     m_caloCellID,m_noiseType);
+    ATH_CHECK(fillNoise(blobList,larHVCorr,lumi,caloNoiseObj->larStorage(),caloNoiseObj->tileStorage()));
+  }
+
+  // Cache data to calculate effective sigma for tile double-gaussian noise 
+  // Matters for Electronic and total noise
+  if (m_noiseType!=CaloNoise::PILEUP) {
+    for (auto& blobPair : blobList) {
+      if (static_cast<CaloNoiseHashRanges::SYSTEM>(blobPair.first)==CaloNoiseHashRanges::TILE) {
+	caloNoiseObj->setTileBlob(CaloCondBlobFlt::getInstance(blobPair.second),lumi);
+      }
+    }
+  }
+
+  switch (m_noiseType){
+  case CaloNoise::ELEC:
+    ATH_MSG_INFO("Calculated electronic noise" << (larHVCorr ? " with " : " without ") << "HV Scale correction");
+    break;
+  case CaloNoise::PILEUP:
+    ATH_MSG_INFO("Calculated pile-up noise for lumi " << lumi);
+    break;
+  case CaloNoise::TOTAL:
+    ATH_MSG_INFO("Calculated total noise for lumi " << lumi<< (larHVCorr ? " with " : " without ") << "HV Scale correction");
+    break;
+  default:
+    break;
+  }
+
+  //Create output object  
+  ATH_CHECK(writeHandle.record(std::move(caloNoiseObj)));
+  ATH_MSG_INFO("recorded new CaloNoise object with key " << writeHandle.key() << " and range " << writeHandle.getRange());
+  
+  return StatusCode::SUCCESS;
+}
+
+
+StatusCode CaloNoiseCondAlg::fillNoise(const BlobList_t& blobList, const LArHVCorr* larHVCorr, const float lumi,
+				       boost::multi_array_ref<float, 2>& larNoise,
+				       boost::multi_array_ref<float, 2>& tileNoise) const {
+
+  const size_t maxCells=m_caloCellID->calo_cell_hash_max();
 
   //Counters for crosschecks
   std::array<unsigned,4> cellsPerGain{0,0,0,0};
@@ -178,8 +244,8 @@ StatusCode CaloNoiseCondAlg::execute(const EventContext& ctx) const {
 		    << ". Found " << blob->getObjVersion() << ", expected 1");
       return StatusCode::FAILURE;
     }
-    //Get writeable access to underlying storage (boost::multi_array)
-    auto& noise = (sys==CaloNoiseHashRanges::TILE) ? caloNoiseObj->tileStorage() : caloNoiseObj->larStorage();
+    //Writeable access to the underlying storage
+    auto& noise = (sys==CaloNoiseHashRanges::TILE) ? tileNoise : larNoise;
     
     const unsigned nChansThisblob=blob->getNChans();
     const unsigned nGains=blob->getNGains();
@@ -212,13 +278,6 @@ StatusCode CaloNoiseCondAlg::execute(const EventContext& ctx) const {
       }//end loop over channels
     }//end loop over gains
 
-
-    // Cache data to calculate effective sigma for tile double-gaussian noise 
-    // Matters for Electronic and total noise
-    if (sys==CaloNoiseHashRanges::TILE && m_noiseType!=CaloNoise::PILEUP) {
-      caloNoiseObj->setTileBlob(blob.release(),lumi);
-    }
-
   }//end loop over blob (COOL channels)
 
   
@@ -227,21 +286,6 @@ StatusCode CaloNoiseCondAlg::execute(const EventContext& ctx) const {
     ATH_MSG_ERROR("Unexpected number of COOL channels containing noise-blobs. Got " << nBlobs << " expected 7 (6 LAr, 1 Tile)");
     return StatusCode::FAILURE;
   }
-  
-  
-  switch (m_noiseType){
-  case CaloNoise::ELEC:
-    ATH_MSG_INFO("Calculated electronic noise" << (larHVCorr ? " with " : " without ") << "HV Scale correction");
-    break;
-  case CaloNoise::PILEUP:
-    ATH_MSG_INFO("Calculated pile-up noise for lumi " << lumi);
-    break;
-  case CaloNoise::TOTAL:
-    ATH_MSG_INFO("Calculated total noise for lumi " << lumi<< (larHVCorr ? " with " : " without ") << "HV Scale correction");
-    break;
-  default:
-    break;
-  }
 
   for (unsigned igain=0;igain<4;++igain) {
 
@@ -254,9 +298,5 @@ StatusCode CaloNoiseCondAlg::execute(const EventContext& ctx) const {
       
   }
 
-  //Create output object  
-  ATH_CHECK(writeHandle.record(std::move(caloNoiseObj)));
-  ATH_MSG_INFO("recorded new CaloNoise object with key " << writeHandle.key() << " and range " << writeHandle.getRange());
-  
   return StatusCode::SUCCESS;
 }
@@ -1,7 +1,7 @@
 //Dear emacs, this is -*- c++ -*-
 
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef CALOTOOLS_CALRNOISECONDALG_H
@@ -15,6 +15,10 @@
 #include "CaloConditions/CaloNoise.h"
 #include "LArCabling/LArOnOffIdMapping.h"
 #include "CaloIdentifier/CaloNoiseHashRanges.h"
+#include "AthenaKernel/ISharedCondBufferSvc.h"
+#include "GaudiKernel/ServiceHandle.h"
+#include <boost/multi_array.hpp>
+#include <forward_list>
 
 class CaloCell_ID;
 
@@ -30,6 +34,14 @@ class CaloNoiseCondAlg: public AthReentrantAlgorithm {
 
  private:
 
+  //Noise blobs with their COOL channel
+  typedef std::forward_list<std::pair<unsigned, const coral::Blob&> > BlobList_t;
+
+  //Fill the noise tables (gain x cell hash) from the blobs, and check that all cells are filled
+  StatusCode fillNoise(const BlobList_t& blobList, const LArHVCorr* larHVCorr, const float lumi,
+                       boost::multi_array_ref<float, 2>& larNoise,
+                       boost::multi_array_ref<float, 2>& tileNoise) const;
+
   //SG Keys and other properties:
   SG::ReadCondHandleKey<CondAttrListCollection> m_larNoiseKey{this, "LArNoiseFolder","/LAR/NoiseOfl/CellNoise",
       "SG key of CondAttrListCollection holding the LAr noise"};
@@ -48,6 +60,11 @@ class CaloNoiseCondAlg: public AthReentrantAlgorithm {
   Gaudi::Property<bool> m_useHVCorr{this,"useHVCorr",false,"Use HV Corr on/off"};
   Gaudi::Property<float> m_lumi0{this,"Luminosity",-1.0,"Fixed Luminosity. -1 means read lumi from DB"};
 
+  Gaudi::Property<bool> m_useSharedMemory{this,"UseSharedMemory",false,
+      "Build the noise tables once in shared memory for all AthenaMP workers"};
+  ServiceHandle<ISharedCondBufferSvc> m_sharedCondBufferSvc{this,"SharedCondBufferSvc","SharedCondBufferSvc",
+      "Service providing the shared memory, used if UseSharedMemory is set"};
+
 
   //The following variables will be set during initialize:
 
@@ -0,0 +1,201 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file AthContainers/MultiConstAccessor.h
+ * @date Oct, 2026
+ * @brief Read several auxiliary variables at once as vectorized tiles.
+ *
+ * @c SG::ConstAccessor gives access to one variable at a time.
+ * Code that runs over several variables of a container together,
+ * such as object selections on pt/eta/phi/m, can use this class instead
+ * to get the variables as a structure-of-arrays, in fixed-width tiles
+ * of @c CxxUtils::vec, ready for vectorized arithmetic.
+ *
+ * For example:
+ *@code
+ *  static const SG::MultiConstAccessor<float, 2> acc ({"eta", "phi"});
+ *  auto tiles = acc.getTiles (*electrons);
+ *  for (size_t i = 0; i < tiles.nTiles(); i++) {
+ *    auto tile = tiles[i];
+ *    // tile[0] holds eta, tile[1] holds phi for elements
+ *    // [tile.begin, tile.begin + tile.n) of the container.
+ *  }
+ @endcode
+ *
+ * The last tile is padded with a value given to @c getTiles,
+ * so all lanes of every tile may be used in computations;
+ * results for lanes past @c tile.n should be ignored.
+ */
+
+
+#ifndef ATHCONTAINERS_MULTICONSTACCESSOR_H
+#define ATHCONTAINERS_MULTICONSTACCESSOR_H
+
+
+#include "AthContainers/AuxVectorData.h"
+#include "AthContainersInterfaces/AuxTypes.h"
+#include "CxxUtils/vec.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+
+namespace SG {
+
+
+/**
+ * @brief Read several auxiliary variables at once as vectorized tiles.
+ *
+ * @c T is the type of the variables, which must all be the same.
+ * @c NVAR is the number of variables, and @c WIDTH is the number
+ * of elements in one tile (the size of the @c CxxUtils::vec used).
+ */
+template <class T, size_t NVAR, size_t WIDTH = 8>
+class MultiConstAccessor
+{
+public:
+  static_assert (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                 "MultiConstAccessor requires an arithmetic type");
+
+  /// Vectorized type holding one variable of a tile.
+  using vec_t = CxxUtils::vec<T, WIDTH>;
+
+
+  /**
+   * @brief @c WIDTH consecutive elements of each of the variables.
+   */
+  struct Tile
+  {
+    /// One vector per variable, in the order given to the constructor.
+    vec_t var[NVAR];
+
+    /// Index in the container of the first element of the tile.
+    size_t begin = 0;
+
+    /// Number of lanes holding elements of the container.
+    size_t n = 0;
+
+    /// Return the vector for variable @c i.
+    const vec_t& operator[] (size_t i) const { return var[i]; }
+  };
+
+
+  /**
+   * @brief The tiles of one container.
+   *
+   * Holds pointers to the variables of the container; it must not be used
+   * after the container is modified.
+   */
+  class Tiles
+  {
+  public:
+    /**
+     * @brief Return the number of elements in the container.
+     */
+    size_t size() const;
+
+
+    /**
+     * @brief Return the number of tiles needed to cover the container.
+     */
+    size_t nTiles() const;
+
+
+    /**
+     * @brief Load one tile.
+     * @param itile Index of the tile.
+     * @param tile[out] Tile to fill.
+     *
+     * For @c itile >= @c nTiles(), the tile is empty: @c n is 0
+     * and all lanes hold the padding value.
+     */
+    void load (size_t itile, Tile& tile) const;
+
+
+    /**
+     * @brief Return one tile.
+     * @param itile Index of the tile.
+     */
+    Tile operator[] (size_t itile) const;
+
+
+  private:
+    friend class MultiConstAccessor;
+
+    /**
+     * @brief Constructor.
+     * @param ptrs Pointers to the start of the variables.
+     * @param sz Number of elements in the container.
+     * @param pad Value with which to fill the unused lanes of the last tile.
+     */
+    Tiles (const std::array<const T*, NVAR>& ptrs, size_t sz, T pad);
+
+    /// Pointers to the start of the variables.
+    std::array<const T*, NVAR> m_ptrs;
+
+    /// Number of elements in the container.
+    size_t m_size;
+
+    /// Value for the unused lanes of the last tile.
+    T m_pad;
+  };
+
+
+  /**
+   * @brief Constructor.
+   * @param names Names of the aux variables.
+   * @param clsname The name of their associated class.  May be blank.
+   *
+   * The name -> auxid lookup is done here.
+   */
+  MultiConstAccessor (const std::array<std::string, NVAR>& names,
+                      const std::string& clsname = "");
+
+
+  /**
+   * @brief Constructor.
+   * @param auxids IDs of the aux variables.
+   */
+  MultiConstAccessor (const std::array<SG::auxid_t, NVAR>& auxids);
+
+
+  /**
+   * @brief Return the aux id of variable @c i.
+   */
+  SG::auxid_t auxid (size_t i) const;
+
+
+  /**
+   * @brief Test whether all the variables are available for a container.
+   * @param container The container to test.
+   */
+  bool isAvailable (const AuxVectorData& container) const;
+
+
+  /**
+   * @brief Return the tiles for a container.
+   * @param container The container from which to read.
+   * @param pad Value with which to fill the unused lanes of the last tile.
+   *
+   * Raises an exception if any of the variables is not available.
+   */
+  Tiles getTiles (const AuxVectorData& container, T pad = 0) const;
+
+
+private:
+  /// IDs of the variables.
+  std::array<SG::auxid_t, NVAR> m_auxids;
+};
+
+
+} // namespace SG
+
+
+#include "AthContainers/MultiConstAccessor.icc"
+
+
+#endif // not ATHCONTAINERS_MULTICONSTACCESSOR_H
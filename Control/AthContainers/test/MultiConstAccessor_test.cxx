@@ -0,0 +1,116 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file AthContainers/test/MultiConstAccessor_test.cxx
+ * @date Oct, 2026
+ * @brief Regression tests for MultiConstAccessor.
+ */
+
+
+#undef NDEBUG
+#include "AthContainers/MultiConstAccessor.h"
+#include "AthContainers/AuxElement.h"
+#include "AthContainers/AuxStoreInternal.h"
+#include "AthContainers/exceptions.h"
+#include "TestTools/expect_exception.h"
+#include <iostream>
+#include <cassert>
+
+
+namespace {
+
+
+class TestContainer
+  : public SG::AuxVectorData
+{
+public:
+  TestContainer (size_t sz) : m_size (sz) {}
+  virtual size_t size_v() const override { return m_size; }
+  virtual size_t capacity_v() const override { return m_size; }
+  using SG::AuxVectorData::setStore;
+
+private:
+  size_t m_size;
+};
+
+
+} // anonymous namespace
+
+
+void test1()
+{
+  std::cout << "test1\n";
+
+  const size_t N = 11;
+  SG::AuxTypeRegistry& r = SG::AuxTypeRegistry::instance();
+  SG::auxid_t aid = r.getAuxID<float> ("aFloat");
+  SG::auxid_t bid = r.getAuxID<float> ("bFloat");
+
+  SG::AuxStoreInternal store;
+  float* a = reinterpret_cast<float*> (store.getData (aid, N, N));
+  float* b = reinterpret_cast<float*> (store.getData (bid, N, N));
+  for (size_t i = 0; i < N; i++) {
+    a[i] = i;
+    b[i] = 100 + i;
+  }
+
+  TestContainer c (N);
+  c.setStore (&store);
+
+  SG::MultiConstAccessor<float, 2, 4> acc ({"aFloat", "bFloat"});
+  assert (acc.auxid(0) == aid);
+  assert (acc.auxid(1) == bid);
+  assert (acc.isAvailable (c));
+
+  SG::MultiConstAccessor<float, 2, 4> acc2 ({aid, bid});
+  assert (acc2.auxid(1) == bid);
+
+  auto tiles = acc.getTiles (c, -1);
+  assert (tiles.size() == N);
+  assert (tiles.nTiles() == 3);
+
+  for (size_t itile = 0; itile < tiles.nTiles(); itile++) {
+    auto tile = tiles[itile];
+    assert (tile.begin == itile * 4);
+    assert (tile.n == (itile < 2 ? 4 : 3));
+    for (size_t j = 0; j < 4; j++) {
+      size_t i = tile.begin + j;
+      if (i < N) {
+        assert (tile[0][j] == a[i]);
+        assert (tile[1][j] == b[i]);
+      }
+      else {
+        assert (tile[0][j] == -1);
+        assert (tile[1][j] == -1);
+      }
+    }
+  }
+
+  // Past the end: empty and padded
+  for (size_t itile : {size_t(3), size_t(1000)}) {
+    auto tile = tiles[itile];
+    assert (tile.begin == N);
+    assert (tile.n == 0);
+    for (size_t j = 0; j < 4; j++) {
+      assert (tile[0][j] == -1);
+      assert (tile[1][j] == -1);
+    }
+  }
+
+  SG::MultiConstAccessor<float, 2, 4> acc3 ({"aFloat", "cFloat"});
+  assert (!acc3.isAvailable (c));
+  EXPECT_EXCEPTION (SG::ExcBadAuxVar, acc3.getTiles (c));
+
+  TestContainer c0 (0);
+  c0.setStore (&store);
+  assert (acc3.getTiles (c0).nTiles() == 0);
+}
+
+
+int main()
+{
+  std::cout << "AthContainers/MultiConstAccessor_test\n";
+  test1();
+  return 0;
+}
@@ -1,4 +1,4 @@
-# Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 from AthenaCommon.SystemOfUnits import GeV, TeV
 from AthenaConfiguration.AthConfigFlags import AthConfigFlags, isGaudiEnv
@@ -142,6 +142,7 @@ def initConfigFlags():
     acf.addFlag('MP.UseSharedReader', False)
     acf.addFlag('MP.UseSharedWriter', False)
     acf.addFlag('MP.UseParallelCompression', True)
+    acf.addFlag('MP.UseSharedConditions', False) # Build large conditions payloads once in shared memory for all workers
 
     acf.addFlag('Common.MsgSuppression', True) # Enable suppression of printout in MessageSvc
     acf.addFlag('Common.MsgSourceLength',50) #Length of the source-field in the format str of MessageSvc
@@ -332,6 +333,8 @@ def initConfigFlags():
         acf.addFlag("IOVDb.SqliteFolders",(),help="Folders listed here will be taken from the IOVDb.SqliteInput file instead of the production db. If empty, all folders found in the file are used.")
 #PoolSvc Flags:
     acf.addFlag("PoolSvc.MaxFilesOpen", lambda prevFlags : 2 if prevFlags.MP.UseSharedReader else 0)
+    acf.addFlag("PoolSvc.UseParallelUnzip", False, help="Decompress the next cluster of the input files in parallel (needs threads)")
+    acf.addFlag("PoolSvc.UseAsyncPrefetching", False, help="Read the next cluster of the input files in a background thread")
 
 
     def __bfield():
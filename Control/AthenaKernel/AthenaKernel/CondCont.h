@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 /**
  * @file AthenaKernel/CondCont.h
@@ -674,6 +674,12 @@ private:
   /// Set of mapped objects.
   CondContSet m_condSet;
 
+  /// Result of the last lookup in each event slot, to skip the search
+  /// while events stay in the same IOV.  Lookups from other slots are
+  /// done without a cache.
+  std::unique_ptr<CondContSet::FindCache[]> m_findCache;
+  size_t m_nFindCache;
+
   /// Handle to the cleaner service.
   ServiceHandle<Athena::IConditionsCleanerSvc> m_cleanerSvc;
 
@@ -0,0 +1,61 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file AthenaKernel/ISharedCondBufferSvc.h
+ * @brief Interface for sharing immutable conditions payloads between processes.
+ */
+
+#ifndef ATHENAKERNEL_ISHAREDCONDBUFFERSVC_H
+#define ATHENAKERNEL_ISHAREDCONDBUFFERSVC_H
+
+
+#include "GaudiKernel/IInterface.h"
+#include "GaudiKernel/StatusCode.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+
+/**
+ * @brief Interface for sharing immutable conditions payloads between processes.
+ *
+ * With AthenaMP, each worker builds its own copy of the conditions objects
+ * whenever a new IOV is reached.  For large flat payloads (for example
+ * tables of floats indexed by cell hash), a conditions algorithm can instead
+ * ask for a buffer identified by a key describing its content (typically the
+ * algorithm name and the IOV range).  The buffer is filled by the first
+ * process asking for it, and mapped read-only by all others.
+ */
+class ISharedCondBufferSvc
+  : virtual public IInterface
+{
+public:
+  DeclareInterfaceID (ISharedCondBufferSvc, 1, 0);
+
+
+  /// Function filling a newly created buffer.
+  typedef std::function<StatusCode (void* buffer, size_t size)> Filler_t;
+
+
+  /**
+   * @brief Get a read-only buffer shared between all processes of the job.
+   * @param key Identifies the content of the buffer.  Processes asking
+   *            for the same key must expect the same content.
+   * @param size Size of the buffer in bytes.
+   * @param fill Called to fill the buffer, if it does not exist yet.
+   *
+   * The buffer is aligned for any fundamental type, and stays mapped
+   * as long as the returned pointer (or a copy of it) is alive.
+   * Returns nullptr if the buffer cannot be shared, or if the filling
+   * failed; the caller should then build a private copy.
+   */
+  virtual std::shared_ptr<const void> get (const std::string& key,
+                                           size_t size,
+                                           const Filler_t& fill) = 0;
+};
+
+
+#endif // not ATHENAKERNEL_ISHAREDCONDBUFFERSVC_H
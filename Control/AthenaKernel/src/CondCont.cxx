@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 /**
  * @file AthenaKernel/src/CondCont.cpp
@@ -14,7 +14,10 @@
 #include "AthenaKernel/ExtendedEventContext.h"
 #include "CxxUtils/AthUnlikelyMacros.h"
 #include "CxxUtils/checker_macros.h"
+#include "GaudiKernel/ConcurrencyFlags.h"
 #include "GaudiKernel/MsgStream.h"
+#include "GaudiKernel/ThreadLocalContext.h"
+#include <algorithm>
 #include <iostream>
 
 
@@ -418,12 +421,14 @@ CondContBase::CondContBase (Athena::IRCUSvc& rcusvc,
     m_id (id),
     m_proxy (proxy),
     m_condSet (Updater_t (rcusvc), payloadDeleter, capacity),
+    m_nFindCache (std::max (Gaudi::Concurrency::ConcurrencyFlags::numConcurrentEvents(), std::size_t (1))),
     m_cleanerSvc (s_cleanerSvcName, "CondContBase"),
     m_deps (DepSet::Updater_t(), 16)
 {
   if (!m_cleanerSvc.retrieve().isSuccess()) {
     std::abort();
   }
+  m_findCache = std::make_unique<CondContSet::FindCache[]> (m_nFindCache);
 }
 
 
@@ -668,7 +673,11 @@ const void* CondContBase::findBase (const EventIDBase& t,
     std::abort();
   }
 
-  CondContSet::const_iterator it = m_condSet.find (key);
+  // Events in the same slot usually stay in the same IOV.
+  const EventContext::ContextID_t slot = Gaudi::Hive::currentContext().slot();
+  CondContSet::const_iterator it = slot < m_nFindCache ?
+    m_condSet.find (key, m_findCache[slot]) :
+    m_condSet.find (key);
   if (it && key < it->first.m_stop) {
     if (r) {
       *r = &it->first.m_range;
@@ -0,0 +1,211 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "SharedCondBufferSvc.h"
+
+#include "CxxUtils/crc64.h"
+
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <new>
+#include <thread>
+
+namespace bip = boost::interprocess;
+
+namespace {
+
+/// Placed at the start of each segment, the payload follows at headerSize
+struct SegmentHeader {
+  enum State : uint32_t { EMPTY = 0, READY, FAILED };
+  std::atomic<uint32_t> state;
+  uint64_t size;
+};
+constexpr size_t headerSize = 64;
+static_assert(sizeof(SegmentHeader) <= headerSize);
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+constexpr std::chrono::milliseconds pollInterval(10);
+
+std::string segmentPrefix(pid_t motherPid) {
+  return "AthMPCond_" + std::to_string(motherPid) + "_";
+}
+
+/// Keep the mapping alive as long as the payload is used
+std::shared_ptr<const void> payload(std::shared_ptr<bip::mapped_region> region) {
+  const void* p = static_cast<const char*>(region->get_address()) + headerSize;
+  return std::shared_ptr<const void>(std::move(region), p);
+}
+
+} // anonymous namespace
+
+StatusCode SharedCondBufferSvc::initialize()
+{
+  // Initialized before the fork, so this is the mother in the workers too
+  m_motherPid = getpid();
+  ATH_MSG_DEBUG("Shared conditions segments are named " << segmentPrefix(m_motherPid) << "*");
+  return StatusCode::SUCCESS;
+}
+
+StatusCode SharedCondBufferSvc::finalize()
+{
+  ATH_MSG_INFO("Created " << m_nCreated << " shared conditions buffers (" << m_bytesCreated/1024 << " kB), "
+               << "attached to " << m_nAttached << " (" << m_bytesAttached/1024 << " kB), "
+               << m_nFailed << " failed");
+  removeSegments();
+  return StatusCode::SUCCESS;
+}
+
+std::shared_ptr<const void> SharedCondBufferSvc::get(const std::string& key,
+                                                     size_t size,
+                                                     const Filler_t& fill)
+{
+  if (size < m_minSize) return nullptr;
+
+  {
+    // Already mapped in this process?
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (std::shared_ptr<const void> buffer = m_buffers[key].lock()) {
+      return buffer;
+    }
+  }
+
+  // Not locked while filling the segment or waiting for another process to fill it,
+  // which can take long. Another thread asking for the same key waits in attach().
+  const std::string segName = segmentPrefix(m_motherPid) + CxxUtils::crc64format(CxxUtils::crc64(key));
+  std::shared_ptr<const void> buffer = create(segName, size, fill);
+  if (!buffer) return nullptr;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::weak_ptr<const void>& cached = m_buffers[key];
+  // Keep the mapping of the first thread, if several attached meanwhile
+  if (std::shared_ptr<const void> other = cached.lock()) {
+    return other;
+  }
+  cached = buffer;
+  return buffer;
+}
+
+std::shared_ptr<const void> SharedCondBufferSvc::create(const std::string& segName,
+                                                        size_t size,
+                                                        const Filler_t& fill)
+{
+  // Creation is exclusive: only one process fills the segment
+  std::unique_ptr<bip::shared_memory_object> shm;
+  try {
+    shm = std::make_unique<bip::shared_memory_object>(bip::create_only, segName.c_str(), bip::read_write);
+  } catch (const bip::interprocess_exception& e) {
+    if (e.get_error_code() == bip::already_exists_error) {
+      return attach(segName, size);
+    }
+    ATH_MSG_WARNING("Cannot create shared memory segment " << segName << ": " << e.what());
+    ++m_nFailed;
+    return nullptr;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_created.push_back(segName);
+  }
+
+  try {
+    shm->truncate(headerSize + size);
+    bip::mapped_region region(*shm, bip::read_write);
+    SegmentHeader* header = new (region.get_address()) SegmentHeader;
+    header->size = size;
+    bool filled = false;
+    try {
+      filled = fill(static_cast<char*>(region.get_address()) + headerSize, size).isSuccess();
+    } catch (const std::exception& e) {
+      ATH_MSG_WARNING("Exception while filling shared memory segment " << segName << ": " << e.what());
+    }
+    header->state.store(filled ? SegmentHeader::READY : SegmentHeader::FAILED, std::memory_order_release);
+    if (!filled) {
+      ++m_nFailed;
+      return nullptr;
+    }
+  } catch (const bip::interprocess_exception& e) {
+    // Do not leave the other processes waiting for it
+    ATH_MSG_WARNING("Cannot fill shared memory segment " << segName << ": " << e.what());
+    bip::shared_memory_object::remove(segName.c_str());
+    ++m_nFailed;
+    return nullptr;
+  }
+
+  // Drop the write access, the payload is immutable from now on
+  auto region = std::make_shared<bip::mapped_region>(*shm, bip::read_only);
+  ++m_nCreated;
+  m_bytesCreated += size;
+  ATH_MSG_DEBUG("Created shared memory segment " << segName << " of " << size << " bytes");
+  return payload(std::move(region));
+}
+
+std::shared_ptr<const void> SharedCondBufferSvc::attach(const std::string& segName, size_t size)
+{
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(m_waitTimeout.value());
+  do {
+    try {
+      bip::shared_memory_object shm(bip::open_only, segName.c_str(), bip::read_only);
+      bip::offset_t segSize = 0;
+      // The creator may not have sized the segment yet
+      if (shm.get_size(segSize) && static_cast<size_t>(segSize) >= headerSize + size) {
+        auto region = std::make_shared<bip::mapped_region>(shm, bip::read_only);
+        const SegmentHeader* header = static_cast<const SegmentHeader*>(region->get_address());
+        uint32_t state = header->state.load(std::memory_order_acquire);
+        while (state == SegmentHeader::EMPTY && std::chrono::steady_clock::now() < deadline) {
+          std::this_thread::sleep_for(pollInterval);
+          state = header->state.load(std::memory_order_acquire);
+        }
+        if (state == SegmentHeader::READY && header->size == size) {
+          ++m_nAttached;
+          m_bytesAttached += size;
+          ATH_MSG_DEBUG("Attached to shared memory segment " << segName << " of " << size << " bytes");
+          return payload(std::move(region));
+        }
+        if (state == SegmentHeader::READY) {
+          ATH_MSG_WARNING("Shared memory segment " << segName << " has " << header->size
+                          << " bytes, expected " << size);
+        }
+        else if (state == SegmentHeader::FAILED) {
+          ATH_MSG_DEBUG("Filling of shared memory segment " << segName << " failed in another process");
+        }
+        break;
+      }
+    } catch (const bip::interprocess_exception&) {
+      // Not visible yet, or removed after a failure
+    }
+    std::this_thread::sleep_for(pollInterval);
+  } while (std::chrono::steady_clock::now() < deadline);
+
+  if (std::chrono::steady_clock::now() >= deadline) {
+    ATH_MSG_WARNING("Timeout while waiting for shared memory segment " << segName);
+  }
+  ++m_nFailed;
+  return nullptr;
+}
+
+void SharedCondBufferSvc::removeSegments()
+{
+  // Existing mappings stay valid, only the names are removed
+  if (getpid() != m_motherPid) return;
+
+  for (const std::string& segName : m_created) {
+    bip::shared_memory_object::remove(segName.c_str());
+  }
+  m_created.clear();
+
+  // Segments created by the workers
+  const std::string prefix = segmentPrefix(m_motherPid);
+  std::error_code ec;
+  for (const auto& entry : std::filesystem::directory_iterator("/dev/shm", ec)) {
+    const std::string segName = entry.path().filename().string();
+    if (segName.compare(0, prefix.size(), prefix) == 0) {
+      bip::shared_memory_object::remove(segName.c_str());
+    }
+  }
+}
@@ -0,0 +1,72 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef ATHENAMP_SHAREDCONDBUFFERSVC_H
+#define ATHENAMP_SHAREDCONDBUFFERSVC_H
+
+/** @file SharedCondBufferSvc.h
+ *  @brief Shares immutable conditions payloads between AthenaMP processes.
+ *
+ *  Each buffer is a POSIX shared memory segment, named after the PID of the
+ *  mother process and a CRC of the key. The first process asking for a key
+ *  creates the segment, fills it and marks it ready; all other processes
+ *  wait for the mark and map the segment read-only. The mother process
+ *  removes the segments at finalize.
+ **/
+
+#include "AthenaKernel/ISharedCondBufferSvc.h"
+#include "AthenaBaseComps/AthService.h"
+
+#include <sys/types.h>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class SharedCondBufferSvc
+  : public extends<AthService, ISharedCondBufferSvc>
+{
+public:
+  using extends::extends;
+
+  virtual StatusCode initialize() override;
+  virtual StatusCode finalize() override;
+
+  virtual std::shared_ptr<const void> get (const std::string& key,
+                                           size_t size,
+                                           const Filler_t& fill) override;
+
+private:
+  /// Create and fill the segment, returns nullptr on failure
+  std::shared_ptr<const void> create (const std::string& segName, size_t size, const Filler_t& fill);
+
+  /// Map a segment created by another process, returns nullptr on failure
+  std::shared_ptr<const void> attach (const std::string& segName, size_t size);
+
+  /// Remove the segments of this job
+  void removeSegments();
+
+  Gaudi::Property<size_t> m_minSize{this, "MinSize", 1024*1024,
+      "Buffers smaller than this (in bytes) are not shared"};
+  Gaudi::Property<unsigned int> m_waitTimeout{this, "WaitTimeout", 300,
+      "Time (in seconds) to wait for another process to fill a buffer, before building a private copy"};
+
+  /// PID of the process that initialized the service, i.e. the mother
+  pid_t m_motherPid{0};
+
+  /// Buffers mapped in this process
+  std::map<std::string, std::weak_ptr<const void> > m_buffers;
+  /// Segments created by this process
+  std::vector<std::string> m_created;
+  /// Protects the two above, not held while waiting for a segment
+  std::mutex m_mutex;
+
+  /// Statistics
+  std::atomic<unsigned int> m_nCreated{0}, m_nAttached{0}, m_nFailed{0};
+  std::atomic<size_t> m_bytesCreated{0}, m_bytesAttached{0};
+};
+
+#endif
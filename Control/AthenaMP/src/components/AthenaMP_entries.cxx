@@ -1,5 +1,7 @@
 #include "../AthMpEvtLoopMgr.h"
+#include "../SharedCondBufferSvc.h"
 
   
 DECLARE_COMPONENT( AthMpEvtLoopMgr )
+DECLARE_COMPONENT( SharedCondBufferSvc )
 
@@ -0,0 +1,163 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file AthenaMP/test/SharedCondBufferSvc_test.cxx
+ * @date Oct, 2026
+ * @brief Unit test for SharedCondBufferSvc
+ */
+
+
+#undef NDEBUG
+#include "TestTools/initGaudi.h"
+#include "AthenaKernel/ISharedCondBufferSvc.h"
+#include "GaudiKernel/IService.h"
+#include "GaudiKernel/ISvcLocator.h"
+#include <sys/wait.h>
+#include <unistd.h>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+
+
+namespace {
+
+// Above the default MinSize
+constexpr size_t bufSize = 2*1024*1024;
+
+ISharedCondBufferSvc::Filler_t filler (uint32_t seed, std::atomic<int>& nCalls)
+{
+  return [seed, &nCalls] (void* buffer, size_t size) {
+    ++nCalls;
+    uint32_t* p = static_cast<uint32_t*> (buffer);
+    for (size_t i = 0; i < size / sizeof(uint32_t); ++i) p[i] = seed + i;
+    return StatusCode::SUCCESS;
+  };
+}
+
+bool check (const std::shared_ptr<const void>& buffer, uint32_t seed)
+{
+  const uint32_t* p = static_cast<const uint32_t*> (buffer.get());
+  for (size_t i = 0; i < bufSize / sizeof(uint32_t); ++i) {
+    if (p[i] != seed + i) return false;
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+
+// Creation, caching and failures in a single process.
+void test1 (ISharedCondBufferSvc& svc)
+{
+  std::cout << "test1\n";
+
+  std::atomic<int> nCalls = 0;
+  std::shared_ptr<const void> b1 = svc.get ("test1", bufSize, filler (1, nCalls));
+  assert (b1);
+  assert (nCalls == 1);
+  assert (check (b1, 1));
+
+  // Mapped once per process
+  std::shared_ptr<const void> b2 = svc.get ("test1", bufSize, filler (2, nCalls));
+  assert (b2 == b1);
+  assert (nCalls == 1);
+
+  // Mapped again, but not filled again, once released
+  b1.reset();
+  b2.reset();
+  b1 = svc.get ("test1", bufSize, filler (3, nCalls));
+  assert (b1);
+  assert (nCalls == 1);
+  assert (check (b1, 1));
+
+  // Too small to be shared
+  assert (!svc.get ("test1small", 1024, filler (4, nCalls)));
+  assert (nCalls == 1);
+
+  // Failed filling
+  assert (!svc.get ("test1fail", bufSize,
+                    [] (void*, size_t) { return StatusCode::FAILURE; }));
+  // ... and other processes do not wait for it
+  assert (!svc.get ("test1fail", bufSize, filler (5, nCalls)));
+  assert (nCalls == 1);
+}
+
+
+// Buffer filled by another process.  While waiting for it, the
+// other buffers are still available.
+void test2 (ISharedCondBufferSvc& svc)
+{
+  std::cout << "test2\n";
+
+  int started[2], go[2];
+  assert (pipe (started) == 0);
+  assert (pipe (go) == 0);
+
+  pid_t pid = fork();
+  assert (pid >= 0);
+  if (pid == 0) {
+    std::atomic<int> nCalls = 0;
+    auto fill = [&] (void* buffer, size_t size) {
+      char c = 0;
+      if (write (started[1], &c, 1) != 1) _exit (1);
+      if (read (go[0], &c, 1) != 1) _exit (1);
+      return filler (10, nCalls) (buffer, size);
+    };
+    std::shared_ptr<const void> b = svc.get ("test2", bufSize, fill);
+    _exit (b && nCalls == 1 ? 0 : 1);
+  }
+
+  char c = 0;
+  assert (read (started[0], &c, 1) == 1);
+
+  // Waits for the child
+  std::atomic<int> nCalls = 0;
+  std::future<std::shared_ptr<const void> > waiting =
+    std::async (std::launch::async,
+                [&] () { return svc.get ("test2", bufSize, filler (11, nCalls)); });
+  usleep (100000);
+
+  std::shared_ptr<const void> other = svc.get ("test2other", bufSize, filler (12, nCalls));
+  assert (other);
+  assert (check (other, 12));
+  assert (nCalls == 1);
+  assert (waiting.wait_for (std::chrono::seconds (0)) != std::future_status::ready);
+
+  assert (write (go[1], &c, 1) == 1);
+  std::shared_ptr<const void> b = waiting.get();
+  assert (b);
+  assert (check (b, 10));
+  assert (nCalls == 1);
+
+  int status = 0;
+  assert (waitpid (pid, &status, 0) == pid);
+  assert (WIFEXITED (status) && WEXITSTATUS (status) == 0);
+}
+
+
+int main()
+{
+  std::cout << "AthenaMP/SharedCondBufferSvc_test\n";
+  ISvcLocator* svcloc = nullptr;
+  if (!Athena_test::initGaudi (svcloc)) {
+    std::cerr << "This test can not be run" << std::endl;
+    return 0;
+  }
+  assert (svcloc);
+
+  IService* isvc = nullptr;
+  if (svcloc->service ("SharedCondBufferSvc", isvc).isFailure()) std::abort();
+  ISharedCondBufferSvc* svc = dynamic_cast<ISharedCondBufferSvc*> (isvc);
+  if (!svc) std::abort();
+
+  test1 (*svc);
+  test2 (*svc);
+
+  // Removes the segments
+  assert (isvc->finalize().isSuccess());
+  return 0;
+}
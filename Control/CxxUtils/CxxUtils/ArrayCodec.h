@@ -0,0 +1,134 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CxxUtils/ArrayCodec.h
+ * @date Oct, 2026
+ * @brief Transformations applied to an array of numbers before writing,
+ *        to make it compress better.
+ */
+
+
+#ifndef CXXUTILS_ARRAYCODEC_H
+#define CXXUTILS_ARRAYCODEC_H
+
+
+#include <cstddef>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+
+namespace CxxUtils {
+
+
+/**
+ * @brief Transformations applied to an array of numbers before writing,
+ *        to make it compress better.
+ *
+ * A codec is a chain of steps, given as a comma-separated string.
+ * The steps are applied in order by @c encode, and undone in reverse
+ * order by @c decode.  The available steps are:
+ *
+ *   mantissa:N        - Round a float to N (5 to 23) mantissa bits,
+ *                       as done by @c FloatCompressor.
+ *                       Lossy; there is nothing to undo on read.
+ *   fixed:N:MIN:MAX   - Store a float as an N-bit integer code over the
+ *                       range [MIN, MAX].  Values outside the range are
+ *                       clamped, NaNs are stored as MIN.  Lossy; decoding
+ *                       converts the codes back to floats.
+ *   delta             - Replace each element but the first by the zigzag-encoded
+ *                       difference from the previous one.  Useful for sorted
+ *                       or slowly-varying integers.
+ *   shuffle           - Group the bytes of the elements by significance,
+ *                       so that the (often zero) high bytes are contiguous.
+ *
+ * At most one of @c mantissa and @c fixed may be given, and it must
+ * come first.  These two apply only to floats; @c delta and @c shuffle
+ * apply to any arithmetic type (except bool) and work on the bit patterns.
+ * For example, "fixed:16:-3.1416:3.1416,shuffle".
+ */
+class ArrayCodec
+{
+public:
+  enum class Step { Mantissa, Fixed, Delta, Shuffle };
+
+
+  /// Default constructor: the identity codec.
+  ArrayCodec() = default;
+
+
+  /**
+   * @brief Constructor from a codec specification.
+   * @param spec Comma-separated list of steps (see above).
+   *
+   * Throws @c std::invalid_argument if @c spec is not valid.
+   */
+  explicit ArrayCodec (const std::string& spec);
+
+
+  /// The specification from which this codec was made.
+  const std::string& spec() const { return m_spec; }
+
+
+  /// True if this is the identity codec.
+  bool empty() const { return m_steps.empty(); }
+
+
+  /// True if @c decode has something to do.
+  bool needsDecode() const;
+
+
+  /**
+   * @brief Test if this codec can be applied to elements of type @c ti.
+   */
+  bool supports (const std::type_info& ti) const;
+
+
+  /**
+   * @brief Encode an array in place.
+   * @param ti Type of the elements.
+   * @param data Pointer to the first element.
+   * @param n Number of elements.
+   *
+   * Returns false, leaving the data unchanged, if the type is not supported.
+   */
+  bool encode (const std::type_info& ti, void* data, size_t n) const;
+
+
+  /**
+   * @brief Decode in place an array written with @c encode.
+   * @param ti Type of the elements.
+   * @param data Pointer to the first element.
+   * @param n Number of elements.
+   *
+   * Returns false, leaving the data unchanged, if the type is not supported.
+   */
+  bool decode (const std::type_info& ti, void* data, size_t n) const;
+
+
+private:
+  struct StepInfo
+  {
+    Step m_step;
+    unsigned int m_nbits = 0;
+    float m_min = 0;
+    float m_max = 0;
+  };
+
+  void encodeFixed (const StepInfo& s, float* data, size_t n) const;
+  void decodeFixed (const StepInfo& s, float* data, size_t n) const;
+
+  /// The specification.
+  std::string m_spec;
+
+  /// The parsed steps.
+  std::vector<StepInfo> m_steps;
+};
+
+
+} // namespace CxxUtils
+
+
+#endif // not CXXUTILS_ARRAYCODEC_H
@@ -0,0 +1,785 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+ * Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration.
+ */
+/**
+ * @file CxxUtils/ConcurrentGroupHashmapImpl.h
+ * @date Oct, 2026
+ * @brief Hash table allowing concurrent, lockless reads,
+ *        probing entries in groups of control bytes.
+ */
+
+
+#ifndef CXXUTILS_CONCURRENTGROUPHASHMAPIMPL_H
+#define CXXUTILS_CONCURRENTGROUPHASHMAPIMPL_H
+
+
+#include "CxxUtils/ConcurrentHashmapImpl.h"
+#include "CxxUtils/bitscan.h"
+#include <functional>
+#include <cstdint>
+#include <cstdlib>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <new>
+
+
+class ConcurrentGroupHashmapImplTest;
+
+
+namespace CxxUtils {
+namespace detail {
+
+
+/**
+ * @brief A group of control bytes for ConcurrentGroupHashmapImpl.
+ *
+ * Each entry in the hash table has an associated one-byte control word.
+ * This is either EMPTY, DELETED, or a 7-bit fragment of the hash
+ * of the entry's key.  Control bytes are grouped together in blocks
+ * of GROUP_SIZE, and all the control bytes in a group can be compared
+ * against a given value at once using SIMD instructions (SSE2 on x86;
+ * a portable fallback is used elsewhere).  The results are returned
+ * as a bitmask, with bit @c i set if element @c i matched.
+ */
+class CHMGroup
+{
+public:
+  /// Number of control bytes in one group.
+  static constexpr size_t GROUP_SIZE = 16;
+
+  /// Type of a control byte.
+  using ctrl_t = std::atomic<uint8_t>;
+
+  /// Control byte marking an empty entry.
+  static constexpr uint8_t EMPTY = 0x80;
+  /// Control byte marking a deleted entry.
+  static constexpr uint8_t DELETED = 0xfe;
+
+  /// Bitmask of matching elements in a group.
+  using mask_t = uint32_t;
+
+
+  /**
+   * @brief Constructor.
+   * @param ctrl Pointer to the first control byte in the group.
+   *             Must be aligned to GROUP_SIZE.
+   *
+   * The control bytes are read with a single load; an acquire fence
+   * follows, so that any entry data published before the control
+   * bytes were written will be visible.
+   */
+  explicit CHMGroup (const ctrl_t* ctrl);
+
+
+  /**
+   * @brief Return a mask of the elements matching a hash fragment.
+   * @param h2 The 7-bit hash fragment to match.
+   */
+  mask_t match (uint8_t h2) const;
+
+
+  /**
+   * @brief Return a mask of the empty elements in the group.
+   */
+  mask_t matchEmpty() const;
+
+
+private:
+  /// Copy of the control bytes for the group.
+  alignas(GROUP_SIZE) uint8_t m_ctrl[GROUP_SIZE];
+};
+
+
+/**
+ * @brief Helper to generate group probes.
+ *
+ * To search for an entry with hash code @c hash:
+ *@code
+ *  CHMGroupIterator it (group, groupMask, probeLimit);
+ *  do {
+ *    CHMGroup g (ctrl + it.group() * CHMGroup::GROUP_SIZE);
+ *    <<test if any entry in g is the desired entry and handle if so>>
+ *  } while (it.next());
+ *  // Too many probes --- failed.
+ @endcode
+ *
+ * Groups are visited using triangular probing, which will visit
+ * every group in the table if the number of groups is a power of 2.
+ */
+struct CHMGroupIterator
+{
+  /**
+   * @brief Constructor.
+   * @param group Index of the first group to probe.
+   * @param mask Group index mask; i.e., the number of groups - 1.
+   * @param probeLimit Maximum number of groups to try before failing.
+   */
+  CHMGroupIterator (size_t group, size_t mask, size_t probeLimit);
+
+
+  /**
+   * @brief Index of the group currently being probed.
+   */
+  size_t group() const;
+
+
+  /**
+   * @brief Return the number of groups probed so far.
+   */
+  size_t nprobes() const;
+
+
+  /**
+   * @brief Move to the next probe.
+   * Returns true if we should continue, or false if we've hit the maximum
+   * number of probes.
+   */
+  bool next();
+
+
+private:
+  /// Mask for group indices.
+  const size_t m_mask;
+  /// Maximum number of probes to try.
+  const size_t m_probeLimit;
+  /// Index of the group currently being probed.
+  size_t m_group;
+  /// Number of probes tried so far.
+  size_t m_nprobes;
+};
+
+
+/**
+ * @brief Hash table allowing concurrent, lockless reads,
+ *        probing entries in groups of control bytes.
+ *
+ * This is an alternate implementation of ConcurrentHashmapImpl,
+ * with the same interface, template arguments, and semantics,
+ * and using the same Updater protocol for replacing the table
+ * when it needs to grow.  ConcurrentStrMap may be told to use it
+ * in place of ConcurrentHashmapImpl with its IMPL template argument.
+ * See ConcurrentHashmapImpl for a description of the template arguments
+ * and the caveats for deletion.
+ *
+ * The difference is in how the table is probed.  In addition to the
+ * key/value entries, the table holds one control byte per entry,
+ * holding a 7-bit fragment of the hash of the key (or a marker
+ * for an empty or deleted entry).  The control bytes are grouped
+ * in blocks of 16, which may be compared against the hash fragment
+ * of the key being searched for with a single SIMD comparison.
+ * Only the entries for which the hash fragment matches need to have
+ * the matcher called on them; this is a significant savings
+ * if the matcher is expensive (as for string keys).  A search
+ * terminates when we find a group containing an empty entry
+ * (the design is similar to that of the `Swiss tables' in abseil).
+ *
+ * Insertions (which are serialized with a mutex) write the value,
+ * then the key, and finally the control byte, with release semantics.
+ * Readers load the control bytes for a group followed by an acquire fence,
+ * so a reader that sees a control byte for an entry will also
+ * see its key and value.
+ *
+ * The table is grown either if we fail to find a place for a new
+ * entry or if the table is more than 7/8 full (including deleted
+ * entries).  The latter condition ensures that searches for entries
+ * which are not in the table will terminate quickly.
+ */
+template <template <class> class UPDATER_,
+          typename HASHER_ = std::hash<uintptr_t>,
+          typename MATCHER_ = std::equal_to<uintptr_t>,
+          uintptr_t NULLVAL_ = 0,
+          uintptr_t TOMBSTONE_ = NULLVAL_>
+class ConcurrentGroupHashmapImpl
+{
+public:
+  /// Type used for keys and values --- an unsigned big enough to hold a pointer.
+  using val_t = ConcurrentHashmapVal_t;
+  /// Hash object.
+  using Hasher_t = HASHER_;
+  /// Key match object.
+  using Matcher_t = MATCHER_;
+  /// Null key value.
+  static constexpr uintptr_t nullval = NULLVAL_;
+  /// Tombstone key value.  Must be different from nullval to allow erasures.
+  static constexpr uintptr_t tombstone = TOMBSTONE_;
+  /// Used to represent an invalid table index.
+  static constexpr size_t INVALID = static_cast<size_t>(-1);
+
+  /// Lock class used for external locking.
+  using Lock_t = HashmapLock;
+
+
+private:
+  /// One entry in the hash table.
+  struct entry_t {
+    std::atomic<val_t> m_key;
+    std::atomic<val_t> m_val;
+  };
+
+  /// Type of a control byte.
+  using ctrl_t = CHMGroup::ctrl_t;
+
+  /// Assumed length in bytes of one cache line.
+  static constexpr size_t CACHELINE = 64;
+
+  /// Number of entries in one group.
+  static constexpr size_t GROUP_SIZE = CHMGroup::GROUP_SIZE;
+
+  // We read groups of control bytes directly from memory.
+  static_assert (sizeof (ctrl_t) == 1 && ctrl_t::is_always_lock_free);
+
+  // Control bytes follow the entries, so the entries must
+  // preserve the group alignment.
+  static_assert (sizeof (entry_t) % GROUP_SIZE == 0);
+
+  /// For unit testing.
+  friend class ::ConcurrentGroupHashmapImplTest;
+
+
+  /**
+   * @brief Table of hash entries.
+   *
+   * This is the actual table of hash entries.  It consists of a fixed-size
+   * header, followed by the actual array of entries, followed by the
+   * array of control bytes.  We override new in order to be able to
+   * properly allocate the space for the arrays.
+   * The start of the array of entries need to be aligned on a cache line.
+   * We make a new instance of this if the table needs to be grown.
+   */
+  class alignas(CACHELINE) Table
+  {
+  public:
+    /**
+     * @brief Constructor.
+     * @param capacity Number of entries in the table.  Must be a power of 2,
+     *                 and at least GROUP_SIZE.
+     * @param hasher Hash object to use.
+     * @param matcher Key match object to use.
+     */
+    Table (size_t capacity,
+           const Hasher_t& hasher = Hasher_t(),
+           const Matcher_t& matcher = Matcher_t());
+
+
+    /**
+     * @brief Allocator for table objects.
+     * @param capacity Size of the table (must be a power of 2).
+     *
+     * Allocate with enough space for the table of entries
+     * and the control bytes.  Also align on a cache line.
+     */
+    static void* operator new (size_t, size_t capacity);
+
+
+    /**
+     * @brief Deallocator for table objects.
+     */
+    void operator delete (void* p);
+
+
+    /**
+     * @brief Find a table entry for reading.
+     * @param key The key for which to search.
+     * @param hash The hash of the key.
+     *
+     * Returns the offset of the matching entry, or INVALID.
+     */
+    size_t probeRead (val_t key, size_t hash) const;
+
+
+    /**
+     * @brief Find a table entry for writing.
+     * @param key The key for which to search.
+     * @param hash The hash of the key.
+     * @param insert[out] True if a new entry should be made.
+     *
+     * If we find the entry, return its offset with @c insert false.
+     * If we don't find it, and there's still room in the table, return
+     * the offset of the next empty entry with @c insert true.
+     * Otherwise, return INVALID.
+     */
+    size_t probeWrite (val_t key, size_t hash, bool& insert);
+
+
+    /**
+     * @brief Fill in a new entry found with @c probeWrite.
+     * @param offset The offset of the entry.
+     * @param key The key to insert.
+     * @param hash The hash of the key.
+     * @param val The value to insert.
+     *
+     * The control byte is written last, so that concurrent readers
+     * will see either nothing or the complete entry.
+     */
+    void set (size_t offset, val_t key, size_t hash, val_t val);
+
+
+    /**
+     * @brief Mark an entry as deleted.
+     * @param offset The offset of the entry.
+     */
+    void setDeleted (size_t offset);
+
+
+    /**
+     * @brief Mark all entries as empty.
+     *
+     * Not safe to call while other threads are accessing the table.
+     */
+    void forceClear();
+
+
+    /**
+     * @brief The number of entries in the table.
+     */
+    size_t capacity() const;
+
+
+    /**
+     * @brief Return the entry for an offset.
+     * @param offset The index of the desired entry.
+     */
+    const entry_t& entry (size_t offset) const;
+
+
+    /**
+     * @brief Return the entry for an offset (non-const).
+     * @param offset The index of the desired entry.
+     */
+    entry_t& entry (size_t offset);
+
+
+    /**
+     * @brief Return the control byte for an offset.
+     * @param offset The index of the desired entry.
+     */
+    uint8_t ctrl (size_t offset) const;
+
+
+    /**
+     * @brief Split a hash code into a group index and a 7-bit fragment.
+     * @param hash The hash code.
+     * @param h2[out] The 7-bit fragment stored in the control bytes.
+     *
+     * Returns the index of the first group to probe.
+     * The hash is first mixed, so that hash functions that produce
+     * values with little variation in the low bits (such as std::hash
+     * on pointers) still give good distributions.
+     */
+    size_t splitHash (size_t hash, uint8_t& h2) const;
+
+
+  private:
+    /**
+     * @brief Return a pointer to the first control byte.
+     */
+    const ctrl_t* ctrlBytes() const;
+
+
+    /**
+     * @brief Return a pointer to the first control byte (non-const).
+     */
+    ctrl_t* ctrlBytes();
+
+
+    /// Number of entries in the table.  Must be a power of 2.
+    const size_t m_capacity;
+    /// Mask for group indices (number of groups - 1).
+    const size_t m_groupMask;
+    /// Number of bits in the group mask.
+    const size_t m_groupMaskBits;
+    /// The hash object.
+    const Hasher_t& m_hasher;
+    /// The key match object.
+    const Matcher_t& m_matcher;
+    /// The actual table entries.
+    /// The control bytes follow immediately after the last entry.
+    alignas(CACHELINE) entry_t m_entries[1];
+  };
+
+
+public:
+  /// Updater object.
+  using Updater_t = UPDATER_<Table>;
+  /// Context type for the updater.
+  using Context_t = typename Updater_t::Context_t;
+
+
+
+  /**
+   * @brief Constructor.
+   * @param updater Object used to manage memory
+   *                (see comments at the start of the class).
+   * @param capacity Minimum initial table size.
+   * @param hasher Hash object to use.
+   * @param matcher Key match object to use.
+   * @param ctx Execution context.
+   */
+  ConcurrentGroupHashmapImpl (Updater_t&& updater,
+                              size_t capacity_in,
+                              const Hasher_t& hasher,
+                              const Matcher_t& matcher,
+                              const typename Updater_t::Context_t& ctx);
+
+
+  // Don't implement copying.
+  // This should be done by derived classes, if desired.
+  ConcurrentGroupHashmapImpl (const ConcurrentGroupHashmapImpl&) = delete;
+  ConcurrentGroupHashmapImpl& operator= (const ConcurrentGroupHashmapImpl&) = delete;
+
+
+  /**
+   * @brief Return the number of items currently stored.
+   *   (not necessarily synced)
+   */
+  size_t size() const;
+
+
+  /**
+   * @brief Return the current table size.
+   */
+  size_t capacity() const;
+
+
+  /**
+   * @brief The number of erased elements in the current table.
+   */
+  size_t erased() const;
+
+
+  /**
+   * @brief Return the hasher object.
+   */
+  const Hasher_t& hasher() const;
+
+
+  /**
+   * @brief Return the matcher object.
+   */
+  const Matcher_t& matcher() const;
+
+
+  /**
+   * @brief Bidirectional iterator over occupied table entries.
+   *
+   * This is not itself a compliant STL iterator.
+   * Derived classes are meant to build a user-facing iterator on top of this.
+   */
+  class const_iterator
+  {
+  public:
+    /**
+     * @brief Constructor.
+     * @param table The table instance we're referencing.
+     * @param end If true, initialize this to an end iterator.
+     *            Otherwise, initialize it to a a begin iterator.
+     */
+    const_iterator (const Table& table, bool end);
+
+
+    /**
+     * @brief Constructor.
+     * @param table The table instance we're referencing.
+     * @param offset Offset of the iterator within the table.
+     *               (Must point at an occupied entry.)
+     */
+    const_iterator (const Table& table, size_t offset);
+
+
+    /**
+     * @brief Advance the iterator to the next occupied entry.
+     */
+    void next();
+
+
+    /**
+     * @brief Move the iterator back to the previous occupied entry.
+     */
+    void prev();
+
+
+    /**
+     * @brief Return the key for this iterator.
+     *        If deletions are allowed, then the key may change asynchronously
+     *        to the tombstone value.
+     */
+    val_t key() const;
+
+
+    /**
+     * @brief Return the value for this iterator.
+     */
+    val_t value() const;
+
+
+    /**
+     * @brief Compare two iterators.
+     */
+    bool operator!= (const const_iterator& other) const;
+
+
+    /**
+     * @brief Check that the iterator is valid (not pointing at the end).
+     */
+    bool valid() const;
+
+
+  private:
+    /// The table over which we're iterating.
+    const Table& m_table;
+    /// The current position in the table.
+    /// Set to -1 for an end iterator.
+    size_t m_offset;
+  };
+
+
+  /**
+   * @brief Take a lock on the container.
+   *
+   * Take a lock on the container.
+   * The lock can then be passed to put(), allowing to factor out the locking
+   * when put() gets used in a loop.  The lock will be released when the
+   * lock object is destroyed.
+   */
+  Lock_t lock();
+
+
+  /**
+   * @brief Add an entry to the table.
+   * @param key The key to insert.
+   * @param hash The hash of the key.
+   * @param val The value to insert.
+   * @param overwrite If true, then overwrite an existing entry.
+   *                  If false, an existing entry will not be changed.
+   * @param ctx Execution context.
+   *
+   * If the key already exists, then its value will be updated.
+   * Returns an iterator pointing at the entry and a flag which is
+   * true if a new element was added.
+   */
+  std::pair<const_iterator, bool>
+  put (val_t key, size_t hash, val_t val,
+       bool overwrite,
+       const typename Updater_t::Context_t& ctx);
+
+
+  /**
+   * @brief Add an entry to the table, with external locking.
+   * @param lock The lock object returned from lock().
+   * @param key The key to insert.
+   * @param hash The hash of the key.
+   * @param val The value to insert.
+   * @param overwrite If true, then overwrite an existing entry.
+   *                  If false, an existing entry will not be changed.
+   * @param ctx Execution context.
+   *
+   * If the key already exists, then its value will be updated.
+   * Returns an iterator pointing at the entry and a flag which is
+   * true if a new element was added.
+   */
+  std::pair<const_iterator, bool>
+  put (const Lock_t& lock,
+       val_t key, size_t hash, val_t val,
+       bool overwrite,
+       const typename Updater_t::Context_t& ctx);
+
+
+  /**
+   * @brief Look up an entry in the table.
+   * @param key The key to find.
+   * @param hash The hash of the key.
+   *
+   * Returns an iterator pointing at the found entry, or end().
+   */
+  const_iterator get (val_t key, size_t hash) const;
+
+
+  /**
+   * @brief Erase an entry from the table.
+   * @param key The key to erase.
+   * @param hash The hash of the key.
+   *
+   * Mark the corresponding entry as deleted.
+   * Return true on success, false on failure (key not found).
+   *
+   * The tombstone value must be different from the null value.
+   *
+   * Take care if the key or value types require memory allocation.
+   *
+   * This may cause the key type returned by an iterator to change
+   * asynchronously to the tombstone value.
+   **/
+  bool erase (val_t key, size_t hash);
+
+
+  /**
+   * @brief Erase an entry from the table, with external locking.
+   * @param lock The lock object returned from lock().
+   * @param key The key to erase.
+   * @param hash The hash of the key.
+   *
+   * Mark the corresponding entry as deleted.
+   * Return true on success, false on failure (key not found).
+   *
+   * The tombstone value must be different from the null value.
+   *
+   * Take care if the key or value types require memory allocation.
+   *
+   * This may cause the key type returned by an iterator to change
+   * asynchronously to the tombstone value.
+   **/
+  bool erase (const Lock_t& lock, val_t key, size_t hash);
+
+
+  /// Two iterators defining a range.
+  using const_iterator_range = std::pair<const_iterator, const_iterator>;
+
+
+  /**
+   * @brief Return a range that can be used to iterate over the container.
+   */
+  const_iterator_range range() const;
+
+
+  /**
+   * @brief A begin iterator for the container.
+   */
+  const_iterator begin() const;
+
+
+  /**
+   * @brief An end iterator for the container.
+   */
+  const_iterator end() const;
+
+
+  /**
+   * @brief Erase the table and change the capacity.
+   * @param capacity The new table capacity.
+   * @param ctx Execution context.
+   *
+   * Returns an iterator pointing at the start of the old table.
+   */
+  const_iterator clear (size_t capacity,
+                        const typename Updater_t::Context_t& ctx);
+
+
+  /**
+   * @brief Erase the table (don't change the capacity).
+   * @param ctx Execution context.
+   *
+   * Returns an iterator pointing at the start of the old table.
+   */
+  const_iterator clear (const typename Updater_t::Context_t& ctx);
+
+
+  /**
+   * @brief Erase the table by filling it with nulls.
+   *
+   * This method is not safe to use concurrently --- no other threads
+   * may be accessing the container at the same time, either for read
+   * or write.
+   */
+  void forceClear();
+
+
+  /**
+   * @brief Increase the table capacity.
+   * @param capacity The new table capacity.
+   * @param ctx Execution context.
+   *
+   * No action will be taken if @c capacity is smaller
+   * than the current capacity.
+   */
+  void reserve (size_t capacity,
+                const typename Updater_t::Context_t& ctx);
+
+
+  /**
+   * @brief Called when this thread is no longer referencing anything
+   *        from this container.
+   * @param ctx Execution context.
+   */
+  void quiescent (const typename Updater_t::Context_t& ctx);
+
+
+  /**
+   * @brief Swap this container with another.
+   * @param other The container with which to swap.
+   *
+   * This will also call swap on the Updater object; hence, the Updater
+   * object must also support swap.  The Hasher and Matcher instances
+   * are NOT swapped.
+   *
+   * This operation is NOT thread-safe.  No other threads may be accessing
+   * either container during this operation.
+   */
+  void swap (ConcurrentGroupHashmapImpl& other);
+
+
+  /**
+   * @brief Access the Updater instance.
+   */
+  Updater_t& updater();
+
+
+private:
+  /**
+   * @brief Test if adding one more entry would make the table too full.
+   *
+   * Must be holding a lock on the mutex to call this.
+   */
+  bool overfull() const;
+
+
+  /**
+   * @brief Make the table larger.
+   * @param ctx Execution context.
+   *
+   * Must be holding a lock on the mutex to call this.
+   */
+  bool grow (const Lock_t& lock, const typename Updater_t::Context_t& ctx);
+
+
+  /**
+   * @brief Make the table larger.
+   * @param new_capacity The new table capacity (must be a power of 2).
+   * @param ctx Execution context.
+   *
+   * Must be holding a lock on the mutex to call this.
+   */
+  bool grow (const Lock_t& lock, size_t new_capacity, const typename Updater_t::Context_t& ctx);
+
+
+  static uint64_t round_up (uint64_t);
+
+
+  /// Updater object managing memory.  See above.
+  Updater_t m_updater;
+  /// The hash object.
+  const Hasher_t m_hasher;
+  /// The key match object.
+  const Matcher_t m_matcher;
+  /// The current table instance.  Must be holding the mutex to access this.
+  Table* m_table;
+  /// Number of entries in the map.
+  std::atomic<size_t> m_size;
+  /// Number of entries that have been erased.
+  std::atomic<size_t> m_erased;
+  /// Mutex to serialize changes to the map.
+  std::mutex m_mutex;
+};
+
+
+} // namespace detail
+
+
+} // namespace CxxUtils
+
+
+#include "CxxUtils/ConcurrentGroupHashmapImpl.icc"
+
+
+#endif // not CXXUTILS_CONCURRENTGROUPHASHMAPIMPL_H
@@ -1,6 +1,6 @@
 // This file's extension implies that it's C, but it's really -*- C++ -*-.
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 /**
  * @file CxxUtils/ConcurrentRangeMap.h
@@ -19,6 +19,7 @@
 #include "CxxUtils/IsUpdater.h"
 #include "boost/range/iterator_range.hpp"
 #include <atomic>
+#include <cstdint>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -345,6 +346,33 @@ public:
   using IPayloadDeleter = CxxUtils::IRangeMapPayloadDeleter<T, typename Updater_t::Context_t>;
 
 
+  /**
+   * @brief Remembers the result of a previous lookup.
+   *
+   * This may be passed to @c find to avoid the binary search
+   * when a key falls in the same element as the previous lookup
+   * done with the same cache object.  The cached position is used only
+   * if the map has not been changed since (as given by @c generation),
+   * and is checked against the key in any case, so a cache object
+   * may be shared between threads and between maps without locking.
+   */
+  class FindCache
+  {
+  public:
+    FindCache() = default;
+    FindCache (const FindCache&) = delete;
+    FindCache& operator= (const FindCache&) = delete;
+
+  private:
+    friend class ConcurrentRangeMap;
+
+    /// Low 32 bits of the map generation in the upper word,
+    /// one plus the offset of the element from the start of the map
+    /// in the lower word.  Zero if nothing is cached.
+    std::atomic<uint64_t> m_entry = 0;
+  };
+
+
   /**
    * @brief Constructor.
    * @param updater Object used to manage memory
@@ -388,6 +416,18 @@ public:
   const_iterator find (const key_query_type& key) const;
 
 
+  /**
+   * @brief Search for the first item less than or equal to KEY.
+   * @param key The key to search for.
+   * @param cache Result of a previous lookup, updated by this call.
+   * @returns The value, or nullptr if not found.
+   *
+   * As @c find above, but the binary search is skipped if @c key
+   * falls in the element found by the previous lookup with @c cache.
+   */
+  const_iterator find (const key_query_type& key, FindCache& cache) const;
+
+
   /// Results returned from emplace().
   enum class EmplaceResult
   {
@@ -540,6 +580,15 @@ public:
   size_t maxSize() const;
 
 
+  /**
+   * @brief Return the number of changes made to the map.
+   *
+   * This is incremented each time the elements of the map
+   * or their positions change.
+   */
+  size_t generation() const;
+
+
   /**
    * @brief Return a range that can be used to iterate over the container.
    */
@@ -667,6 +716,9 @@ private:
   size_t m_nInserts;
   size_t m_maxSize;
 
+  /// Number of changes made to the map, for validating @c FindCache.
+  std::atomic<size_t> m_generation;
+
   /// Mutex protecting the container.
   mutex_t m_mutex;
 };
@@ -1,6 +1,6 @@
 // This file's extension implies that it's C, but it's really -*- C++ -*-.
 /*
- * Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration.
+ * Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration.
  */
 /**
  * @file CxxUtils/ConcurrentStrMap.h
@@ -15,6 +15,7 @@
 
 
 #include "CxxUtils/ConcurrentHashmapImpl.h"
+#include "CxxUtils/ConcurrentGroupHashmapImpl.h"
 #include "CxxUtils/UIntConv.h"
 #include "CxxUtils/concepts.h"
 #include "CxxUtils/IsUpdater.h"
@@ -45,6 +46,11 @@ namespace CxxUtils {
  * (AthenaKernel/RCUUpdater is a concrete version
  * that should work in the context of Athena.)
  *
+ * The optional IMPL argument selects the underlying hash table.
+ * The default is ConcurrentHashmapImpl; ConcurrentGroupHashmapImpl
+ * may be used instead, which needs fewer string comparisons
+ * for lookups of keys that are not in the map.
+ *
  * This mostly supports the interface of std::unordered_map, with a few
  * differences / omissions:
  *
@@ -71,7 +77,9 @@ namespace CxxUtils {
  *    need to delete it if it turns out we're doing an update rather
  *    than in insertion.
  */
-template <class VALUE, template <class> class UPDATER>
+template <class VALUE, template <class> class UPDATER,
+          template <template <class> class, class, class, uintptr_t, uintptr_t> class IMPL
+            = detail::ConcurrentHashmapImpl>
 ATH_REQUIRES (detail::IsConcurrentHashmapPayload<VALUE> &&
               detail::IsUpdater<UPDATER>)
 class ConcurrentStrMap
@@ -80,7 +88,7 @@ private:
   /// The underlying uint->uint hash table.
   struct Hasher;
   struct Matcher;
-  using Impl_t = typename detail::ConcurrentHashmapImpl<UPDATER, Hasher, Matcher>;
+  using Impl_t = IMPL<UPDATER, Hasher, Matcher, 0, 0>;
   /// Representation type in the underlying map.
   using val_t = CxxUtils::detail::ConcurrentHashmapVal_t;
 
@@ -0,0 +1,344 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CxxUtils/Root/ArrayCodec.cxx
+ * @date Oct, 2026
+ * @brief Transformations applied to an array of numbers before writing,
+ *        to make it compress better.
+ */
+
+
+#include "CxxUtils/ArrayCodec.h"
+#include "CxxUtils/FloatCompressor.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace {
+
+
+/// Size of the elements on which delta/shuffle work, 0 if unsupported.
+size_t eltSize (const std::type_info& ti)
+{
+  struct TypeSize { const std::type_info* ti; size_t size; };
+  static const TypeSize types[] = {
+    { &typeid(float), sizeof(float) },
+    { &typeid(double), sizeof(double) },
+    { &typeid(char), sizeof(char) },
+    { &typeid(signed char), sizeof(signed char) },
+    { &typeid(unsigned char), sizeof(unsigned char) },
+    { &typeid(short), sizeof(short) },
+    { &typeid(unsigned short), sizeof(unsigned short) },
+    { &typeid(int), sizeof(int) },
+    { &typeid(unsigned int), sizeof(unsigned int) },
+    { &typeid(long), sizeof(long) },
+    { &typeid(unsigned long), sizeof(unsigned long) },
+    { &typeid(long long), sizeof(long long) },
+    { &typeid(unsigned long long), sizeof(unsigned long long) },
+  };
+  for (const TypeSize& t : types) {
+    if (ti == *t.ti) return t.size;
+  }
+  return 0;
+}
+
+
+template <class U>
+inline U zigzag (U d)
+{
+  constexpr unsigned int topbit = sizeof(U)*8 - 1;
+  return static_cast<U> (static_cast<U>(d << 1) ^ static_cast<U>(U(0) - (d >> topbit)));
+}
+
+
+template <class U>
+inline U unzigzag (U z)
+{
+  return static_cast<U> ((z >> 1) ^ static_cast<U>(U(0) - (z & 1)));
+}
+
+
+template <class U>
+void deltaEncode (void* data, size_t n)
+{
+  unsigned char* p = static_cast<unsigned char*> (data);
+  if (n < 2) return;
+  U prev;
+  std::memcpy (&prev, p, sizeof(U));
+  for (size_t i = 1; i < n; i++) {
+    U x;
+    std::memcpy (&x, p + i*sizeof(U), sizeof(U));
+    U z = zigzag<U> (static_cast<U>(x - prev));
+    std::memcpy (p + i*sizeof(U), &z, sizeof(U));
+    prev = x;
+  }
+}
+
+
+template <class U>
+void deltaDecode (void* data, size_t n)
+{
+  unsigned char* p = static_cast<unsigned char*> (data);
+  if (n < 2) return;
+  U prev;
+  std::memcpy (&prev, p, sizeof(U));
+  for (size_t i = 1; i < n; i++) {
+    U z;
+    std::memcpy (&z, p + i*sizeof(U), sizeof(U));
+    prev = static_cast<U> (prev + unzigzag<U> (z));
+    std::memcpy (p + i*sizeof(U), &prev, sizeof(U));
+  }
+}
+
+
+void delta (bool encode, void* data, size_t n, size_t sz)
+{
+  switch (sz) {
+  case 1: encode ? deltaEncode<uint8_t>(data, n)  : deltaDecode<uint8_t>(data, n);  break;
+  case 2: encode ? deltaEncode<uint16_t>(data, n) : deltaDecode<uint16_t>(data, n); break;
+  case 4: encode ? deltaEncode<uint32_t>(data, n) : deltaDecode<uint32_t>(data, n); break;
+  case 8: encode ? deltaEncode<uint64_t>(data, n) : deltaDecode<uint64_t>(data, n); break;
+  default: break;
+  }
+}
+
+
+void shuffle (bool encode, void* data, size_t n, size_t sz)
+{
+  if (sz < 2 || n < 2) return;
+  unsigned char* p = static_cast<unsigned char*> (data);
+  std::vector<unsigned char> tmp (p, p + n*sz);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t b = 0; b < sz; b++) {
+      if (encode)
+        p[b*n + i] = tmp[i*sz + b];
+      else
+        p[i*sz + b] = tmp[b*n + i];
+    }
+  }
+}
+
+
+unsigned int parseUInt (const std::string& s, const std::string& spec)
+{
+  char* end = nullptr;
+  unsigned long val = std::strtoul (s.c_str(), &end, 10);
+  if (s.empty() || *end != '\0' || val > 64) {
+    throw std::invalid_argument ("ArrayCodec: bad number of bits '" + s + "' in '" + spec + "'");
+  }
+  return val;
+}
+
+
+float parseFloat (const std::string& s, const std::string& spec)
+{
+  char* end = nullptr;
+  float val = std::strtof (s.c_str(), &end);
+  if (s.empty() || *end != '\0' || !std::isfinite (val)) {
+    throw std::invalid_argument ("ArrayCodec: bad range limit '" + s + "' in '" + spec + "'");
+  }
+  return val;
+}
+
+
+} // anonymous namespace
+
+
+namespace CxxUtils {
+
+
+/**
+ * @brief Constructor from a codec specification.
+ * @param spec Comma-separated list of steps.
+ *
+ * Throws @c std::invalid_argument if @c spec is not valid.
+ */
+ArrayCodec::ArrayCodec (const std::string& spec)
+  : m_spec (spec)
+{
+  std::istringstream ss (spec);
+  std::string stepstr;
+  while (std::getline (ss, stepstr, ',')) {
+    std::vector<std::string> args;
+    std::istringstream ss2 (stepstr);
+    std::string arg;
+    while (std::getline (ss2, arg, ':')) {
+      args.push_back (arg);
+    }
+    if (args.empty()) {
+      throw std::invalid_argument ("ArrayCodec: empty step in '" + spec + "'");
+    }
+
+    StepInfo s;
+    const std::string& name = args[0];
+    if (name == "mantissa" && args.size() == 2) {
+      s.m_step = Step::Mantissa;
+      s.m_nbits = parseUInt (args[1], spec);
+      if (s.m_nbits < 5 || s.m_nbits > 23) {
+        throw std::invalid_argument ("ArrayCodec: mantissa bits must be in [5,23] in '" + spec + "'");
+      }
+    }
+    else if (name == "fixed" && args.size() == 4) {
+      s.m_step = Step::Fixed;
+      s.m_nbits = parseUInt (args[1], spec);
+      s.m_min = parseFloat (args[2], spec);
+      s.m_max = parseFloat (args[3], spec);
+      if (s.m_nbits < 1 || s.m_nbits > 32) {
+        throw std::invalid_argument ("ArrayCodec: fixed-point bits must be in [1,32] in '" + spec + "'");
+      }
+      if (!(s.m_min < s.m_max)) {
+        throw std::invalid_argument ("ArrayCodec: empty fixed-point range in '" + spec + "'");
+      }
+    }
+    else if (name == "delta" && args.size() == 1) {
+      s.m_step = Step::Delta;
+    }
+    else if (name == "shuffle" && args.size() == 1) {
+      s.m_step = Step::Shuffle;
+    }
+    else {
+      throw std::invalid_argument ("ArrayCodec: bad step '" + stepstr + "' in '" + spec + "'");
+    }
+
+    if ((s.m_step == Step::Mantissa || s.m_step == Step::Fixed) && !m_steps.empty()) {
+      throw std::invalid_argument ("ArrayCodec: '" + name + "' must be the first step in '" + spec + "'");
+    }
+    m_steps.push_back (s);
+  }
+}
+
+
+/// True if @c decode has something to do.
+bool ArrayCodec::needsDecode() const
+{
+  for (const StepInfo& s : m_steps) {
+    if (s.m_step != Step::Mantissa) return true;
+  }
+  return false;
+}
+
+
+/**
+ * @brief Test if this codec can be applied to elements of type @c ti.
+ */
+bool ArrayCodec::supports (const std::type_info& ti) const
+{
+  if (!m_steps.empty() &&
+      (m_steps[0].m_step == Step::Mantissa || m_steps[0].m_step == Step::Fixed))
+  {
+    return ti == typeid(float);
+  }
+  return eltSize (ti) > 0;
+}
+
+
+/**
+ * @brief Encode an array in place.
+ * @param ti Type of the elements.
+ * @param data Pointer to the first element.
+ * @param n Number of elements.
+ *
+ * Returns false, leaving the data unchanged, if the type is not supported.
+ */
+bool ArrayCodec::encode (const std::type_info& ti, void* data, size_t n) const
+{
+  if (!supports (ti)) return false;
+  const size_t sz = eltSize (ti);
+  for (const StepInfo& s : m_steps) {
+    switch (s.m_step) {
+    case Step::Mantissa:
+      {
+        const FloatCompressor fc (s.m_nbits);
+        float* fdata = static_cast<float*> (data);
+        for (size_t i = 0; i < n; i++) {
+          fdata[i] = fc.reduceFloatPrecision (fdata[i]);
+        }
+      }
+      break;
+    case Step::Fixed:
+      encodeFixed (s, static_cast<float*> (data), n);
+      break;
+    case Step::Delta:
+      delta (true, data, n, sz);
+      break;
+    case Step::Shuffle:
+      shuffle (true, data, n, sz);
+      break;
+    }
+  }
+  return true;
+}
+
+
+/**
+ * @brief Decode in place an array written with @c encode.
+ * @param ti Type of the elements.
+ * @param data Pointer to the first element.
+ * @param n Number of elements.
+ *
+ * Returns false, leaving the data unchanged, if the type is not supported.
+ */
+bool ArrayCodec::decode (const std::type_info& ti, void* data, size_t n) const
+{
+  if (!supports (ti)) return false;
+  const size_t sz = eltSize (ti);
+  for (auto it = m_steps.rbegin(); it != m_steps.rend(); ++it) {
+    switch (it->m_step) {
+    case Step::Mantissa:
+      break;
+    case Step::Fixed:
+      decodeFixed (*it, static_cast<float*> (data), n);
+      break;
+    case Step::Delta:
+      delta (false, data, n, sz);
+      break;
+    case Step::Shuffle:
+      shuffle (false, data, n, sz);
+      break;
+    }
+  }
+  return true;
+}
+
+
+/**
+ * @brief Replace floats by their fixed-point codes.
+ *
+ * The code is stored in the bits of the float, so that the array
+ * keeps its type.
+ */
+void ArrayCodec::encodeFixed (const StepInfo& s, float* data, size_t n) const
+{
+  const double maxcode = std::ldexp (1.0, s.m_nbits) - 1;
+  const double scale = maxcode / (double(s.m_max) - double(s.m_min));
+  for (size_t i = 0; i < n; i++) {
+    double x = (double(data[i]) - s.m_min) * scale;
+    if (!(x > 0)) x = 0;    // Also catches NaN.
+    if (x > maxcode) x = maxcode;
+    uint32_t code = static_cast<uint32_t> (std::lround (x));
+    std::memcpy (&data[i], &code, sizeof(code));
+  }
+}
+
+
+/**
+ * @brief Replace fixed-point codes by the floats they represent.
+ */
+void ArrayCodec::decodeFixed (const StepInfo& s, float* data, size_t n) const
+{
+  const double maxcode = std::ldexp (1.0, s.m_nbits) - 1;
+  const double step = (double(s.m_max) - double(s.m_min)) / maxcode;
+  for (size_t i = 0; i < n; i++) {
+    uint32_t code;
+    std::memcpy (&code, &data[i], sizeof(code));
+    data[i] = static_cast<float> (s.m_min + code * step);
+  }
+}
+
+
+} // namespace CxxUtils
@@ -0,0 +1,202 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CxxUtils/test/ArrayCodec_test.cxx
+ * @date Oct, 2026
+ * @brief Regression tests for ArrayCodec.
+ */
+
+#undef NDEBUG
+
+#include "CxxUtils/ArrayCodec.h"
+#include "CxxUtils/FloatCompressor.h"
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+
+using CxxUtils::ArrayCodec;
+
+
+bool badSpec (const std::string& spec)
+{
+  try {
+    ArrayCodec c (spec);
+  }
+  catch (const std::invalid_argument&) {
+    return true;
+  }
+  return false;
+}
+
+
+// Parsing.
+void test1()
+{
+  std::cout << "test1\n";
+
+  ArrayCodec c0;
+  assert (c0.empty());
+  assert (!c0.needsDecode());
+  assert (c0.supports (typeid(int)));
+
+  ArrayCodec c1 ("mantissa:10");
+  assert (!c1.empty());
+  assert (!c1.needsDecode());
+  assert (c1.spec() == "mantissa:10");
+  assert (c1.supports (typeid(float)));
+  assert (!c1.supports (typeid(double)));
+  assert (!c1.supports (typeid(int)));
+
+  ArrayCodec c2 ("fixed:16:-3.1416:3.1416,shuffle");
+  assert (c2.needsDecode());
+  assert (c2.supports (typeid(float)));
+  assert (!c2.supports (typeid(unsigned int)));
+
+  ArrayCodec c3 ("delta,shuffle");
+  assert (c3.supports (typeid(unsigned int)));
+  assert (c3.supports (typeid(double)));
+  assert (c3.supports (typeid(char)));
+  assert (!c3.supports (typeid(bool)));
+  assert (!c3.supports (typeid(std::string)));
+
+  assert (badSpec ("foo"));
+  assert (badSpec ("mantissa"));
+  assert (badSpec ("mantissa:3"));
+  assert (badSpec ("mantissa:10x"));
+  assert (badSpec ("fixed:16:1:1"));
+  assert (badSpec ("fixed:40:0:1"));
+  assert (badSpec ("fixed:16:0"));
+  assert (badSpec ("delta:1"));
+  assert (badSpec ("shuffle,mantissa:10"));
+  assert (badSpec ("mantissa:10,fixed:8:0:1"));
+  assert (badSpec ("delta,,shuffle"));
+}
+
+
+// Lossy float steps.
+void test2()
+{
+  std::cout << "test2\n";
+
+  std::vector<float> v { 1.2345, -3.1415, 0, 1e-10, 1e10,
+                         std::numeric_limits<float>::infinity() };
+  std::vector<float> v1 = v;
+  ArrayCodec c1 ("mantissa:7");
+  assert (c1.encode (typeid(float), v1.data(), v1.size()));
+  std::vector<float> v2 = v1;
+  assert (c1.decode (typeid(float), v2.data(), v2.size()));
+  assert (v2 == v1);
+  CxxUtils::FloatCompressor fc (7);
+  for (size_t i = 0; i < v.size(); i++) {
+    assert (v1[i] == fc.reduceFloatPrecision (v[i]));
+  }
+
+  std::vector<float> w { -4, -3.1416, -1, 0, 0.001, 2.5, 3.1416, 10,
+                         std::numeric_limits<float>::quiet_NaN() };
+  std::vector<float> w1 = w;
+  ArrayCodec c2 ("fixed:12:-3.1416:3.1416");
+  assert (c2.encode (typeid(float), w1.data(), w1.size()));
+  uint32_t code;
+  std::memcpy (&code, &w1[0], sizeof(code));
+  assert (code == 0);
+  std::memcpy (&code, &w1[6], sizeof(code));
+  assert (code == 4095);
+  std::memcpy (&code, &w1[8], sizeof(code));
+  assert (code == 0);
+  assert (c2.decode (typeid(float), w1.data(), w1.size()));
+  const float step = 2*3.1416 / 4095;
+  assert (w1[0] == -3.1416f);
+  assert (std::abs (w1[6] - 3.1416f) < 1e-6);
+  assert (std::abs (w1[7] - 3.1416f) < 1e-6);
+  assert (w1[8] == -3.1416f);
+  for (size_t i = 1; i < 7; i++) {
+    assert (std::abs (w1[i] - w[i]) <= step/2 + 1e-6);
+  }
+
+  // Encoding decoded values gives back the same codes.
+  std::vector<float> w2 = w1;
+  assert (c2.encode (typeid(float), w2.data(), w2.size()));
+  assert (c2.decode (typeid(float), w2.data(), w2.size()));
+  assert (w2 == w1);
+
+  std::vector<int> i1 { 1, 2, 3 };
+  assert (!c2.encode (typeid(int), i1.data(), i1.size()));
+  assert ((i1 == std::vector<int> { 1, 2, 3 }));
+}
+
+
+template <class T>
+void checkRoundTrip (const ArrayCodec& c, const std::vector<T>& v)
+{
+  std::vector<T> v1 = v;
+  assert (c.encode (typeid(T), v1.data(), v1.size()));
+  assert (c.decode (typeid(T), v1.data(), v1.size()));
+  assert (v1 == v);
+}
+
+
+// Lossless steps.
+void test3()
+{
+  std::cout << "test3\n";
+
+  ArrayCodec c1 ("delta");
+  std::vector<unsigned int> u { 100, 101, 103, 103, 110, 2, 0xffffffff, 0 };
+  std::vector<unsigned int> u1 = u;
+  assert (c1.encode (typeid(unsigned int), u1.data(), u1.size()));
+  assert (u1[0] == 100);
+  assert (u1[1] == 2);
+  assert (u1[2] == 4);
+  assert (u1[3] == 0);
+  assert (u1[5] == 2*108-1);
+  checkRoundTrip (c1, u);
+  checkRoundTrip (c1, std::vector<int> { -5, 3, std::numeric_limits<int>::min(),
+                                          std::numeric_limits<int>::max(), 0 });
+  checkRoundTrip (c1, std::vector<char> { 'a', 'b', 'z', 0 });
+  checkRoundTrip (c1, std::vector<short> { 1, -1, 32767, -32768 });
+  checkRoundTrip (c1, std::vector<unsigned long long> { 1, 0xffffffffffffffff, 7 });
+  checkRoundTrip (c1, std::vector<float> { 1.5, -2.5, 1e30 });
+  checkRoundTrip (c1, std::vector<int> {});
+  checkRoundTrip (c1, std::vector<int> { 42 });
+
+  ArrayCodec c2 ("shuffle");
+  std::vector<unsigned short> s { 0x0102, 0x0304, 0x0506 };
+  std::vector<unsigned short> s1 = s;
+  assert (c2.encode (typeid(unsigned short), s1.data(), s1.size()));
+  const unsigned char* p = reinterpret_cast<const unsigned char*> (s1.data());
+  const unsigned char* p0 = reinterpret_cast<const unsigned char*> (s.data());
+  assert (p[0] == p0[0] && p[1] == p0[2] && p[2] == p0[4]);
+  assert (p[3] == p0[1] && p[4] == p0[3] && p[5] == p0[5]);
+  checkRoundTrip (c2, s);
+  checkRoundTrip (c2, std::vector<double> { 1.5, -2.5, 1e300, 0 });
+  checkRoundTrip (c2, std::vector<long> { 1, -1, 3 });
+
+  ArrayCodec c3 ("delta,shuffle");
+  checkRoundTrip (c3, std::vector<unsigned int> { 10, 20, 30, 40, 1000000 });
+
+  std::vector<float> f { -1, -0.5, 0.25, 0.75, 1 };
+  std::vector<float> f1 = f;
+  ArrayCodec c4 ("fixed:8:-1:1,delta,shuffle");
+  assert (c4.encode (typeid(float), f1.data(), f1.size()));
+  assert (c4.decode (typeid(float), f1.data(), f1.size()));
+  for (size_t i = 0; i < f.size(); i++) {
+    assert (std::abs (f1[i] - f[i]) <= 1./255 + 1e-6);
+  }
+}
+
+
+int main()
+{
+  std::cout << "ArrayCodec_test\n";
+  test1();
+  test2();
+  test3();
+  return 0;
+}
@@ -0,0 +1,897 @@
+/*
+ * Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration.
+ */
+/**
+ * @file CxxUtils/test/ConcurrentGroupHashmapImpl_test.cxx
+ * @date Oct, 2026
+ * @brief Tests for ConcurrentGroupHashmapImpl.
+ *
+ * Run with --perf to compare lookup timings against ConcurrentHashmapImpl.
+ */
+
+
+#undef NDEBUG
+#include "CxxUtils/ConcurrentGroupHashmapImpl.h"
+#include "CxxUtils/ConcurrentHashmapImpl.h"
+#include "TestTools/random.h"
+#ifndef NO_PERF
+# include "boost/timer/timer.hpp"
+#endif
+#include <mutex>
+#include <thread>
+#include <shared_mutex>
+#include <vector>
+#include <string>
+#include <memory>
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+#include <unistd.h>
+
+
+const int nslots = 4;
+
+
+// Needed to access internals of ConcurrentGroupHashmapImpl.
+class ConcurrentGroupHashmapImplTest
+{
+public:
+  static void test2();
+};
+
+
+struct Context_t
+{
+  Context_t (int the_slot = 0) : slot (the_slot) {}
+  int slot;
+};
+
+
+template <class T>
+class TestUpdater
+{
+public:
+  using Context_t = ::Context_t;
+
+  TestUpdater()
+    : m_p (nullptr),
+      m_inGrace (0)
+  {
+  }
+
+  TestUpdater (TestUpdater&& other)
+    : m_p (static_cast<T*> (other.m_p)),
+      m_inGrace (0)
+  {
+  }
+
+  TestUpdater& operator= (const TestUpdater&) = delete; // coverity
+
+  ~TestUpdater()
+  {
+    delete m_p;
+    for (T* p : m_garbage) delete p;
+  }
+
+  void update (std::unique_ptr<T> p, const Context_t& ctx)
+  {
+    std::lock_guard<std::mutex> g (m_mutex);
+    if (m_p) m_garbage.push_back (m_p);
+    m_p = p.release();
+    m_inGrace = (~(1<<ctx.slot)) & ((1<<nslots)-1);
+  }
+
+  void discard (std::unique_ptr<T> p)
+  {
+    std::lock_guard<std::mutex> g (m_mutex);
+    m_garbage.push_back (p.release());
+    m_inGrace = ((1<<nslots)-1);
+  }
+
+  const T& get() const { return *m_p; }
+
+  void quiescent (const Context_t& ctx)
+  {
+    unsigned int mask = (1<<ctx.slot);
+    std::lock_guard<std::mutex> g (m_mutex);
+    if ((m_inGrace & mask) == 0) return;
+    m_inGrace &= ~mask;
+    if (!m_inGrace) {
+      for (T* p : m_garbage) delete p;
+      m_garbage.clear();
+    }
+  }
+
+  static Context_t defaultContext() { return 0; }
+
+  void swap (TestUpdater& other)
+  {
+    auto swap_atomic = [] (std::atomic<T*>& a, std::atomic<T*>& b)
+    {
+      T* tmp = a.load (std::memory_order_relaxed);
+      a.store (b.load (std::memory_order_relaxed),
+               std::memory_order_relaxed);
+      b.store (tmp, std::memory_order_relaxed);
+    };
+
+    swap_atomic (m_p, other.m_p);
+    m_garbage.swap (other.m_garbage);
+    std::swap (m_inGrace, other.m_inGrace);
+  }
+
+
+  unsigned int inGrace() const { return m_inGrace; }
+
+
+private:
+  std::mutex m_mutex;
+  std::atomic<T*> m_p;
+  std::vector<T*> m_garbage;
+  unsigned int m_inGrace;
+};
+
+
+struct TestHash
+{
+  size_t operator() (size_t x) const { return x; }
+};
+
+
+using CHMImpl = CxxUtils::detail::ConcurrentGroupHashmapImpl<TestUpdater, TestHash>;
+
+
+// Test CHMGroup and CHMGroupIterator.
+void test1()
+{
+  std::cout << "test1\n";
+  using CxxUtils::detail::CHMGroup;
+  using CxxUtils::detail::CHMGroupIterator;
+
+  alignas(CHMGroup::GROUP_SIZE) CHMGroup::ctrl_t ctrl[CHMGroup::GROUP_SIZE];
+  for (size_t i = 0; i < CHMGroup::GROUP_SIZE; i++) {
+    ctrl[i] = CHMGroup::EMPTY;
+  }
+  ctrl[1] = 0x23;
+  ctrl[4] = 0x11;
+  ctrl[9] = 0x23;
+  ctrl[15] = CHMGroup::DELETED;
+
+  {
+    CHMGroup g (ctrl);
+    assert (g.match (0x23) == ((1u<<1) | (1u<<9)));
+    assert (g.match (0x11) == (1u<<4));
+    assert (g.match (0x12) == 0);
+    assert (g.match (CHMGroup::DELETED) == (1u<<15));
+    assert (g.matchEmpty() == (0xffffu & ~((1u<<1) | (1u<<4) | (1u<<9) | (1u<<15))));
+  }
+
+  // 8 groups.
+  CHMGroupIterator it (5, 7, 8);
+  std::vector<size_t> groups;
+  do {
+    groups.push_back (it.group());
+  } while (it.next());
+  assert ((std::vector<size_t> {5, 6, 0, 3, 7, 4, 2, 1}) == groups);
+}
+
+
+// Test ConcurrentGroupHashmapImpl::Table.
+void ConcurrentGroupHashmapImplTest::test2()
+{
+  std::cout << "test2\n";
+  using entry_t = CHMImpl::entry_t;
+  using Table = CHMImpl::Table;
+  using CxxUtils::detail::CHMGroup;
+  std::unique_ptr<Table> table (new (64) Table (64));
+
+  assert (table->capacity() == 64);
+  for (size_t i = 0; i < 64; i++) {
+    assert (table->ctrl (i) == CHMGroup::EMPTY);
+  }
+
+  size_t nstored = 0;
+  while (true) {
+    size_t key = 23*nstored + 100;
+    size_t hash = TestHash() (key);
+
+    bool insert;
+    size_t offset = table->probeWrite (key, hash, insert);
+    if (offset == CHMImpl::INVALID) {
+      break;
+    }
+    assert (insert);
+    table->set (offset, key, hash, key+1);
+    const Table* ctable = table.get();
+    const entry_t& cent = ctable->entry (offset);
+    assert (cent.m_val == key+1);
+    assert (cent.m_key == key);
+    uint8_t h2;
+    table->splitHash (hash, h2);
+    assert (h2 < 0x80);
+    assert (table->ctrl (offset) == h2);
+    ++nstored;
+  }
+  assert (nstored == 64);
+
+  for (size_t i = 0; i < nstored; ++i) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    {
+      size_t offset = table->probeRead (key, hash);
+      assert (offset != CHMImpl::INVALID);
+      const entry_t& ent = table->entry (offset);
+      assert (ent.m_key == key && ent.m_val == key+1);
+    }
+    {
+      bool insert;
+      size_t offset = table->probeWrite (key, hash, insert);
+      assert (offset != CHMImpl::INVALID);
+      assert (!insert);
+      entry_t& ent = table->entry (offset);
+      assert (ent.m_key == key && ent.m_val == key+1);
+    }
+  }
+
+  size_t key = 23*nstored + 100;
+  size_t hash = TestHash() (key);
+  assert (table->probeRead (key, hash) == CHMImpl::INVALID);
+  bool insert;
+  assert (table->probeWrite (key, hash, insert) == CHMImpl::INVALID);
+
+  table->forceClear();
+  for (size_t i = 0; i < 64; i++) {
+    assert (table->ctrl (i) == CHMGroup::EMPTY);
+  }
+  key = 100;
+  hash = TestHash() (key);
+  assert (table->probeRead (key, hash) == CHMImpl::INVALID);
+}
+
+
+void test3()
+{
+  std::cout << "test3\n";
+  CHMImpl chm (CHMImpl::Updater_t(), 50,
+               CHMImpl::Hasher_t(),
+               CHMImpl::Matcher_t(),
+               CHMImpl::Context_t());
+
+  assert (chm.size() == 0);
+  assert (chm.capacity() == 64);
+
+  assert (chm.hasher()(12345) == CHMImpl::Hasher_t()(12345));
+  assert (chm.matcher() (4321, 4321));
+  assert (!chm.matcher() (4321, 4322));
+
+  assert (chm.updater().inGrace() == 0x0e);
+
+  {
+    auto [begin, end] = chm.range();
+    assert (!(begin != end));
+  }
+
+  for (size_t i = 0; i < 1000; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+
+    auto [it, flag] = chm.put (key, hash, key+1, true, Context_t());
+    assert (flag);
+    assert (it.valid());
+    assert (it.key() == key);
+    assert (it.value() == key+1);
+  }
+  assert (chm.size() == 1000);
+  // Grown past 7/8 occupancy of 1024.
+  assert (chm.capacity() == 2048);
+
+  for (size_t i = 0; i < 1000; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+
+    CHMImpl::const_iterator it = chm.get (key, hash);
+    assert (it.valid());
+    assert (it.value() == key+1);
+  }
+
+  {
+    CHMImpl::Lock_t lock = chm.lock();
+    for (size_t i = 0; i < 1000; i++) {
+      size_t key = 23*i + 100;
+      size_t hash = TestHash() (key);
+
+      auto [it, flag] = chm.put (lock, key, hash, key+2, true, Context_t());
+      assert (!flag);
+      assert (it.valid());
+      assert (it.key() == key);
+      assert (it.value() == key+2);
+    }
+  }
+  assert (chm.size() == 1000);
+  assert (chm.capacity() == 2048);
+
+  std::vector<size_t> exp;
+  for (size_t i = 0; i < 1000; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+
+    CHMImpl::const_iterator it = chm.get (key, hash);
+    assert (it.valid());
+    assert (it.value() == key+2);
+
+    exp.push_back (key);
+  }
+  std::sort (exp.begin(), exp.end());
+
+  for (size_t i = 1000; i < 2000; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    assert (!chm.get (key, hash).valid());
+  }
+
+  std::vector<size_t> seen;
+  {
+    auto [begin, end] = chm.range();
+    for (auto it = begin; it != end; it.next()) {
+      assert (it.key()+2 == it.value());
+      seen.push_back (it.key());
+    }
+  }
+  std::sort (seen.begin(), seen.end());
+  assert (exp == seen);
+
+  seen.clear();
+  {
+    CHMImpl::const_iterator begin = chm.begin();
+    CHMImpl::const_iterator it = chm.end();
+    assert (it != begin);
+    do {
+      it.prev();
+      assert (it.key()+2 == it.value());
+      seen.push_back (it.key());
+    } while (it != begin);
+  }
+
+  std::sort (seen.begin(), seen.end());
+  assert (exp == seen);
+
+  {
+    size_t key = 23*500 + 100;
+    size_t hash = TestHash() (key);
+    auto [it, flag] = chm.put (key, hash, 200, false, Context_t());
+    assert (!flag);
+    assert (it.valid());
+    assert (it.key() == key);
+    assert (it.value() == key+2);
+
+    CHMImpl::const_iterator it2 = chm.get (key, hash);
+    assert (it2.valid());
+    assert (it2.value() == key+2);
+  }
+
+  {
+    size_t key = 23*1500 + 100;
+    size_t hash = TestHash() (key);
+    auto [it, flag] = chm.put (key, hash, 200, false, Context_t());
+    assert (flag);
+    assert (it.valid());
+    assert (it.key() == key);
+    assert (it.value() == 200);
+
+    CHMImpl::const_iterator it2 = chm.get (key, hash);
+    assert (it2.valid());
+    assert (it2.value() == 200);
+  }
+
+  assert (chm.size() == 1001);
+  assert (chm.capacity() == 2048);
+
+  {
+    size_t iseen = 0;
+    CHMImpl::const_iterator it = chm.clear (Context_t());
+    while (it.valid()) {
+      ++iseen;
+      it.next();
+    }
+    assert (iseen == 1001);
+  }
+  assert (chm.size() == 0);
+  assert (chm.capacity() == 2048);
+
+  chm.clear (200, Context_t());
+  assert (chm.size() == 0);
+  assert (chm.capacity() == 256);
+
+  chm.reserve (100, Context_t());
+  assert (chm.size() == 0);
+  assert (chm.capacity() == 256);
+
+  chm.reserve (300, Context_t());
+  assert (chm.size() == 0);
+  assert (chm.capacity() == 512);
+}
+
+
+void test_erase()
+{
+  std::cout << "test_erase\n";
+
+  using CHMImplDel = CxxUtils::detail::ConcurrentGroupHashmapImpl<TestUpdater,
+    TestHash,
+    std::equal_to<uintptr_t>,
+    0, static_cast<uintptr_t>(-1)>;
+
+  CHMImplDel chm (CHMImplDel::Updater_t(), 50,
+                  CHMImplDel::Hasher_t(),
+                  CHMImplDel::Matcher_t(),
+                  CHMImplDel::Context_t());
+
+  for (size_t i = 0; i < 1000; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+
+    auto [it, flag] = chm.put (key, hash, key+1, true, Context_t());
+    assert (flag);
+    assert (it.valid());
+    assert (it.key() == key);
+    assert (it.value() == key+1);
+  }
+  assert (chm.size() == 1000);
+  assert (chm.capacity() == 2048);
+  assert (chm.erased() == 0);
+
+  for (size_t i = 0; i < 1000; i+=2) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    assert (chm.erase (key, hash));
+  }
+  assert (chm.size() == 500);
+  assert (chm.capacity() == 2048);
+  assert (chm.erased() == 500);
+
+  for (size_t i = 0; i < 1000; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    CHMImplDel::const_iterator it2 = chm.get (key, hash);
+    if (i%2 == 0) {
+      assert (!it2.valid());
+      assert (!chm.erase (key, hash));
+    }
+    else {
+      assert (it2.valid());
+      assert (it2.key() == key);
+      assert (it2.value() == key+1);
+    }
+  }
+
+  // Fill until the erased entries force a rebuild of the table.
+  for (size_t i = 1000; i < 1800; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    auto [it, flag] = chm.put (key, hash, key+1, true, Context_t());
+    assert (flag);
+    assert (it.valid());
+  }
+  assert (chm.size() == 1300);
+  assert (chm.capacity() == 4096);
+  assert (chm.erased() == 0);
+
+  for (size_t i = 0; i < 1800; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    CHMImplDel::const_iterator it2 = chm.get (key, hash);
+    if (i < 1000 && i%2 == 0) {
+      assert (!it2.valid());
+    }
+    else {
+      assert (it2.valid());
+      assert (it2.key() == key);
+      assert (it2.value() == key+1);
+    }
+  }
+
+  chm.forceClear();
+  assert (chm.size() == 0);
+  assert (chm.capacity() == 4096);
+  assert (chm.erased() == 0);
+  for (size_t i = 0; i < 1800; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    CHMImplDel::const_iterator it2 = chm.get (key, hash);
+    assert (!it2.valid());
+  }
+}
+
+
+void test_swap()
+{
+  std::cout << "test_swap\n";
+
+  using CHMImplDel = CxxUtils::detail::ConcurrentGroupHashmapImpl<TestUpdater,
+    TestHash,
+    std::equal_to<uintptr_t>,
+    0, static_cast<uintptr_t>(-1)>;
+
+  CHMImplDel chm1 (CHMImplDel::Updater_t(), 50,
+                   CHMImplDel::Hasher_t(),
+                   CHMImplDel::Matcher_t(),
+                   CHMImplDel::Context_t());
+  CHMImplDel chm2 (CHMImplDel::Updater_t(), 50,
+                   CHMImplDel::Hasher_t(),
+                   CHMImplDel::Matcher_t(),
+                   CHMImplDel::Context_t());
+
+  for (size_t i = 0; i < 800; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    auto [it, flag] = chm1.put (key, hash, key+1, true, Context_t());
+    assert (flag);
+  }
+  for (size_t i = 0; i < 800; i++) {
+    size_t key = 47*i + 100;
+    size_t hash = TestHash() (key);
+    auto [it, flag] = chm2.put (key, hash, key+1, true, Context_t());
+    assert (flag);
+  }
+  {
+    auto lock = chm2.lock();
+    for (size_t i = 0; i < 800; i+=2) {
+      size_t key = 47*i + 100;
+      size_t hash = TestHash() (key);
+      assert (chm2.erase (lock, key, hash));
+    }
+  }
+
+  assert (chm1.size() == 800);
+  assert (chm1.capacity() == 1024);
+  assert (chm1.erased() == 0);
+  assert (chm2.size() == 400);
+  assert (chm2.capacity() == 1024);
+  assert (chm2.erased() == 400);
+
+  chm1.swap (chm2);
+
+  assert (chm1.size() == 400);
+  assert (chm1.capacity() == 1024);
+  assert (chm1.erased() == 400);
+  assert (chm2.size() == 800);
+  assert (chm2.capacity() == 1024);
+  assert (chm2.erased() == 0);
+
+  for (size_t i = 0; i < 800; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    CHMImplDel::const_iterator it = chm2.get (key, hash);
+    assert (it.valid());
+    assert (it.value() == key+1);
+  }
+
+  for (size_t i = 0; i < 800; i++) {
+    size_t key = 47*i + 100;
+    size_t hash = TestHash() (key);
+    CHMImplDel::const_iterator it = chm1.get (key, hash);
+    if ((i%2) == 0) {
+      assert (!it.valid());
+    }
+    else {
+      assert (it.valid());
+      assert (it.value() == key+1);
+    }
+  }
+}
+
+
+//***************************************************************************
+// Threaded test.
+//
+
+
+std::shared_timed_mutex start_mutex;
+
+
+class test4_Base
+{
+public:
+  static constexpr size_t nwrites = 10000;
+
+  test4_Base (int slot);
+  int ctx() const { return m_slot; }
+
+
+private:
+  int m_slot;
+};
+
+
+test4_Base::test4_Base (int slot)
+  : m_slot (slot)
+{
+}
+
+
+class test4_Writer
+  : public test4_Base
+{
+public:
+  test4_Writer (int slot, CHMImpl& map);
+  void operator()();
+
+private:
+  CHMImpl& m_map;
+};
+
+
+test4_Writer::test4_Writer (int slot, CHMImpl& map)
+  : test4_Base (slot),
+    m_map (map)
+{
+}
+
+
+void test4_Writer::operator()()
+{
+  std::shared_lock<std::shared_timed_mutex> lock (start_mutex);
+
+  for (size_t i=0; i < nwrites; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    assert (m_map.put (key, hash, key+2, true, Context_t()).second);
+    m_map.quiescent (ctx());
+    if (((i+1)%128) == 0) {
+      usleep (1000);
+    }
+  }
+
+  for (size_t i=0; i < nwrites; i++) {
+    size_t key = 23*i + 100;
+    size_t hash = TestHash() (key);
+    assert (!m_map.put (key, hash, key+3, true, Context_t()).second);
+    m_map.quiescent (ctx());
+    if (((i+1)%128) == 0) {
+      usleep (1000);
+    }
+  }
+
+  {
+    size_t key = 23*nwrites + 100;
+    size_t hash = TestHash() (key);
+    assert (m_map.put (key, hash, key+3, true, Context_t()).second);
+  }
+}
+
+
+class test4_Iterator
+  : public test4_Base
+{
+public:
+  test4_Iterator (int slot, CHMImpl& map);
+  void operator()();
+
+private:
+  CHMImpl& m_map;
+};
+
+
+test4_Iterator::test4_Iterator (int slot, CHMImpl& map)
+  : test4_Base (slot),
+    m_map (map)
+{
+}
+
+
+void test4_Iterator::operator()()
+{
+  std::shared_lock<std::shared_timed_mutex> lock (start_mutex);
+
+  while (true) {
+    auto [begin, end] = m_map.range();
+    while (begin != end) {
+      size_t key = begin.key();
+      size_t val = begin.value();
+      assert (val == key+2 || val == key+3);
+      begin.next();
+    }
+
+    m_map.quiescent (ctx());
+    if (m_map.size() > nwrites) break;
+  }
+}
+
+
+class test4_Reader
+  : public test4_Base
+{
+public:
+  test4_Reader (int slot, CHMImpl& map);
+  void operator()();
+
+private:
+  CHMImpl& m_map;
+};
+
+
+test4_Reader::test4_Reader (int slot, CHMImpl& map)
+  : test4_Base (slot),
+    m_map (map)
+{
+}
+
+
+void test4_Reader::operator()()
+{
+  std::shared_lock<std::shared_timed_mutex> lock (start_mutex);
+
+  while (true) {
+    for (size_t i = 0; ; ++i) {
+      size_t key = 23*i + 100;
+      size_t hash = TestHash() (key);
+      CHMImpl::const_iterator it = m_map.get (key, hash);
+      if (!it.valid()) {
+        break;
+      }
+      assert(it.value() == key+2 || it.value() == key+3);
+    }
+
+    m_map.quiescent (ctx());
+    if (m_map.size() > nwrites) break;
+  }
+}
+
+
+void test4_iter()
+{
+  CHMImpl chm (CHMImpl::Updater_t(), 50,
+               CHMImpl::Hasher_t(),
+               CHMImpl::Matcher_t(),
+               CHMImpl::Context_t());
+
+  const int nthread = 4;
+  std::thread threads[nthread];
+  start_mutex.lock();
+
+  threads[0] = std::thread (test4_Writer (0, chm));
+  threads[1] = std::thread (test4_Iterator (1, chm));
+  threads[2] = std::thread (test4_Reader (2, chm));
+  threads[3] = std::thread (test4_Reader (3, chm));
+
+  // Try to get the threads starting as much at the same time as possible.
+  start_mutex.unlock();
+  for (int i=0; i < nthread; i++)
+    threads[i].join();
+}
+
+
+void test4()
+{
+  std::cout << "test4\n";
+
+  for (int i=0; i < 5; i++) {
+    test4_iter();
+  }
+}
+
+
+#ifndef NO_PERF
+//***************************************************************************
+// Optional performance test.
+// Compares lookups in ConcurrentGroupHashmapImpl and ConcurrentHashmapImpl,
+// both for integer keys and for string keys (where the matcher is
+// comparatively expensive).
+//
+
+
+struct StrHash
+{
+  size_t operator() (uintptr_t p) const
+  { return std::hash<std::string>() (*reinterpret_cast<const std::string*>(p)); }
+};
+
+
+struct StrMatch
+{
+  bool operator() (uintptr_t a, uintptr_t b) const
+  { return *reinterpret_cast<const std::string*>(a) ==
+      *reinterpret_cast<const std::string*>(b); }
+};
+
+
+template <class IMPL>
+class PerfTester
+{
+public:
+  static constexpr size_t NENT = 4096;
+  static constexpr size_t NLOOKUP = 20000000;
+
+  PerfTester();
+  void run (const std::string& name);
+
+
+private:
+  std::vector<std::string> m_strs;
+  std::vector<std::string> m_lookupStrs;
+  typename IMPL::Hasher_t m_hasher;
+  IMPL m_chm;
+};
+
+
+template <class IMPL>
+PerfTester<IMPL>::PerfTester()
+  : m_chm (typename IMPL::Updater_t(), 64,
+           typename IMPL::Hasher_t(),
+           typename IMPL::Matcher_t(),
+           Context_t())
+{
+  m_strs.reserve (NENT);
+  m_lookupStrs.reserve (NENT);
+  for (size_t i = 0; i < NENT; i++) {
+    m_strs.push_back ("StoreGateSvc+SomeContainerKey" + std::to_string (i));
+    m_lookupStrs.push_back (m_strs.back());
+  }
+  for (size_t i = 0; i < NENT; i++) {
+    uintptr_t key = reinterpret_cast<uintptr_t> (&m_strs[i]);
+    m_chm.put (key, m_hasher (key), i+1, true, Context_t());
+  }
+}
+
+
+template <class IMPL>
+void PerfTester<IMPL>::run (const std::string& name)
+{
+  uint32_t seed = 1235;
+  size_t sum = 0;
+  boost::timer::cpu_timer timer;
+  for (size_t i = 0; i < NLOOKUP; i++) {
+    size_t ient = Athena_test::rng_seed (seed) % NENT;
+    uintptr_t key = reinterpret_cast<uintptr_t> (&m_lookupStrs[ient]);
+    auto it = m_chm.get (key, m_hasher (key));
+    sum += it.value();
+  }
+  timer.stop();
+  std::cout << name << " hit:  " << timer.format(3);
+  assert (sum > 0);
+
+  std::string miss = "StoreGateSvc+NotThere";
+  uintptr_t mkey = reinterpret_cast<uintptr_t> (&miss);
+  size_t mhash = m_hasher (mkey);
+  timer.start();
+  for (size_t i = 0; i < NLOOKUP; i++) {
+    mhash = mhash * 6364136223846793005ull + 1442695040888963407ull;
+    sum += m_chm.get (mkey, mhash).valid();
+  }
+  timer.stop();
+  std::cout << name << " miss: " << timer.format(3);
+}
+
+
+void perftest()
+{
+  using OldImpl = CxxUtils::detail::ConcurrentHashmapImpl<TestUpdater,
+                                                          StrHash, StrMatch>;
+  using NewImpl = CxxUtils::detail::ConcurrentGroupHashmapImpl<TestUpdater,
+                                                               StrHash, StrMatch>;
+  PerfTester<OldImpl>().run ("ConcurrentHashmapImpl");
+  PerfTester<NewImpl>().run ("ConcurrentGroupHashmapImpl");
+}
+#endif // not NO_PERF
+
+
+int main (int argc, char** argv)
+{
+  if (argc >= 2 && strcmp (argv[1], "--perf") == 0) {
+#ifdef NO_PERF
+    std::cout << " Performance tests disabled\n";
+#else
+    perftest();
+#endif
+    return 0;
+  }
+
+  std::cout << "CxxUtils/ConcurrentGroupHashmapImpl_test\n";
+  test1();
+  ConcurrentGroupHashmapImplTest::test2();
+  test3();
+  test_erase();
+  test_swap();
+  test4();
+  return 0;
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 /**
  * @file  CxxUtils/test/ConcurrentRangeMap_test.cxx
@@ -12,6 +12,7 @@
 #undef NDEBUG
 #include "CxxUtils/ConcurrentRangeMap.h"
 #include "TestTools/random.h"
+#include "boost/timer/timer.hpp"
 #include <mutex>
 #include <thread>
 #include <shared_mutex>
@@ -19,6 +20,7 @@
 #include <cassert>
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
 #include <sstream>
 
 
@@ -943,6 +945,76 @@ void test1e()
 }
 
 
+// Test find with a FindCache.
+void test1f()
+{
+  std::cout << "test1f\n";
+  Payload::Hist phist;
+  TestMap map (TestMap::Updater_t(), std::make_shared<PayloadDeleter>(), 20);
+  TestMap::FindCache cache;
+
+  assert (map.find (15, cache) == nullptr);
+
+  size_t gen = map.generation();
+  for (int i = 1; i <= 10; i++) {
+    assert (map.emplace (Range (i*10, i*10+10), std::make_unique<Payload> (i, &phist)) ==
+            TestMap::EmplaceResult::SUCCESS);
+    assert (map.generation() > gen);
+    gen = map.generation();
+  }
+
+  // Same results as without the cache.
+  for (Time t : {5, 15, 17, 19, 20, 55, 59, 35, 105, 115, 15, 9}) {
+    assert (map.find (t, cache) == map.find (t));
+  }
+
+  // Repeated lookups in the same element.
+  TestMap::const_iterator it = map.find (42, cache);
+  assert (it->second->m_x == 4);
+  assert (map.find (47, cache) == it);
+  assert (map.find (49, cache) == it);
+  assert (map.find (50, cache)->second->m_x == 5);
+  assert (map.generation() == gen);
+
+  // Erase from the front.
+  map.erase (15);
+  assert (map.generation() > gen);
+  gen = map.generation();
+  assert (map.find (47, cache)->second->m_x == 4);
+  assert (map.find (15, cache) == nullptr);
+
+  // Trim.
+  std::vector<TestMap::key_query_type> keys {55};
+  assert (map.trim (keys) == 3);
+  assert (map.generation() > gen);
+  gen = map.generation();
+  assert (map.find (47, cache) == nullptr);
+  assert (map.find (55, cache)->second->m_x == 5);
+
+  // Erase from the middle, which makes a new copy.
+  assert (map.find (65, cache)->second->m_x == 6);
+  map.erase (75);
+  assert (map.generation() > gen);
+  gen = map.generation();
+  assert (map.find (75, cache)->second->m_x == 6);
+  assert (map.find (85, cache)->second->m_x == 8);
+
+  // Extend the last range.
+  assert (map.extendLastRange (Range (100, 200)) == 1);
+  assert (map.generation() > gen);
+  assert (map.find (85, cache)->second->m_x == 8);
+  assert (map.find (150, cache)->second->m_x == 10);
+
+  map.clear();
+  assert (map.find (85, cache) == nullptr);
+
+  for (int i=0; i < nslots; i++) {
+    map.quiescent (i);
+  }
+  assert (phist.empty());
+}
+
+
 //***************************************************************************
 // Threaded test.
 //
@@ -1090,9 +1162,15 @@ public:
 private:
   TestMap& m_map;
   uint32_t m_seed;
+
+  /// Shared between the readers.
+  static TestMap::FindCache s_cache;
 };
 
 
+TestMap::FindCache test2_Reader::s_cache;
+
+
 test2_Reader::test2_Reader (int slot, TestMap& map)
   : test2_Base (slot),
     m_map (map),
@@ -1119,6 +1197,18 @@ void test2_Reader::operator()()
               key < static_cast<int> (it->first.m_end));
       assert (static_cast<int>(it->first.m_begin) == it->second->m_x*10);
     }
+
+    // Same with the cache, using a nearby key to test cache hits.
+    for (int k : {key, key+1}) {
+      it = m_map.find (k, s_cache);
+      if (!it) {
+        assert (k < static_cast<int> (m_map.range().begin()->first.m_begin));
+      }
+      else {
+        assert (k >= static_cast<int> (it->first.m_begin));
+        assert (static_cast<int>(it->first.m_begin) == it->second->m_x*10);
+      }
+    }
     
     if ((r.end()-1)->second->m_x == nwrites-1) break;
 
@@ -1157,13 +1247,61 @@ void test2()
 }
 
 
-int main()
+//***************************************************************************
+// Optional performance test: lookups with and without a FindCache.
+//
+
+
+// As for a conditions container: a few ranges, with most lookups
+// in a range before the last one (e.g. when the next IOV has been
+// loaded already), and many lookups in a row in the same range.
+void perftest()
+{
+  const int nranges = 64;
+  const int nlookups = 100000000;
+  TestMap map (TestMap::Updater_t(), std::make_shared<PayloadDeleter>(), nranges);
+  for (int i = 0; i < nranges; i++) {
+    map.emplace (Range (i*100, (i+1)*100), std::make_unique<Payload> (i));
+  }
+
+  uint32_t seed = 1235;
+  std::vector<Time> keys;
+  for (int i = 0; i < 1024; i++) {
+    keys.push_back (Athena_test::randi_seed (seed, (nranges-1)*100));
+  }
+  std::sort (keys.begin(), keys.end());
+
+  long sum = 0;
+  {
+    boost::timer::auto_cpu_timer timer (3, "find:        %w s\n");
+    for (int i = 0; i < nlookups; i++) {
+      sum += map.find (keys[(i/1024) % keys.size()])->second->m_x;
+    }
+  }
+  {
+    TestMap::FindCache cache;
+    boost::timer::auto_cpu_timer timer (3, "find+cache:  %w s\n");
+    for (int i = 0; i < nlookups; i++) {
+      sum -= map.find (keys[(i/1024) % keys.size()], cache)->second->m_x;
+    }
+  }
+  assert (sum == 0);
+}
+
+
+int main (int argc, char** argv)
 {
+  if (argc >= 2 && strcmp (argv[1], "--perf") == 0) {
+    perftest();
+    return 0;
+  }
+
   test1a();
   test1b();
   test1c();
   test1d();
   test1e();
+  test1f();
   test2();
   return 0;
 }
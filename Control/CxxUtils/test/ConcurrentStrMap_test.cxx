@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration.
+ * Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration.
  */
 /**
  * @file CxxUtils/test/ConcurrentStrMap_test.cxx
@@ -213,6 +213,20 @@ using TestMapp = CxxUtils::ConcurrentStrMap<int*, TestUpdater>;
 using TestMapi = CxxUtils::ConcurrentStrMap<int, TestUpdater>;
 using TestMapf = CxxUtils::ConcurrentStrMap<float, TestUpdater>;
 using TestMapd = CxxUtils::ConcurrentStrMap<double, TestUpdater>;
+using TestMapgu = CxxUtils::ConcurrentStrMap<size_t, TestUpdater,
+                                             CxxUtils::detail::ConcurrentGroupHashmapImpl>;
+using TestMapgp = CxxUtils::ConcurrentStrMap<int*, TestUpdater,
+                                             CxxUtils::detail::ConcurrentGroupHashmapImpl>;
+
+
+/// Capacity of the map after inserting 1000 keys.
+template <class MAP>
+struct FullCapacity { static constexpr size_t value = 1024; };
+/// The group implementation grows when the table is 7/8 full.
+template <class VALUE, template <class> class UPDATER>
+struct FullCapacity<CxxUtils::ConcurrentStrMap<VALUE, UPDATER,
+                                               CxxUtils::detail::ConcurrentGroupHashmapImpl> >
+{ static constexpr size_t value = 2048; };
 
 
 template <class MAP>
@@ -247,7 +261,7 @@ void test1a()
   }
 
   assert (map.size() == MAXKEYS);
-  assert (map.capacity() == 1024);
+  assert (map.capacity() == FullCapacity<MAP>::value);
   assert (!map.empty());
  
   assert (map.updater().inGrace() == 0x0e);
@@ -297,7 +311,7 @@ void test1a()
     }
   }
   assert (map.size() == MAXKEYS);
-  assert (map.capacity() == 1024);
+  assert (map.capacity() == FullCapacity<MAP>::value);
 
   for (size_t i = 0; i < MAXKEYS; i++) {
     const_iterator it = map.find (keys[i]);
@@ -419,6 +433,8 @@ void test1()
   test1a<TestMapi>();
   test1a<TestMapf>();
   test1a<TestMapd>();
+  test1a<TestMapgu>();
+  test1a<TestMapgp>();
 }
 
 
@@ -513,6 +529,8 @@ void test2()
   test2a<TestMapi>();
   test2a<TestMapf>();
   test2a<TestMapd>();
+  test2a<TestMapgu>();
+  test2a<TestMapgp>();
 }
 
 
@@ -579,6 +597,7 @@ void test_swap()
 {
   std::cout << "test_swap\n";
   test_swap1<TestMapu>();
+  test_swap1<TestMapgu>();
 }
 
 
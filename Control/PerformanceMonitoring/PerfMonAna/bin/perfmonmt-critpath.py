@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+
+'''
+Critical path analysis of the event data flow, using the output of
+PerfMonMTSvc with doCriticalPathAnalysis enabled. Optionally, the per-event
+critical paths are computed from the timeline written by EventTraceSvc.
+'''
+
+import json
+import argparse
+import tarfile
+
+# Load a JSON file, which can be compressed into a tarball
+def loadJson(fileName):
+    if tarfile.is_tarfile(fileName):
+        with tarfile.open(fileName) as tar:
+            return json.load(tar.extractfile(tar.getmembers()[0]))
+    with open(fileName) as json_file:
+        return json.load(json_file)
+
+# Connect the producers to the consumers, returns the parents of each algorithm
+def buildGraph(dataFlow):
+    producers = {}
+    for alg, deps in dataFlow.items():
+        for output in deps['outputs']:
+            producers.setdefault(output, []).append(alg)
+    parents = {}
+    for alg, deps in dataFlow.items():
+        parents[alg] = sorted({ p for obj in deps['inputs'] for p in producers.get(obj, []) if p != alg })
+    return parents
+
+# Order the algorithms such that producers come before their consumers
+def topologicalOrder(parents):
+    children = { alg : [] for alg in parents }
+    nparents = { alg : len(p) for alg, p in parents.items() }
+    for alg, p in parents.items():
+        for parent in p:
+            children[parent].append(alg)
+    order = [ alg for alg in sorted(parents) if nparents[alg] == 0 ]
+    for alg in order:
+        for child in children[alg]:
+            nparents[child] -= 1
+            if nparents[child] == 0:
+                order.append(child)
+    if len(order) != len(parents):
+        raise RuntimeError('The data flow has a cycle')
+    return order, children
+
+# Compute the critical path for the given execution times [ms]
+def criticalPath(order, parents, children, times):
+    start, bottom = {}, {}
+    for alg in order:
+        start[alg] = max([ start[p] + times.get(p, 0.) for p in parents[alg] ], default = 0.)
+    for alg in reversed(order):
+        bottom[alg] = times.get(alg, 0.) + max([ bottom[c] for c in children[alg] ], default = 0.)
+    length = max([ start[alg] + times.get(alg, 0.) for alg in order ], default = 0.)
+    path = []
+    candidates = [ alg for alg in order if not parents[alg] ]
+    while candidates:
+        alg = max(candidates, key = lambda a : bottom[a])
+        path.append(alg)
+        candidates = children[alg]
+    return length, path, start, bottom
+
+# Print the critical path of the mean event
+def printMeanEvent(data, order, parents, children, times, nThreads, nSlots, maxComps):
+    length, path, start, bottom = criticalPath(order, parents, children, times)
+    total = sum(times.values())
+
+    print('='*105)
+    print('{0:^105}'.format('Critical Path of the Mean Event'))
+    print('='*105)
+    print('{0:<20}{1:<20}{2:<65}'.format('Start [ms]', 'Time [ms]', 'Algorithm'))
+    print('-'*105)
+    for alg in path:
+        print('{0:<20.2f}{1:<20.2f}{2:<65}'.format(start[alg], times.get(alg, 0.), alg))
+    print('*'*105)
+
+    threadLimit = nThreads * 1000. / total if total > 0 else 0.
+    slotLimit = nSlots * 1000. / length if length > 0 else 0.
+    print('{0:<45}{1:<60.2f}'.format('Critical path per event [ms]:', length))
+    print('{0:<45}{1:<60.2f}'.format('Algorithm time per event [ms]:', total))
+    print('{0:<45}{1:<60.2f}'.format('Parallelism within an event:', total / length if length > 0 else 0.))
+    print('{0:<45}{1:<60.3f}'.format('Max. events per second from {} threads:'.format(nThreads), threadLimit))
+    print('{0:<45}{1:<60.3f}'.format('Max. events per second from {} slots:'.format(nSlots), slotLimit))
+
+    # Non-reentrant algorithms run at most in as many events as they have clones
+    serialising = []
+    for alg, deps in data['dataFlow'].items():
+        cardinality = deps['cardinality']
+        if cardinality > 0 and times.get(alg, 0.) > 0:
+            limit = cardinality * 1000. / times[alg]
+            if limit < threadLimit:
+                serialising.append((limit, alg))
+    if serialising:
+        print('*'*105)
+        print('  >> Algorithms limiting the throughput below the thread limit:')
+        print('{0:<20}{1:<20}{2:<20}{3:<45}'.format('Max. evt/s', 'Time [ms]', 'Cardinality', 'Algorithm'))
+        for limit, alg in sorted(serialising)[:maxComps if maxComps > 0 else None]:
+            print('{0:<20.3f}{1:<20.2f}{2:<20}{3:<45}'.format(limit, times[alg],
+                                                             data['dataFlow'][alg]['cardinality'], alg))
+    print('='*105)
+
+    return length, path, start, bottom
+
+# Print the distribution of the per-event critical paths from an EventTraceSvc timeline
+def printPerEvent(trace, order, parents, children, maxComps):
+    # Execution time of each algorithm in each event [ms]
+    eventTimes = {}
+    for span in trace['traceEvents']:
+        if span.get('ph') != 'X' or span.get('pid') != 1 or span['name'] not in parents:
+            continue
+        times = eventTimes.setdefault(span['args']['event'], {})
+        times[span['name']] = times.get(span['name'], 0.) + span['dur'] * 0.001
+
+    if not eventTimes:
+        return
+
+    lengths, onPath = [], {}
+    for times in eventTimes.values():
+        length, path, _, _ = criticalPath(order, parents, children, times)
+        lengths.append(length)
+        for alg in path:
+            onPath[alg] = onPath.get(alg, 0) + 1
+
+    nEvents = len(lengths)
+    print('='*105)
+    print('{0:^105}'.format('Per-Event Critical Paths'))
+    print('='*105)
+    print('{0:<45}{1:<60}'.format('Number of events:', nEvents))
+    print('{0:<45}{1:<60.2f}'.format('Mean critical path [ms]:', sum(lengths) / nEvents))
+    print('{0:<45}{1:<60.2f}'.format('Min. critical path [ms]:', min(lengths)))
+    print('{0:<45}{1:<60.2f}'.format('Max. critical path [ms]:', max(lengths)))
+    print('*'*105)
+    print('{0:<20}{1:<85}'.format('On path [%]', 'Algorithm'))
+    print('-'*105)
+    ranked = sorted(onPath.items(), key = lambda item : -item[1])
+    for alg, count in ranked[:maxComps if maxComps > 0 else None]:
+        print('{0:<20.1f}{1:<85}'.format(100. * count / nEvents, alg))
+    print('='*105)
+
+# Write the algorithm priorities, the longest remaining path first
+def writeHints(fileName, length, path, start, bottom):
+    hints = { 'criticalPathLength' : length,
+              'criticalPath' : path,
+              'priorities' : {} }
+    for rank, alg in enumerate(sorted(bottom, key = lambda a : -bottom[a])):
+        hints['priorities'][alg] = { 'rank' : rank,
+                                     'bottomLevel' : bottom[alg],
+                                     'slack' : max(length - start[alg] - bottom[alg], 0.) }
+    with open(fileName, 'w') as hints_file:
+        json.dump(hints, hints_file, indent = 4)
+    print('Wrote the scheduling hints into {}'.format(fileName))
+
+# Main function
+if '__main__' in __name__:
+
+    # Parse the user input
+    parser = argparse.ArgumentParser(description = 'Script to compute the critical path using PerfMonMTSvc JSON')
+
+    parser.add_argument('-i', '--input', type = str, required = True,
+                        help = 'PerfMonMTSvc JSON file, written with doCriticalPathAnalysis')
+    parser.add_argument('-t', '--trace', type = str, default = None,
+                        help = 'EventTraceSvc JSON file, for the per-event critical paths')
+    parser.add_argument('-n', '--threads', type = int, default = None,
+                        help = 'Number of threads for the throughput limits (default: as in the job)')
+    parser.add_argument('-s', '--slots', type = int, default = None,
+                        help = 'Number of slots for the throughput limits (default: as in the job)')
+    parser.add_argument('-o', '--hints', type = str, default = None,
+                        help = 'Write the algorithm priorities into this JSON file')
+    parser.add_argument('-m', '--max-components', dest = 'max_comps', type = int, default = 50,
+                        help = 'The maximum number of compoments to be printed '
+                        '(default: 50)')
+
+    args = parser.parse_args()
+
+    data = loadJson(args.input)
+    if 'dataFlow' not in data:
+        raise SystemExit('No data flow in {}, run with PerfMon.doCriticalPathMT'.format(args.input))
+
+    # Mean wall time per execution after the first event
+    execData = data.get('componentLevel', {}).get('Execute', {})
+    times = { alg : execData[alg]['wallTime'] / execData[alg]['count']
+              for alg in data['dataFlow'] if alg in execData and execData[alg]['count'] > 0 }
+
+    misc = data.get('summary', {}).get('misc', {})
+    nThreads = args.threads if args.threads else misc.get('nThreads', 1)
+    nSlots = args.slots if args.slots else misc.get('nSlots', 1)
+
+    parents = buildGraph(data['dataFlow'])
+    order, children = topologicalOrder(parents)
+
+    length, path, start, bottom = printMeanEvent(data, order, parents, children, times,
+                                                 nThreads, nSlots, args.max_comps)
+    if args.trace:
+        printPerEvent(loadJson(args.trace), order, parents, children, args.max_comps)
+    if args.hints:
+        writeHints(args.hints, length, path, start, bottom)
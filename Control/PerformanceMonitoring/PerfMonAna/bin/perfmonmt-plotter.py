@@ -1,6 +1,6 @@
 #!/usr/bin/env python3
 
-# Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 # @author: Hasan Ozturk <haozturk@cern.ch>
 
@@ -23,7 +23,9 @@ colors = { "dCPU" : "tab:blue", "dWall" : "tab:orange",
            "dRss" : "tab:orange", "dSwap" : "tab:red",
            "cpuTime" : "tab:blue", "wallTime" : "tab:orange",
            "malloc" : "tab:orange", "vmem" : "tab:blue",
-           "pss" : "tab:green", "rss" : "tab:orange", "swap" : "tab:red" }
+           "pss" : "tab:green", "rss" : "tab:orange", "swap" : "tab:red",
+           "mallocAlloc" : "tab:blue", "mallocNet" : "tab:red",
+           "nMalloc" : "tab:blue", "nFree" : "tab:green" }
 
 def plotBarChart(params):
 
@@ -264,6 +266,87 @@ def plotComponentLevel(componentLevelData, compCountPerPlot):
   memMonFig.savefig("Component_Level_Memory")
 
 
+def plotComponentLevelMalloc(componentLevelData, compCountPerPlot):
+
+  allocMonFig = plt.figure(figsize=(35,105))
+  countMonFig = plt.figure(figsize=(35,105))
+
+  for idx, step in enumerate(componentLevelData):
+
+    compNames, allocVals, netVals, nMallocVals, nFreeVals = [],[],[],[],[]
+    for comp, meas in componentLevelData[step].items():
+
+      count = meas["count"]
+      alloc = meas["mallocAlloc"] * 0.001 # MB
+      net = (meas["mallocAlloc"] - meas["mallocFree"]) * 0.001 # MB
+
+      # Truncate unwieldy component names
+      if len(comp) > 50:
+        comp = f"{comp[:20]}[...]{comp[-20:]}"
+
+      compNames.append(comp + " [" + str(count) + "]")
+      allocVals.append(alloc)
+      netVals.append(net)
+      nMallocVals.append(meas["nMalloc"])
+      nFreeVals.append(meas["nFree"])
+
+    allocMonVals = {
+      "mallocAlloc": allocVals,
+      "mallocNet": netVals
+    }
+
+    countMonVals = {
+      "nMalloc": nMallocVals,
+      "nFree": nFreeVals
+    }
+
+    # Sort the components
+    sortedAllocCompNames, sortedAllocMonVals = sortComponents(compNames, allocMonVals, compCountPerPlot)
+    sortedCountCompNames, sortedCountMonVals = sortComponents(compNames, countMonVals, compCountPerPlot)
+
+    allocMonAx = allocMonFig.add_subplot(len(componentLevelData),1,idx+1)
+    countMonAx = countMonFig.add_subplot(len(componentLevelData),1,idx+1)
+
+    allocMonParams = {
+      "ax": allocMonAx,
+      "index": np.arange(len(sortedAllocCompNames)),
+      "width": 0.5/len(sortedAllocMonVals),
+      "vals": sortedAllocMonVals,
+      "yTickLabels": sortedAllocCompNames,
+      "xlabel": "Allocated Memory [MB]",
+      "ylabel": "Components",
+      "title": step,
+      "titleFontSize": 70,
+      "xlabelFontSize": 50,
+      "ylabelFontSize": 50,
+      "legendFontSize": 30
+    }
+
+    countMonParams = {
+      "ax": countMonAx,
+      "index": np.arange(len(sortedCountCompNames)),
+      "width": 0.5/len(sortedCountMonVals),
+      "vals": sortedCountMonVals,
+      "yTickLabels": sortedCountCompNames,
+      "xlabel": "Number of Calls",
+      "ylabel": "Components",
+      "title": step,
+      "titleFontSize": 70,
+      "xlabelFontSize": 50,
+      "ylabelFontSize": 50,
+      "legendFontSize": 30
+    }
+
+    plotBarChart(allocMonParams)
+    plotBarChart(countMonParams)
+
+  allocMonFig.set_tight_layout( True )
+  allocMonFig.savefig("Component_Level_Allocations")
+
+  countMonFig.set_tight_layout( True )
+  countMonFig.savefig("Component_Level_Allocation_Counts")
+
+
 def plotEventLevel(eventLevelData):
 
   sortedEventLevelData = sorted(eventLevelData.items(), key=lambda i: int(i[0]))
@@ -337,6 +420,10 @@ def process(data, ncomps):
       componentLevelData = data["componentLevel"]
       plotComponentLevel(componentLevelData, ncomps)
 
+      # Allocation measurements are only there if they were enabled in the job
+      if any("mallocAlloc" in meas for step in componentLevelData.values() for meas in step.values()):
+        plotComponentLevelMalloc(componentLevelData, ncomps)
+
     if "eventLevel" in data:
       eventLevelData = data["eventLevel"]
       plotEventLevel(eventLevelData)
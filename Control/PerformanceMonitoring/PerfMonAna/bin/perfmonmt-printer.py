@@ -1,6 +1,6 @@
 #!/usr/bin/env python3
 
-# Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 import json
 import argparse
@@ -56,6 +56,91 @@ def printComponentLevelInfo(execOnly = True, orderBy = 'cpuTime', maxComps = -1)
             pass
         print('='*105)
 
+# Print Component Level Allocations in Descending Order
+def printComponentLevelMallocInfo(execOnly = True, maxComps = -1):
+    if 'componentLevel' not in data:
+        return
+    # Allocation measurements are only there if they were enabled in the job
+    if not any('mallocAlloc' in meas for step in data['componentLevel'].values() for meas in step.values()):
+        return
+    print('='*105)
+    print('{0:^105}'.format('Component Level Allocations'))
+    print('='*105)
+    print('{0:<18}{1:<10}{2:<13}{3:<13}{4:<15}{5:<15}{6:<20}'.format('Step',
+                                                                    'Count',
+                                                                    'nMalloc',
+                                                                    'nFree',
+                                                                    'Alloc [kB]',
+                                                                    'Net [kB]',
+                                                                    'Component'))
+    print('='*105)
+    steps = ['Initialize', 'FirstEvent', 'Execute', 'Finalize', 'Callback', 'preLoadProxy']
+    if execOnly:
+        steps = ['Execute']
+    ncomps = 0
+    for step in steps:
+        try:
+            for entry in sorted(data['componentLevel'][step],
+                                key=lambda x: data['componentLevel'][step][x]['mallocAlloc'], reverse = True):
+                meas = data['componentLevel'][step][entry]
+                print('{0:<18}{1:<10}{2:<13}{3:<13}{4:<15.0f}{5:<15.0f}{6:<20}'.format(step,
+                                                                                      meas['count'],
+                                                                                      meas['nMalloc'],
+                                                                                      meas['nFree'],
+                                                                                      meas['mallocAlloc'],
+                                                                                      meas['mallocAlloc'] - meas['mallocFree'],
+                                                                                      entry))
+                ncomps += 1
+                if (ncomps == maxComps):
+                    break
+        except KeyError:
+            pass
+        print('='*105)
+
+# Print Component Level Hardware Counters in Descending Order
+def printComponentLevelPerfEventInfo(execOnly = True, maxComps = -1):
+    if 'componentLevel' not in data:
+        return
+    # Hardware counters are only there if they were enabled in the job
+    if not any('cycles' in meas for step in data['componentLevel'].values() for meas in step.values()):
+        return
+    print('='*105)
+    print('{0:^105}'.format('Component Level Hardware Counters'))
+    print('='*105)
+    print('{0:<18}{1:<10}{2:<13}{3:<13}{4:<8}{5:<13}{6:<13}{7:<20}'.format('Step',
+                                                                          'Count',
+                                                                          'Cycles [M]',
+                                                                          'Instr [M]',
+                                                                          'IPC',
+                                                                          'LLC-M [k]',
+                                                                          'Br-M [k]',
+                                                                          'Component'))
+    print('='*105)
+    steps = ['Initialize', 'FirstEvent', 'Execute', 'Finalize', 'Callback', 'preLoadProxy']
+    if execOnly:
+        steps = ['Execute']
+    ncomps = 0
+    for step in steps:
+        try:
+            for entry in sorted(data['componentLevel'][step],
+                                key=lambda x: data['componentLevel'][step][x]['cycles'], reverse = True):
+                meas = data['componentLevel'][step][entry]
+                ipc = meas['instructions']/meas['cycles'] if meas['cycles'] > 0 else 0.
+                print('{0:<18}{1:<10}{2:<13.1f}{3:<13.1f}{4:<8.2f}{5:<13.1f}{6:<13.1f}{7:<20}'.format(step,
+                                                                                                   meas['count'],
+                                                                                                   meas['cycles']*1e-6,
+                                                                                                   meas['instructions']*1e-6,
+                                                                                                   ipc,
+                                                                                                   meas['llcMisses']*1e-3,
+                                                                                                   meas['branchMisses']*1e-3,
+                                                                                                   entry))
+                ncomps += 1
+                if (ncomps == maxComps):
+                    break
+        except KeyError:
+            pass
+        print('='*105)
+
 # Event Level Data in Ascending Order
 def printEventLevelInfo():
     if 'eventLevel' not in data:
@@ -147,6 +232,8 @@ def printEnvironmentInfo():
     print('='*105)
     print('{0:<40}{1:<}'.format('Malloc Library:',data['summary']['envInfo']['mallocLib']))
     print('{0:<40}{1:<}'.format('Math Library:',data['summary']['envInfo']['mathLib']))
+    if 'mallocHooks' in data['summary']['envInfo']:
+        print('{0:<40}{1:<}'.format('Malloc Hooks:',data['summary']['envInfo']['mallocHooks']))
     print('='*105)
 
 # Print out data
@@ -159,6 +246,10 @@ def printReport(data):
         printComponentLevelInfo(args.exec_only,
                                 args.order_by,
                                 args.max_comps)
+        printComponentLevelMallocInfo(args.exec_only,
+                                      args.max_comps)
+        printComponentLevelPerfEventInfo(args.exec_only,
+                                         args.max_comps)
 
     # Print Event Level Data
     if args.level in ['All', 'EventLevel']:
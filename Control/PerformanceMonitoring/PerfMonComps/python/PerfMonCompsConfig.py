@@ -1,6 +1,6 @@
 #!/usr/bin/env python
 
-# Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
 from AthenaConfiguration.ComponentFactory import CompFactory
@@ -15,11 +15,17 @@ def PerfMonMTSvcCfg(flags, **kwargs):
     log.info("Configuring PerfMonMTSvc with flags:")
     log.info("  >> doFastMonMT {}".format(flags.PerfMon.doFastMonMT))
     log.info("  >> doFullMonMT {}".format(flags.PerfMon.doFullMonMT))
+    log.info("  >> doMallocMonMT {}".format(flags.PerfMon.doMallocMonMT))
+    log.info("  >> doPerfEventMonMT {}".format(flags.PerfMon.doPerfEventMonMT))
+    log.info("  >> doCriticalPathMT {}".format(flags.PerfMon.doCriticalPathMT))
+
+    # Get CA
+    acc = ComponentAccumulator()
 
     # Check if basic monitoring is asked for
     if not flags.PerfMon.doFastMonMT and not flags.PerfMon.doFullMonMT:
         log.info("Nothing to be done...")
-        return ComponentAccumulator()
+        return acc
 
     # Hook to PerfMonMTSvc
     PerfMonMTSvc = CompFactory.PerfMonMTSvc
@@ -34,10 +40,16 @@ def PerfMonMTSvcCfg(flags, **kwargs):
                       max(1,flags.Concurrency.NumConcurrentEvents))
     kwargs.setdefault("doComponentLevelMonitoring",
                       flags.PerfMon.doFullMonMT)
+    kwargs.setdefault("doMallocMonitoring",
+                      flags.PerfMon.doFullMonMT and flags.PerfMon.doMallocMonMT)
+    kwargs.setdefault("doPerfEventMonitoring",
+                      flags.PerfMon.doFullMonMT and flags.PerfMon.doPerfEventMonMT)
+    kwargs.setdefault("doCriticalPathAnalysis",
+                      flags.PerfMon.doFullMonMT and flags.PerfMon.doCriticalPathMT)
+    kwargs.setdefault("schedulingHintsFile", flags.PerfMon.SchedulingHintsJSON)
     kwargs.setdefault("jsonFileName", flags.PerfMon.OutputJSON)
 
-    # Get CA and add the service 
-    acc = ComponentAccumulator()
+    # Add the service to the CA
     acc.addService(PerfMonMTSvc(**kwargs), create=True)
 
     # Enable the auditors that are necessarry for the service
@@ -49,6 +61,27 @@ def PerfMonMTSvcCfg(flags, **kwargs):
     # Return the CA
     return acc
 
+## A minimal new-style configuration for EventTraceSvc
+def EventTraceSvcCfg(flags, **kwargs):
+    """ Configuring EventTraceSvc """
+
+    # Check if the trace is asked for
+    if not flags.PerfMon.doEventTrace:
+        return ComponentAccumulator()
+
+    kwargs.setdefault("OutputFile", flags.PerfMon.EventTraceJSON)
+
+    # Get CA and add the service
+    acc = ComponentAccumulator()
+    acc.addService(CompFactory.EventTraceSvc(**kwargs), create=True)
+
+    # Enable the auditors that are necessarry for the service
+    acc.addService(CompFactory.AuditorSvc(), create=True)
+    acc.setAppProperty("AuditAlgorithms", True)
+
+    # Return the CA
+    return acc
+
 # A minimal job that demonstrates what PerfMonMTSvc does
 if __name__ == '__main__':
 
@@ -69,6 +102,7 @@ if __name__ == '__main__':
     # Set up the configuration and add the relevant services
     cfg = MainServicesCfg(flags)
     cfg.merge(PerfMonMTSvcCfg(flags))
+    cfg.merge(EventTraceSvcCfg(flags))
 
     # Burn 100 +/- 1 ms per event
     CpuCruncherAlg = CompFactory.getComp('PerfMonTest::CpuCruncherAlg')
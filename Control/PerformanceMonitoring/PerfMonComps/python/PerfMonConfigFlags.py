@@ -1,4 +1,4 @@
-# Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 from AthenaConfiguration.AthConfigFlags import AthConfigFlags
 
@@ -9,6 +9,20 @@ def createPerfMonConfigFlags():
     pcf.addFlag('PerfMon.doFastMonMT', False)
     pcf.addFlag('PerfMon.doFullMonMT', False)
     pcf.addFlag('PerfMon.OutputJSON', 'perfmonmt.json')
+    # Count the heap allocations of each component
+    # Only used together with doFullMonMT
+    pcf.addFlag('PerfMon.doMallocMonMT', False)
+    # Read the hardware counters of each component
+    # Only used together with doFullMonMT
+    pcf.addFlag('PerfMon.doPerfEventMonMT', False)
+    # Compute the critical path through the event data flow
+    # and optionally write the resulting algorithm priorities
+    # Only used together with doFullMonMT
+    pcf.addFlag('PerfMon.doCriticalPathMT', False)
+    pcf.addFlag('PerfMon.SchedulingHintsJSON', '')
+    # Record a timeline of the event loop in Chrome trace format
+    pcf.addFlag('PerfMon.doEventTrace', False)
+    pcf.addFlag('PerfMon.EventTraceJSON', 'eventtrace.json')
     # List of algorithms to profile e.g from
     # callgrind/valkyrie or Vtune
     pcf.addFlag('PerfMon.VTune.ProfiledAlgs', [])
@@ -0,0 +1,68 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+// Framework includes
+#include "GaudiKernel/INamedInterface.h"
+
+// PerfMonKernel includes
+#include "PerfMonKernel/IEventTraceSvc.h"
+
+// PerfMonComps includes
+#include "EventTraceAuditor.h"
+
+/*
+ * Constructor
+ */
+EventTraceAuditor::EventTraceAuditor( const std::string& name,
+                                      ISvcLocator* pSvcLocator ) :
+  Auditor ( name, pSvcLocator ),
+  m_eventTraceSvc ( "EventTraceSvc", name )
+{
+}
+
+/*
+ * Initialize the Auditor
+ */
+StatusCode EventTraceAuditor::initialize()
+{
+  if ( !m_eventTraceSvc.retrieve().isSuccess() ) {
+    return StatusCode::FAILURE;
+  }
+  return StatusCode::SUCCESS;
+}
+
+/*
+ * Implementation of base class methods
+ */
+void EventTraceAuditor::before( StandardEventType etype, INamedInterface* component ) {
+  return m_eventTraceSvc->startTrace( toStr(etype), component->name() );
+}
+
+void EventTraceAuditor::before( StandardEventType etype, const std::string& compName ) {
+  return m_eventTraceSvc->startTrace( toStr(etype), compName );
+}
+
+void EventTraceAuditor::before( CustomEventTypeRef etype, INamedInterface* component ) {
+  return m_eventTraceSvc->startTrace( etype, component->name() );
+}
+
+void EventTraceAuditor::before( CustomEventTypeRef etype, const std::string& compName ) {
+  return m_eventTraceSvc->startTrace( etype, compName );
+}
+
+void EventTraceAuditor::after( StandardEventType etype, INamedInterface* component, const StatusCode& ) {
+  return m_eventTraceSvc->stopTrace( toStr(etype), component->name() );
+}
+
+void EventTraceAuditor::after( StandardEventType etype, const std::string& compName, const StatusCode& ) {
+  return m_eventTraceSvc->stopTrace( toStr(etype), compName );
+}
+
+void EventTraceAuditor::after( CustomEventTypeRef etype, INamedInterface* component, const StatusCode& ) {
+  return m_eventTraceSvc->stopTrace( etype, component->name() );
+}
+
+void EventTraceAuditor::after( CustomEventTypeRef etype, const std::string& compName, const StatusCode& ) {
+  return m_eventTraceSvc->stopTrace( etype, compName );
+}
@@ -0,0 +1,50 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef PERFMONCOMPS_EVENTTRACEAUDITOR_H
+#define PERFMONCOMPS_EVENTTRACEAUDITOR_H
+
+// STL includes
+#include <string>
+
+// Framework includes
+#include "GaudiKernel/Auditor.h"
+#include "GaudiKernel/ServiceHandle.h"
+
+// Forward declaration
+class IEventTraceSvc;
+
+/*
+ * Forwards the component executions to EventTraceSvc
+ */
+class EventTraceAuditor : public Auditor
+{
+
+  public:
+
+    /// Constructor
+    EventTraceAuditor(const std::string& name, ISvcLocator* pSvcLocator);
+
+    /// Gaudi hooks
+    virtual StatusCode initialize() override;
+
+    /// Implement inherited methods from Auditor
+    void before( StandardEventType, INamedInterface* ) override;
+    void before( StandardEventType, const std::string& ) override;
+    void before( CustomEventTypeRef, INamedInterface* ) override;
+    void before( CustomEventTypeRef, const std::string& ) override;
+
+    void after( StandardEventType, INamedInterface*, const StatusCode& ) override;
+    void after( StandardEventType, const std::string&, const StatusCode& ) override;
+    void after( CustomEventTypeRef, INamedInterface*, const StatusCode& ) override;
+    void after( CustomEventTypeRef, const std::string&, const StatusCode& ) override;
+
+  private:
+
+    /// Handle to EventTraceSvc
+    ServiceHandle< IEventTraceSvc > m_eventTraceSvc;
+
+}; // end EventTraceAuditor
+
+#endif // PERFMONCOMPS_EVENTTRACEAUDITOR_H
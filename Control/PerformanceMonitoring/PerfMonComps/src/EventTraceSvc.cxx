@@ -0,0 +1,375 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+// Framework includes
+#include "GaudiKernel/ConcurrencyFlags.h"
+#include "GaudiKernel/IAlgorithm.h"
+#include "GaudiKernel/IIncidentSvc.h"
+#include "GaudiKernel/ThreadLocalContext.h"
+
+// PerfMonComps includes
+#include "EventTraceSvc.h"
+#include "PerfMonUtils.h"  // borrow from existing code
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+namespace {
+
+  // A span that has been started but not stopped yet
+  struct OpenSpan {
+    uint64_t begin;
+    uint32_t step, comp;
+  };
+
+  // Index of the current thread in the trace
+  thread_local uint32_t tlsThread = std::numeric_limits<uint32_t>::max();
+
+  // Spans started in the current thread
+  thread_local std::vector<OpenSpan> tlsOpenSpans;
+
+  // Categories of the spans in the trace
+  const std::string catEvent = "Event";
+  const std::string catAlgorithm = "Algorithm";
+  const std::string catCondAlgorithm = "CondAlgorithm";
+  const std::string catIO = "IO";
+  const std::string catCondIO = "CondIO";
+
+  // Write a string as a JSON string literal
+  void writeJsonString(std::ostream& os, const std::string& s) {
+    os << '"';
+    for (char c : s) {
+      switch (c) {
+        case '"': os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n"; break;
+        case '\t': os << "\\t"; break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+               << std::setfill(' ');
+          } else {
+            os << c;
+          }
+      }
+    }
+    os << '"';
+  }
+
+  // Time in the trace, in microseconds
+  double toMicroSec(uint64_t ns) { return ns * 1e-3; }
+
+}  // anonymous namespace
+
+/*
+ * Constructor
+ */
+EventTraceSvc::EventTraceSvc(const std::string& name, ISvcLocator* pSvcLocator)
+    : AthService(name, pSvcLocator) {}
+
+/*
+ * Query Interface
+ */
+StatusCode EventTraceSvc::queryInterface(const InterfaceID& riid, void** ppvInterface) {
+  if (!ppvInterface) {
+    return StatusCode::FAILURE;
+  }
+
+  if (riid == IEventTraceSvc::interfaceID()) {
+    *ppvInterface = static_cast<IEventTraceSvc*>(this);
+    return StatusCode::SUCCESS;
+  }
+
+  return AthService::queryInterface(riid, ppvInterface);
+}
+
+/*
+ * Initialize the Service
+ */
+StatusCode EventTraceSvc::initialize() {
+  // Print where we are
+  ATH_MSG_INFO("Initializing " << name());
+
+  m_t0 = std::chrono::steady_clock::now().time_since_epoch() / std::chrono::nanoseconds(1);
+
+  // Allocate the ring buffer up front, so that recording never allocates
+  uint64_t size = 1;
+  while (size < m_bufferSize) size <<= 1;
+  m_spans = std::make_unique<Entry[]>(size);
+  m_size = size;
+  m_mask = size - 1;
+
+  m_traceStepSet.insert(m_traceSteps.begin(), m_traceSteps.end());
+
+  // The events are traced from the begin to the end of their processing
+  ServiceHandle<IIncidentSvc> incSvc("IncidentSvc/IncidentSvc", name());
+  ATH_CHECK(incSvc.retrieve());
+  incSvc->addListener(this, IncidentType::BeginProcessing);
+  incSvc->addListener(this, IncidentType::EndProcessing);
+
+  ATH_CHECK(m_condSvc.retrieve());
+
+  ATH_MSG_INFO("Tracing steps [" << m_traceSteps.toString() << "] into a buffer of " << size << " spans");
+
+  /// Configure the auditor
+  if (!PerfMon::makeAuditor("EventTraceAuditor", auditorSvc(), msg()).isSuccess()) {
+    ATH_MSG_ERROR("Could not register auditor [EventTraceAuditor]!");
+    return StatusCode::FAILURE;
+  }
+  return StatusCode::SUCCESS;
+}
+
+/*
+ * Start the Service
+ */
+StatusCode EventTraceSvc::start() {
+  // Sized once, handle() never resizes it while events are processed
+  m_slotEvents.assign(std::max<size_t>(1, Gaudi::Concurrency::ConcurrencyFlags::numConcurrentEvents()), Span());
+  return StatusCode::SUCCESS;
+}
+
+/*
+ * Finalize the Service
+ */
+StatusCode EventTraceSvc::finalize() {
+  // Print where we are
+  ATH_MSG_INFO("Finalizing " << name());
+
+  // Remember the conditions algorithms for the categories
+  for (const IAlgorithm* alg : m_condSvc->condAlgs()) {
+    m_condAlgs.insert(alg->name());
+  }
+
+  std::ofstream o(m_outputFile);
+  if (!o) {
+    ATH_MSG_ERROR("Couldn't open " << m_outputFile.toString() << " for writing");
+    return StatusCode::FAILURE;
+  }
+  writeTrace(o);
+  o.close();
+
+  const uint64_t nspans = m_nspans;
+  ATH_MSG_INFO("Wrote " << std::min<uint64_t>(nspans, m_size) << " spans from " << m_nthreads
+               << " threads into " << m_outputFile.toString());
+  if (nspans > m_size) {
+    ATH_MSG_WARNING("The oldest " << nspans - m_size
+                    << " spans were overwritten, increase BufferSize to keep the full job");
+  }
+  reportOccupancy();
+
+  return StatusCode::SUCCESS;
+}
+
+/*
+ * Record the event processing in every slot
+ */
+void EventTraceSvc::handle(const Incident& inc) {
+  const EventContext& ctx = inc.context();
+  if (!ctx.valid()) return;
+
+  const size_t slot = ctx.slot();
+  if (slot >= m_slotEvents.size()) return;
+
+  // Both incidents are fired by the event loop manager in its own thread
+  Span& span = m_slotEvents[slot];
+  if (inc.type() == IncidentType::BeginProcessing) {
+    span.begin = now();
+    span.event = ctx.evt();
+    span.step = span.comp = nameIndex(catEvent);
+    span.slot = static_cast<int16_t>(slot);
+  } else if (inc.type() == IncidentType::EndProcessing && span.slot >= 0) {
+    span.end = now();
+    // Not tied to a thread, written to the slot view only
+    span.thread = std::numeric_limits<uint32_t>::max();
+    record(span);
+    span.slot = -1;
+  }
+}
+
+/*
+ * Start of a traced step
+ */
+void EventTraceSvc::startTrace(const std::string& stepName, const std::string& compName) {
+  if (!m_traceStepSet.count(stepName)) return;
+
+  tlsOpenSpans.push_back({now(), nameIndex(stepName), nameIndex(compName)});
+}
+
+/*
+ * End of a traced step
+ */
+void EventTraceSvc::stopTrace(const std::string& stepName, const std::string& compName) {
+  if (!m_traceStepSet.count(stepName) || tlsOpenSpans.empty()) return;
+
+  const uint64_t end = now();
+  const uint32_t step = nameIndex(stepName);
+  const uint32_t comp = nameIndex(compName);
+
+  // Normally the innermost span, but be robust against unbalanced calls
+  auto it = std::find_if(tlsOpenSpans.rbegin(), tlsOpenSpans.rend(),
+                         [&](const OpenSpan& s) { return s.step == step && s.comp == comp; });
+  if (it == tlsOpenSpans.rend()) return;
+
+  if (tlsThread == std::numeric_limits<uint32_t>::max()) {
+    tlsThread = m_nthreads++;
+  }
+
+  const EventContext& ctx = Gaudi::Hive::currentContext();
+
+  Span span;
+  span.begin = it->begin;
+  span.end = end;
+  span.step = step;
+  span.comp = comp;
+  span.thread = tlsThread;
+  span.depth = std::distance(it, tlsOpenSpans.rend()) - 1;
+  if (ctx.valid()) {
+    span.event = ctx.evt();
+    span.slot = ctx.slot();
+  }
+  record(span);
+
+  tlsOpenSpans.erase(std::next(it).base(), tlsOpenSpans.end());
+}
+
+/*
+ * Time since initialize in ns
+ */
+uint64_t EventTraceSvc::now() const {
+  return std::chrono::steady_clock::now().time_since_epoch() / std::chrono::nanoseconds(1) - m_t0;
+}
+
+/*
+ * Get the index of a name, adding it if needed
+ */
+uint32_t EventTraceSvc::nameIndex(const std::string& name) {
+  // Lock-free in the common case where the name is known already
+  auto it = m_nameIndices.find(name);
+  if (it != m_nameIndices.end()) return it->second;
+
+  std::lock_guard<std::mutex> lock(m_namesMutex);
+  it = m_nameIndices.find(name);
+  if (it != m_nameIndices.end()) return it->second;
+  const uint32_t index = m_names.size();
+  m_names.push_back(name);
+  m_nameIndices.emplace(name, index);
+  return index;
+}
+
+/*
+ * Store a finished span in the ring buffer
+ */
+void EventTraceSvc::record(const Span& span) {
+  // Each span gets its own entry; the oldest ones are overwritten once the buffer is full.
+  // Two threads only get the same entry when the buffer wraps around during a write:
+  // the entry is then written by one thread at a time, and keeps the most recent span.
+  const uint64_t index = m_nspans++;
+  Entry& entry = m_spans[index & m_mask];
+  while (entry.busy.test_and_set(std::memory_order_acquire)) {
+  }
+  if (entry.index == Entry::noIndex || entry.index < index) {
+    entry.span = span;
+    entry.index = index;
+  }
+  entry.busy.clear(std::memory_order_release);
+}
+
+/*
+ * Category of a span in the trace
+ */
+const std::string& EventTraceSvc::category(const Span& span) const {
+  const std::string& step = m_names[span.step];
+  if (step == catEvent) return catEvent;
+  if (step == "preLoadProxy" || step == "Callback") return catCondIO;
+  if (step != "Execute") return step;
+
+  const std::string& comp = m_names[span.comp];
+  if (std::find(m_ioComponents.begin(), m_ioComponents.end(), comp) != m_ioComponents.end()) return catIO;
+  if (m_condAlgs.count(comp)) return catCondAlgorithm;
+  return catAlgorithm;
+}
+
+/*
+ * Write the trace in Chrome trace event format
+ *  - Process 1 shows what every thread executed
+ *  - Process 2 shows which event every slot was processing
+ */
+void EventTraceSvc::writeTrace(std::ostream& os) const {
+  const uint64_t nspans = m_nspans;
+  const uint64_t first = nspans > m_size ? nspans - m_size : 0;
+
+  os << "{\"displayTimeUnit\":\"ms\",\n"
+     << "\"otherData\":{\"spans\":" << nspans << ",\"overwrittenSpans\":" << first << "},\n"
+     << "\"traceEvents\":[\n"
+     << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Threads\"}},\n"
+     << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"Event slots\"}}";
+
+  os << std::fixed << std::setprecision(3);
+  for (uint64_t i = first; i < nspans; i++) {
+    // Skip the entries lost to a newer span, or still being written
+    const Entry& entry = m_spans[i & m_mask];
+    if (entry.index != i) continue;
+    const Span& span = entry.span;
+    const bool isEvent = span.thread == std::numeric_limits<uint32_t>::max();
+
+    os << ",\n{\"name\":";
+    if (isEvent) {
+      os << "\"Event " << span.event << "\"";
+    } else {
+      writeJsonString(os, m_names[span.comp]);
+    }
+    os << ",\"cat\":";
+    writeJsonString(os, category(span));
+    os << ",\"ph\":\"X\",\"ts\":" << toMicroSec(span.begin)
+       << ",\"dur\":" << toMicroSec(span.end - span.begin)
+       << ",\"pid\":" << (isEvent ? 2 : 1)
+       << ",\"tid\":" << (isEvent ? static_cast<int>(span.slot) : static_cast<int>(span.thread))
+       << ",\"args\":{\"event\":" << span.event << ",\"slot\":" << span.slot << "}}";
+  }
+  os << "\n]}\n";
+}
+
+/*
+ * Print a summary of the thread and slot occupancy
+ */
+void EventTraceSvc::reportOccupancy() const {
+  const uint64_t nspans = m_nspans;
+  const uint64_t first = nspans > m_size ? nspans - m_size : 0;
+  if (nspans == first) return;
+
+  // Busy time of every thread (outermost spans only) and of every slot
+  std::vector<uint64_t> threadBusy(m_nthreads, 0), slotBusy;
+  uint64_t tmin = std::numeric_limits<uint64_t>::max(), tmax = 0;
+  for (uint64_t i = first; i < nspans; i++) {
+    const Entry& entry = m_spans[i & m_mask];
+    if (entry.index != i) continue;
+    const Span& span = entry.span;
+    if (span.thread == std::numeric_limits<uint32_t>::max()) {
+      if (span.slot >= static_cast<int>(slotBusy.size())) slotBusy.resize(span.slot + 1, 0);
+      slotBusy[span.slot] += span.end - span.begin;
+      tmin = std::min(tmin, span.begin);
+      tmax = std::max(tmax, span.end);
+    } else if (span.depth == 0 && span.slot >= 0 && span.thread < threadBusy.size()) {
+      threadBusy[span.thread] += span.end - span.begin;
+    }
+  }
+  if (tmax <= tmin) return;
+
+  // Occupancy over the traced part of the event loop
+  const double window = tmax - tmin;
+  uint64_t totThread = 0, totSlot = 0;
+  for (uint64_t t : threadBusy) totThread += t;
+  for (uint64_t t : slotBusy) totSlot += t;
+  ATH_MSG_INFO("Over " << std::setprecision(3) << window * 1e-9 << " s of the event loop:");
+  ATH_MSG_INFO("  >> Mean thread occupancy: " << std::setprecision(1) << std::fixed
+               << (threadBusy.empty() ? 0. : 100. * totThread / window / threadBusy.size()) << " % of "
+               << threadBusy.size() << " threads");
+  ATH_MSG_INFO("  >> Mean slot occupancy: " << std::setprecision(1) << std::fixed
+               << (slotBusy.empty() ? 0. : 100. * totSlot / window / slotBusy.size()) << " % of "
+               << slotBusy.size() << " slots");
+}
@@ -0,0 +1,156 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+/*
+ * Records a timeline of the component executions in a job, and writes it
+ * in the Chrome trace event format, which can be viewed with chrome://tracing
+ * or https://ui.perfetto.dev.
+ *
+ * Every traced execution is kept as a span (begin/end time, thread, event slot)
+ * in a fixed size ring buffer, which is filled without taking any global lock.
+ * If the buffer fills up, the oldest spans are overwritten.
+ */
+
+#ifndef PERFMONCOMPS_EVENTTRACESVC_H
+#define PERFMONCOMPS_EVENTTRACESVC_H
+
+// Thread-safety-checker
+#include "CxxUtils/checker_macros.h"
+
+// Framework includes
+#include "AthenaBaseComps/AthService.h"
+#include "GaudiKernel/ICondSvc.h"
+#include "GaudiKernel/IIncidentListener.h"
+
+// PerfMonKernel includes
+#include "PerfMonKernel/IEventTraceSvc.h"
+
+// CxxUtils includes
+#include "CxxUtils/ConcurrentStrMap.h"
+#include "CxxUtils/SimpleUpdater.h"
+
+// STL includes
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+class EventTraceSvc : virtual public IEventTraceSvc, virtual public IIncidentListener, public AthService {
+ public:
+  /// Standard Gaudi Service constructor
+  EventTraceSvc(const std::string& name, ISvcLocator* pSvcLocator);
+
+  /// Function declaring the interface(s) implemented by the service
+  virtual StatusCode queryInterface(const InterfaceID& riid, void** ppvInterface) override;
+
+  /// Standard Gaudi Service initialization
+  virtual StatusCode initialize() override;
+
+  /// Standard Gaudi Service start, the number of event slots is known from here on
+  virtual StatusCode start() override;
+
+  /// Standard Gaudi Service finalization, writes the trace
+  virtual StatusCode finalize() override;
+
+  /// Incident handler for the begin and end of the event processing
+  virtual void handle(const Incident& incident) override;
+
+  /// Start of a traced step
+  virtual void startTrace(const std::string& stepName, const std::string& compName) override;
+
+  /// End of a traced step
+  virtual void stopTrace(const std::string& stepName, const std::string& compName) override;
+
+  /// One recorded execution
+  struct Span {
+    uint64_t begin{}, end{};  // Time since initialize in ns
+    uint64_t event{};         // Event number in the job
+    uint32_t step{}, comp{};  // Indices of the step and component names
+    uint32_t thread{};        // Index of the thread, in the order threads were first seen
+    uint16_t depth{};         // Number of enclosing spans in the same thread
+    int16_t slot{-1};         // Event slot, -1 outside of the event loop
+  };
+
+  /// Entry of the ring buffer
+  struct Entry {
+    std::atomic_flag busy;    // Set while the span is written
+    uint64_t index{noIndex};  // Index of the span in the job, noIndex if not written yet
+    Span span;
+    static constexpr uint64_t noIndex = std::numeric_limits<uint64_t>::max();
+  };
+
+ private:
+  /// Time since initialize in ns
+  uint64_t now() const;
+
+  /// Get the index of a name, adding it if needed
+  uint32_t nameIndex(const std::string& name);
+
+  /// Store a finished span in the ring buffer
+  void record(const Span& span);
+
+  /// Category of a span in the trace
+  const std::string& category(const Span& span) const;
+
+  /// Write the trace in Chrome trace event format
+  void writeTrace(std::ostream& os) const;
+
+  /// Print a summary of the thread and slot occupancy
+  void reportOccupancy() const;
+
+  /// Name of the output file
+  Gaudi::Property<std::string> m_outputFile{this, "OutputFile", "eventtrace.json",
+                                            "Name of the Chrome trace event (JSON) file written at finalize."};
+  /// Number of spans kept
+  Gaudi::Property<uint64_t> m_bufferSize{
+      this, "BufferSize", 1 << 20,
+      "Number of spans kept in memory, rounded up to a power of two. The oldest spans are overwritten."};
+  /// Audited steps to trace
+  Gaudi::Property<std::vector<std::string>> m_traceSteps{
+      this, "TraceSteps", {"Execute", "preLoadProxy", "Callback"},
+      "Audited steps that are traced. preLoadProxy and Callback are the conditions data loading."};
+  /// Components doing I/O
+  Gaudi::Property<std::vector<std::string>> m_ioComponents{
+      this, "IOComponents", {"SGInputLoader", "CondInputLoader"},
+      "Algorithms whose execution is shown as I/O in the trace."};
+
+  /// Handle to the conditions service, used to tell conditions algorithms apart
+  ServiceHandle<ICondSvc> m_condSvc{this, "CondSvc", "CondSvc"};
+
+  /// Start of the job, as given by the steady clock
+  uint64_t m_t0{};
+
+  /// Ring buffer of spans
+  std::unique_ptr<Entry[]> m_spans;
+  uint64_t m_size{};
+  uint64_t m_mask{};
+  std::atomic<uint64_t> m_nspans{0};
+
+  /// Traced step names, filled in initialize
+  std::set<std::string> m_traceStepSet;
+
+  /// Names of the components and steps, and their indices
+  typedef CxxUtils::ConcurrentStrMap<uint32_t, CxxUtils::SimpleUpdater> index_map_t;
+  index_map_t m_nameIndices{index_map_t::Updater_t()};
+  std::deque<std::string> m_names;
+  std::mutex m_namesMutex;
+
+  /// Number of threads seen so far
+  std::atomic<uint32_t> m_nthreads{0};
+
+  /// Start of the event currently processed in each slot, sized at start
+  std::vector<Span> m_slotEvents;
+
+  /// Conditions algorithms, filled at finalize
+  std::set<std::string> m_condAlgs;
+
+};  // class EventTraceSvc
+
+#endif  // PERFMONCOMPS_EVENTTRACESVC_H
@@ -0,0 +1,131 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "PerfMonMTDataFlow.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+namespace PMonMT {
+
+  /*
+   * Add an algorithm to the graph
+   */
+  void DataFlowGraph::addNode(const std::string& name, double time, unsigned int cardinality,
+                              const std::vector<std::string>& inputs, const std::vector<std::string>& outputs) {
+    Node node;
+    node.name = name;
+    node.time = std::max(time, 0.);
+    node.cardinality = cardinality;
+    node.inputs = inputs;
+    node.outputs = outputs;
+    m_nodes.push_back(std::move(node));
+  }
+
+  /*
+   * Connect the nodes and compute the critical path
+   */
+  bool DataFlowGraph::analyse() {
+    // Several algorithms may write the same object, e.g. decorations
+    std::map<std::string, std::vector<size_t>> producers;
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+      for (const std::string& output : m_nodes[i].outputs) {
+        producers[output].push_back(i);
+      }
+    }
+
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+      for (const std::string& input : m_nodes[i].inputs) {
+        auto itr = producers.find(input);
+        if (itr == producers.end()) continue;
+        for (size_t parent : itr->second) {
+          if (parent == i) continue;
+          std::vector<size_t>& parents = m_nodes[i].parents;
+          if (std::find(parents.begin(), parents.end(), parent) != parents.end()) continue;
+          parents.push_back(parent);
+          m_nodes[parent].children.push_back(i);
+        }
+      }
+    }
+
+    // Topological order
+    std::vector<size_t> order;
+    order.reserve(m_nodes.size());
+    std::vector<size_t> nparents(m_nodes.size());
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+      nparents[i] = m_nodes[i].parents.size();
+      if (nparents[i] == 0) order.push_back(i);
+    }
+    for (size_t k = 0; k < order.size(); ++k) {
+      for (size_t child : m_nodes[order[k]].children) {
+        if (--nparents[child] == 0) order.push_back(child);
+      }
+    }
+    if (order.size() != m_nodes.size()) {
+      return false;
+    }
+
+    // Earliest start of each node, and the length of the event
+    m_length = 0;
+    for (size_t i : order) {
+      Node& node = m_nodes[i];
+      node.earliestStart = 0;
+      for (size_t parent : node.parents) {
+        node.earliestStart = std::max(node.earliestStart, m_nodes[parent].earliestStart + m_nodes[parent].time);
+      }
+      m_length = std::max(m_length, node.earliestStart + node.time);
+    }
+
+    // Longest path to the end of the event
+    for (auto itr = order.rbegin(); itr != order.rend(); ++itr) {
+      Node& node = m_nodes[*itr];
+      double longestChild = 0;
+      for (size_t child : node.children) {
+        longestChild = std::max(longestChild, m_nodes[child].bottomLevel);
+      }
+      node.bottomLevel = node.time + longestChild;
+      node.slack = std::max(m_length - node.earliestStart - node.bottomLevel, 0.);
+    }
+
+    // Follow the longest path from the source with the largest bottom level
+    m_criticalPath.clear();
+    size_t current = m_nodes.size();
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+      if (!m_nodes[i].parents.empty()) continue;
+      if (current == m_nodes.size() || m_nodes[i].bottomLevel > m_nodes[current].bottomLevel) current = i;
+    }
+    while (current < m_nodes.size()) {
+      m_criticalPath.push_back(current);
+      size_t next = m_nodes.size();
+      for (size_t child : m_nodes[current].children) {
+        if (next == m_nodes.size() || m_nodes[child].bottomLevel > m_nodes[next].bottomLevel) next = child;
+      }
+      current = next;
+    }
+
+    return true;
+  }
+
+  /*
+   * Sum of the execution times
+   */
+  double DataFlowGraph::totalTime() const {
+    return std::accumulate(m_nodes.begin(), m_nodes.end(), 0.,
+                           [](double sum, const Node& node) { return sum + node.time; });
+  }
+
+  /*
+   * Nodes by decreasing priority
+   */
+  std::vector<size_t> DataFlowGraph::priorityOrder() const {
+    std::vector<size_t> order(m_nodes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+      return m_nodes[a].bottomLevel > m_nodes[b].bottomLevel;
+    });
+    return order;
+  }
+
+} // namespace PMonMT
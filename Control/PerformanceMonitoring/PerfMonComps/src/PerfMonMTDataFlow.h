@@ -0,0 +1,68 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+/*
+ * Critical path analysis of the event data flow for PerfMonMTSvc.
+ *
+ * The algorithms are the nodes of the graph, weighted by their mean execution
+ * time. An algorithm depends on the algorithms producing its inputs, as declared
+ * by their data handles. The longest weighted path through the graph is the
+ * shortest time in which an event can be processed, however many threads are
+ * available.
+ */
+
+#ifndef PERFMONCOMPS_PERFMONMTDATAFLOW_H
+#define PERFMONCOMPS_PERFMONMTDATAFLOW_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace PMonMT {
+
+  class DataFlowGraph {
+  public:
+    struct Node {
+      std::string name;
+      double time{};                   // Mean execution time [ms]
+      unsigned int cardinality{};      // Maximum number of concurrent executions, 0 if unlimited
+      std::vector<std::string> inputs, outputs;
+      std::vector<size_t> parents, children;
+      // Filled by analyse
+      double earliestStart{};          // Earliest start within the event [ms]
+      double bottomLevel{};            // Longest path from the start of the node to the end of the event [ms]
+      double slack{};                  // Delay that does not lengthen the event [ms]
+    };
+
+    // Add an algorithm with its declared inputs and outputs
+    void addNode(const std::string& name, double time, unsigned int cardinality,
+                 const std::vector<std::string>& inputs, const std::vector<std::string>& outputs);
+
+    // Connect the producers to the consumers and compute the critical path,
+    // returns false if the data flow has a cycle
+    bool analyse();
+
+    const std::vector<Node>& nodes() const { return m_nodes; }
+
+    // Nodes on the critical path, in execution order
+    const std::vector<size_t>& criticalPath() const { return m_criticalPath; }
+
+    // Length of the critical path [ms]
+    double criticalPathLength() const { return m_length; }
+
+    // Sum of the execution times of all nodes [ms]
+    double totalTime() const;
+
+    // Nodes ordered by decreasing priority, i.e. by decreasing bottom level
+    std::vector<size_t> priorityOrder() const;
+
+  private:
+    std::vector<Node> m_nodes;
+    std::vector<size_t> m_criticalPath;
+    double m_length{};
+  };
+
+} // namespace PMonMT
+
+#endif  // PERFMONCOMPS_PERFMONMTDATAFLOW_H
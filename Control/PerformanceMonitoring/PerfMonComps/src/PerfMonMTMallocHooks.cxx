@@ -0,0 +1,271 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+// Thread-safety-checker
+#include "CxxUtils/checker_macros.h"
+#include "CxxUtils/features.h"
+
+// PerfMonComps includes
+#include "PerfMonMTMallocHooks.h"
+
+// STL includes
+#include <dlfcn.h>
+#include <malloc.h>
+#include <pthread.h>
+
+#include <atomic>
+#include <cstddef>
+
+#if HAVE_MALLOC_HOOKS
+// The glibc implementation, called by our hooks
+extern "C" {
+  void* __libc_malloc(size_t size);
+  void* __libc_realloc(void* ptr, size_t size);
+  void* __libc_memalign(size_t alignment, size_t size);
+  void __libc_free(void* ptr);
+}
+#endif
+
+namespace {
+
+  /*
+   * Counters of the threads.
+   * This library is dlopen'ed, so its thread_local variables would either
+   * use the initial-exec TLS model, which draws from the limited static TLS
+   * surplus and can make dlopen fail, or the dynamic model, which allocates
+   * the TLS block of a thread with malloc on first access and so would
+   * recurse into the hooks. Instead, each thread claims a slot of a fixed
+   * table, found from pthread_self() without allocating anything.
+   * Only the owning thread updates the counters of a slot.
+   * A new thread may reuse the slot of a finished one with the same id,
+   * which is harmless as only differences of the counters are used.
+   */
+  constexpr int slotBits = 12;
+  constexpr size_t maxThreads = size_t{1} << slotBits;
+  // One cache line per thread
+  struct alignas(64) ThreadSlot {
+    std::atomic<pthread_t> owner{};
+    PMonMT::MallocCounters counters;
+  };
+  ThreadSlot threadSlots[maxThreads] ATLAS_THREAD_SAFE;
+
+  // Counters of the calling thread, or nullptr if the table is full
+  PMonMT::MallocCounters* slotCounters() {
+    const pthread_t self = pthread_self();
+    size_t index = (static_cast<size_t>(self) * 0x9E3779B97F4A7C15ULL) >> (64 - slotBits);
+    for (size_t n = 0; n < maxThreads; ++n, index = (index + 1) & (maxThreads - 1)) {
+      ThreadSlot& slot = threadSlots[index];
+      pthread_t owner = slot.owner.load(std::memory_order_relaxed);
+      if (pthread_equal(owner, self)) return &slot.counters;
+      if (owner == pthread_t{} &&
+          slot.owner.compare_exchange_strong(owner, self, std::memory_order_relaxed)) {
+        return &slot.counters;
+      }
+    }
+    return nullptr;
+  }
+
+  void countAlloc(size_t size) {
+    if (PMonMT::MallocCounters* counters = slotCounters()) {
+      ++counters->nmalloc;
+      counters->allocated += size;
+    }
+  }
+
+  void countDealloc(size_t size) {
+    if (PMonMT::MallocCounters* counters = slotCounters()) {
+      ++counters->nfree;
+      counters->freed += size;
+    }
+  }
+
+  enum Backend { NONE, TCMALLOC, GLIBC };
+  std::atomic<Backend> backend{NONE};
+
+  /*
+   * tcmalloc (gperftools) backend.
+   * The hook API is looked up at run-time, so that we neither need to link
+   * against tcmalloc nor break jobs that run without it.
+   */
+  typedef void (*NewHook_t)(const void* ptr, size_t size);
+  typedef void (*DeleteHook_t)(const void* ptr);
+  typedef int (*ChangeNewHook_t)(NewHook_t hook);
+  typedef int (*ChangeDeleteHook_t)(DeleteHook_t hook);
+  typedef size_t (*MallocSize_t)(void* ptr);
+
+  struct TcMallocFuncs {
+    ChangeNewHook_t addNewHook{}, removeNewHook{};
+    ChangeDeleteHook_t addDeleteHook{}, removeDeleteHook{};
+    MallocSize_t mallocSize{};
+  };
+  // Only set up in install(), before any of the hooks may be called
+  TcMallocFuncs tcFuncs ATLAS_THREAD_SAFE;
+
+  void tcNewHook(const void* ptr, size_t /*size*/) {
+    if (!ptr) return;
+    countAlloc(tcFuncs.mallocSize(const_cast<void*>(ptr)));
+  }
+
+  void tcDeleteHook(const void* ptr) {
+    if (!ptr) return;
+    countDealloc(tcFuncs.mallocSize(const_cast<void*>(ptr)));
+  }
+
+  bool installTcMalloc() {
+    // Only use tcmalloc if it is actually the allocator serving malloc
+    void* mallocAddr = dlsym(RTLD_DEFAULT, "malloc");
+    if (!mallocAddr || mallocAddr != dlsym(RTLD_DEFAULT, "tc_malloc")) return false;
+
+    tcFuncs.addNewHook = reinterpret_cast<ChangeNewHook_t>(dlsym(RTLD_DEFAULT, "MallocHook_AddNewHook"));
+    tcFuncs.removeNewHook = reinterpret_cast<ChangeNewHook_t>(dlsym(RTLD_DEFAULT, "MallocHook_RemoveNewHook"));
+    tcFuncs.addDeleteHook = reinterpret_cast<ChangeDeleteHook_t>(dlsym(RTLD_DEFAULT, "MallocHook_AddDeleteHook"));
+    tcFuncs.removeDeleteHook = reinterpret_cast<ChangeDeleteHook_t>(dlsym(RTLD_DEFAULT, "MallocHook_RemoveDeleteHook"));
+    tcFuncs.mallocSize = reinterpret_cast<MallocSize_t>(dlsym(RTLD_DEFAULT, "tc_malloc_size"));
+    if (!tcFuncs.addNewHook || !tcFuncs.removeNewHook || !tcFuncs.addDeleteHook || !tcFuncs.removeDeleteHook ||
+        !tcFuncs.mallocSize) {
+      return false;
+    }
+
+    return tcFuncs.addNewHook(&tcNewHook) && tcFuncs.addDeleteHook(&tcDeleteHook);
+  }
+
+  void uninstallTcMalloc() {
+    tcFuncs.removeNewHook(&tcNewHook);
+    tcFuncs.removeDeleteHook(&tcDeleteHook);
+  }
+
+#if HAVE_MALLOC_HOOKS
+
+#ifdef __GNUC__
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+
+  /*
+   * glibc backend, only available before glibc 2.34.
+   * The hooks call the glibc implementation directly, rather than
+   * uninstalling and reinstalling themselves around each call,
+   * so they are safe to use from many threads.
+   */
+  struct GlibcHooks {
+    void* (*malloc)(size_t, const void*){};
+    void* (*realloc)(void*, size_t, const void*){};
+    void* (*memalign)(size_t, size_t, const void*){};
+    void (*free)(void*, const void*){};
+  };
+  // Hooks that were in place before ours, restored by uninstall()
+  GlibcHooks origHooks ATLAS_THREAD_SAFE;
+
+  void countMalloc(void* ptr) {
+    if (!ptr) return;
+    countAlloc(malloc_usable_size(ptr));
+  }
+
+  void countFree(void* ptr) {
+    if (!ptr) return;
+    countDealloc(malloc_usable_size(ptr));
+  }
+
+  void* glibcMallocHook(size_t size, const void* /*caller*/) {
+    void* result = __libc_malloc(size);
+    countMalloc(result);
+    return result;
+  }
+
+  void* glibcReallocHook(void* ptr, size_t size, const void* /*caller*/) {
+    const size_t oldSize = ptr ? malloc_usable_size(ptr) : 0;
+    void* result = __libc_realloc(ptr, size);
+    // On failure the original block is left untouched
+    if (ptr && (result || size == 0)) {
+      countDealloc(oldSize);
+    }
+    countMalloc(result);
+    return result;
+  }
+
+  void* glibcMemalignHook(size_t alignment, size_t size, const void* /*caller*/) {
+    void* result = __libc_memalign(alignment, size);
+    countMalloc(result);
+    return result;
+  }
+
+  void glibcFreeHook(void* ptr, const void* /*caller*/) {
+    countFree(ptr);
+    __libc_free(ptr);
+  }
+
+  bool installGlibc() {
+    origHooks.malloc = __malloc_hook;
+    origHooks.realloc = __realloc_hook;
+    origHooks.memalign = __memalign_hook;
+    origHooks.free = __free_hook;
+    __malloc_hook = glibcMallocHook;
+    __realloc_hook = glibcReallocHook;
+    __memalign_hook = glibcMemalignHook;
+    __free_hook = glibcFreeHook;
+    return true;
+  }
+
+  void uninstallGlibc() {
+    __malloc_hook = origHooks.malloc;
+    __realloc_hook = origHooks.realloc;
+    __memalign_hook = origHooks.memalign;
+    __free_hook = origHooks.free;
+  }
+
+#ifdef __GNUC__
+# pragma GCC diagnostic pop
+#endif
+
+#endif // HAVE_MALLOC_HOOKS
+
+} // anonymous namespace
+
+/*
+ * Install the hooks
+ */
+std::string PMonMT::MallocHooks::install() {
+  if (backend == NONE) {
+    if (installTcMalloc()) {
+      backend = TCMALLOC;
+    }
+#if HAVE_MALLOC_HOOKS
+    else if (installGlibc()) {
+      backend = GLIBC;
+    }
+#endif
+  }
+
+  switch (backend) {
+    case TCMALLOC: return "tcmalloc";
+    case GLIBC: return "glibc";
+    default: return "";
+  }
+}
+
+/*
+ * Remove the hooks
+ */
+void PMonMT::MallocHooks::uninstall() {
+  switch (backend.exchange(NONE)) {
+    case TCMALLOC:
+      uninstallTcMalloc();
+      break;
+#if HAVE_MALLOC_HOOKS
+    case GLIBC:
+      uninstallGlibc();
+      break;
+#endif
+    default:
+      break;
+  }
+}
+
+/*
+ * Counters of the calling thread
+ */
+PMonMT::MallocCounters PMonMT::MallocHooks::threadCounters() {
+  const PMonMT::MallocCounters* counters = slotCounters();
+  return counters ? *counters : PMonMT::MallocCounters{};
+}
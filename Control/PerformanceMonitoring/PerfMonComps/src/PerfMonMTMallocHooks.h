@@ -0,0 +1,47 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+/*
+ * Lightweight allocation counting for PerfMonMTSvc.
+ *
+ * The hooks only update counters that belong to the calling thread,
+ * so updating them needs neither locks nor atomics. PerfMonMTSvc reads the counters
+ * of the current thread before and after each component call and attributes
+ * the difference to the component.
+ */
+
+#ifndef PERFMONCOMPS_PERFMONMTMALLOCHOOKS_H
+#define PERFMONCOMPS_PERFMONMTMALLOCHOOKS_H
+
+#include <cstdint>
+#include <string>
+
+namespace PMonMT {
+
+  // Allocation counters of a single thread
+  struct MallocCounters {
+    uint64_t nmalloc{}, nfree{};    // Number of allocations and deallocations
+    uint64_t allocated{}, freed{};  // Bytes allocated and freed
+  };
+
+  namespace MallocHooks {
+
+    // Install the hooks into the allocator in use.
+    // tcmalloc (as preloaded in production) is used if available,
+    // otherwise the glibc hooks if the glibc version still provides them.
+    // Returns the name of the backend used, or an empty string if
+    // allocations cannot be monitored in this job.
+    std::string install();
+
+    // Remove the hooks again
+    void uninstall();
+
+    // Counters of the calling thread, all zero if the hooks are not installed
+    MallocCounters threadCounters();
+
+  } // namespace MallocHooks
+
+} // namespace PMonMT
+
+#endif  // PERFMONCOMPS_PERFMONMTMALLOCHOOKS_H
@@ -0,0 +1,140 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+// PerfMonComps includes
+#include "PerfMonMTPerfEvents.h"
+
+// System includes
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+
+namespace {
+
+  // The counters we read, the first one is the group leader
+  struct EventDef {
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+  };
+  constexpr size_t NEVENTS = 4;
+  const EventDef eventDefs[NEVENTS] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"llcMisses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"branchMisses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+  };
+
+  /*
+   * The counter group of one thread.
+   * All counters are read with a single read call on the group leader.
+   */
+  class ThreadEvents {
+  public:
+    ThreadEvents() { open(); }
+    ~ThreadEvents() { close(); }
+
+    ThreadEvents(const ThreadEvents&) = delete;
+    ThreadEvents& operator=(const ThreadEvents&) = delete;
+
+    // Counters measured so far in this thread
+    PMonMT::PerfEventCounters read() {
+      // The descriptors of a forked process still count the parent thread
+      if (m_pid != getpid()) {
+        close();
+        open();
+      }
+
+      PMonMT::PerfEventCounters result;
+      if (m_fd[0] < 0) return result;
+
+      // Layout for PERF_FORMAT_GROUP: nr, time_enabled, time_running, values[nr]
+      uint64_t buf[3 + NEVENTS] = {};
+      const ssize_t n = ::read(m_fd[0], buf, sizeof(buf));
+      if (n < static_cast<ssize_t>((3 + m_nopen) * sizeof(uint64_t))) return result;
+
+      // Scale up if the group was multiplexed with other events
+      const double scale = (buf[2] > 0 && buf[2] < buf[1]) ? static_cast<double>(buf[1]) / buf[2] : 1.;
+
+      uint64_t values[NEVENTS] = {};
+      for (size_t i = 0; i < NEVENTS; i++) {
+        if (m_fd[i] >= 0) values[i] = static_cast<uint64_t>(buf[3 + m_index[i]] * scale);
+      }
+      result.cycles = values[0];
+      result.instructions = values[1];
+      result.llc_misses = values[2];
+      result.branch_misses = values[3];
+      return result;
+    }
+
+    // Is a given counter being read?
+    bool isOpen(size_t i) const { return m_fd[i] >= 0; }
+
+  private:
+    void open() {
+      m_pid = getpid();
+      m_nopen = 0;
+      for (size_t i = 0; i < NEVENTS; i++) {
+        m_fd[i] = -1;
+        // Without a leader there is no group to join
+        if (i > 0 && m_fd[0] < 0) continue;
+
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = eventDefs[i].type;
+        attr.config = eventDefs[i].config;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        // Only count this thread in user space, which is also
+        // what unprivileged users are allowed to do by default
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, m_fd[0], PERF_FLAG_FD_CLOEXEC);
+        if (fd >= 0) {
+          m_fd[i] = static_cast<int>(fd);
+          m_index[i] = m_nopen++;
+        }
+      }
+    }
+
+    void close() {
+      // Members first, then the leader
+      for (size_t i = NEVENTS; i-- > 0;) {
+        if (m_fd[i] >= 0) ::close(m_fd[i]);
+        m_fd[i] = -1;
+      }
+      m_nopen = 0;
+    }
+
+    pid_t m_pid{};
+    int m_fd[NEVENTS] = {-1, -1, -1, -1};
+    size_t m_index[NEVENTS] = {};  // Position of the counter in the group
+    size_t m_nopen{};
+  };
+
+  // Opened on first use in every thread
+  thread_local ThreadEvents tlsEvents;
+
+} // anonymous namespace
+
+/*
+ * Counters that can be read by the calling thread
+ */
+std::vector<std::string> PMonMT::PerfEvents::availableCounters() {
+  std::vector<std::string> result;
+  for (size_t i = 0; i < NEVENTS; i++) {
+    if (tlsEvents.isOpen(i)) result.push_back(eventDefs[i].name);
+  }
+  return result;
+}
+
+/*
+ * Counters of the calling thread
+ */
+PMonMT::PerfEventCounters PMonMT::PerfEvents::threadCounters() {
+  return tlsEvents.read();
+}
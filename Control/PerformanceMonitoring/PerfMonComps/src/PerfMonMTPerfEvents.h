@@ -0,0 +1,43 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+/*
+ * Hardware performance counters for PerfMonMTSvc, read with perf_event_open.
+ *
+ * Each thread opens its own group of counters, which only count that thread
+ * in user space, the first time it reads them. PerfMonMTSvc reads the counters
+ * of the current thread before and after each component call and attributes
+ * the difference to the component.
+ */
+
+#ifndef PERFMONCOMPS_PERFMONMTPERFEVENTS_H
+#define PERFMONCOMPS_PERFMONMTPERFEVENTS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PMonMT {
+
+  // Hardware counters of a single thread
+  struct PerfEventCounters {
+    uint64_t cycles{}, instructions{};       // Core cycles and retired instructions
+    uint64_t llc_misses{}, branch_misses{};  // Last level cache misses and mispredicted branches
+  };
+
+  namespace PerfEvents {
+
+    // Names of the counters that can be read by the calling thread.
+    // Empty if perf_event_open is not usable in this job,
+    // e.g. because of the kernel.perf_event_paranoid setting.
+    std::vector<std::string> availableCounters();
+
+    // Counters of the calling thread, zero for the counters that are not available
+    PerfEventCounters threadCounters();
+
+  } // namespace PerfEvents
+
+} // namespace PMonMT
+
+#endif  // PERFMONCOMPS_PERFMONMTPERFEVENTS_H
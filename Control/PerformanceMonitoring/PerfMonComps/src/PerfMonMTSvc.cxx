@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /*
@@ -10,6 +10,9 @@
 #include "CxxUtils/checker_macros.h"
 
 // Framework includes
+#include "GaudiKernel/IAlgManager.h"
+#include "GaudiKernel/IAlgorithm.h"
+#include "GaudiKernel/IDataHandleHolder.h"
 #include "GaudiKernel/IIncidentSvc.h"
 #include "GaudiKernel/ThreadLocalContext.h"
 
@@ -93,6 +96,51 @@ StatusCode PerfMonMTSvc::initialize() {
     ATH_MSG_INFO("  >> Component-level memory monitoring in the event-loop is disabled in jobs with more than 1 thread");
   }
 
+  // Allocation monitoring needs the component-level measurements and a supported allocator
+  if (m_doMallocMonitoring) {
+    if (!m_doComponentLevelMonitoring) {
+      ATH_MSG_WARNING("Allocation monitoring requires component-level monitoring, disabling it");
+      m_doMallocMonitoring = false;
+    } else {
+      m_mallocHooksBackend = PMonMT::MallocHooks::install();
+      if (m_mallocHooksBackend.empty()) {
+        ATH_MSG_WARNING("Allocation monitoring needs tcmalloc or a glibc version with malloc hooks, disabling it");
+        m_doMallocMonitoring = false;
+      }
+    }
+  }
+  ATH_MSG_INFO("Component-level allocation measurements are [" << (m_doMallocMonitoring ? "Enabled" : "Disabled") << "]");
+  if (m_doMallocMonitoring) {
+    ATH_MSG_INFO("  >> Using the " << m_mallocHooksBackend << " malloc hooks");
+  }
+
+  // Hardware counter monitoring needs the component-level measurements and access to the counters
+  if (m_doPerfEventMonitoring) {
+    if (!m_doComponentLevelMonitoring) {
+      ATH_MSG_WARNING("Hardware counter monitoring requires component-level monitoring, disabling it");
+      m_doPerfEventMonitoring = false;
+    } else {
+      const std::vector<std::string> counters = PMonMT::PerfEvents::availableCounters();
+      if (counters.empty()) {
+        ATH_MSG_WARNING("Hardware counters are not accessible via perf_event_open "
+                        "(check /proc/sys/kernel/perf_event_paranoid), disabling their monitoring");
+        m_doPerfEventMonitoring = false;
+      } else {
+        std::string names;
+        for (const std::string& counter : counters) names += " " + counter;
+        ATH_MSG_INFO("  >> Available hardware counters:" << names);
+      }
+    }
+  }
+  ATH_MSG_INFO("Component-level hardware counter measurements are [" << (m_doPerfEventMonitoring ? "Enabled" : "Disabled") << "]");
+
+  // The critical path is weighted by the component-level measurements
+  if (m_doCriticalPathAnalysis && !m_doComponentLevelMonitoring) {
+    ATH_MSG_WARNING("Critical path analysis requires component-level monitoring, disabling it");
+    m_doCriticalPathAnalysis = false;
+  }
+  ATH_MSG_INFO("Critical path analysis is [" << (m_doCriticalPathAnalysis ? "Enabled" : "Disabled") << "]");
+
   // Thread specific component-level data map
   m_compLevelDataMapVec.resize(m_numberOfThreads+1); // Default construct
 
@@ -191,6 +239,11 @@ void PerfMonMTSvc::handle(const Incident& inc) {
     m_measurementSnapshots.capture();
     m_snapshotData[FINALIZE].addPointStop(m_measurementSnapshots);
 
+    // Nothing more to attribute
+    if (m_doMallocMonitoring) {
+      PMonMT::MallocHooks::uninstall();
+    }
+
     // Report everything
     report();
   }
@@ -294,8 +347,15 @@ void PerfMonMTSvc::startCompAud(const std::string& stepName, const std::string&
     // we made sure this is only run outside event loop or single-threaded
     [[maybe_unused]] bool dummy ATLAS_THREAD_SAFE = meas.capture_memory();
   }
+  if (m_doPerfEventMonitoring) {
+    meas.capture_perf_counters();
+  }
+  // Done last so that our own allocations are not attributed to the component
+  if (m_doMallocMonitoring) {
+    meas.capture_malloc_counters();
+  }
 
-  compLevelDataMap[currentState]->addPointStart(meas, doMem);
+  compLevelDataMap[currentState]->addPointStart(meas, doMem, m_doMallocMonitoring, m_doPerfEventMonitoring);
 
   // Debug
   ATH_MSG_DEBUG("Start Audit - Component " << compName       << " , "
@@ -322,6 +382,14 @@ void PerfMonMTSvc::stopCompAud(const std::string& stepName, const std::string& c
 
   // Capture
   PMonMT::ComponentMeasurement meas;
+  // Done first so that our own allocations are not attributed to the component
+  // Allocations done by the component in other threads, e.g. in its own TBB tasks, are not seen
+  if (m_doMallocMonitoring) {
+    meas.capture_malloc_counters();
+  }
+  if (m_doPerfEventMonitoring) {
+    meas.capture_perf_counters();
+  }
   meas.capture(); // No memory in the event-loop
   if (doMem) {
     // we made sure this is only run outside event loop or single-threaded
@@ -333,7 +401,7 @@ void PerfMonMTSvc::stopCompAud(const std::string& stepName, const std::string& c
 
   // Store
   data_map_unique_t& compLevelDataMap = m_compLevelDataMapVec[ithread];
-  compLevelDataMap[currentState]->addPointStop(meas, doMem);
+  compLevelDataMap[currentState]->addPointStop(meas, doMem, m_doMallocMonitoring, m_doPerfEventMonitoring);
 
   // Once the first time IncidentProcAlg3 is excuted, toggle m_isFirstEvent to false.
   // Doing it this way, instead of at EndAlgorithms incident, makes sure there is no
@@ -401,6 +469,17 @@ int PerfMonMTSvc::getCpuEfficiency() const {
  * Report the results to the log and the JSON file
  */
 void PerfMonMTSvc::report() {
+  // Aggregate the component-level data, used by the log, the JSON and the critical path
+  if (m_doComponentLevelMonitoring) {
+    aggregateSlotData(); // aggregate data from slots
+    divideData2Steps(); // divive data into steps for ordered printing
+  }
+
+  // Data flow of the event algorithms, also needed without the detailed tables
+  if (m_doCriticalPathAnalysis) {
+    collectDataFlow();
+  }
+
   // Write into log file
   report2Log();
 
@@ -408,6 +487,11 @@ void PerfMonMTSvc::report() {
   if (m_reportResultsToJSON) {
     report2JsonFile();
   }
+
+  // Priorities derived from the critical path
+  if (m_isDataFlowAnalysed && !m_schedulingHintsFile.empty()) {
+    writeSchedulingHints();
+  }
 }
 
 /*
@@ -422,6 +506,21 @@ void PerfMonMTSvc::report2Log() {
     report2Log_ComponentLevel();
   }
 
+  // Component-level allocations
+  if (m_printDetailedTables && m_doMallocMonitoring) {
+    report2Log_MallocLevel();
+  }
+
+  // Component-level hardware counters
+  if (m_printDetailedTables && m_doPerfEventMonitoring) {
+    report2Log_PerfEventLevel();
+  }
+
+  // Critical path through the event data flow
+  if (m_printDetailedTables && m_doCriticalPathAnalysis) {
+    report2Log_CriticalPath();
+  }
+
   // Event-level
   if (m_printDetailedTables && m_doEventLoopMonitoring) {
     report2Log_EventLevel();
@@ -465,9 +564,6 @@ void PerfMonMTSvc::report2Log_ComponentLevel() {
 
   ATH_MSG_INFO("---------------------------------------------------------------------------------------");
 
-  aggregateSlotData(); // aggregate data from slots
-  divideData2Steps(); // divive data into steps for ordered printing
-
   for (auto vec_itr : m_stdoutVec_serial) {
     // Sort the results by CPU time for the time being
     std::vector<std::pair<PMonMT::StepComp, PMonMT::ComponentData*>> pairs;
@@ -497,6 +593,176 @@ void PerfMonMTSvc::report2Log_ComponentLevel() {
   }
 }
 
+/*
+ * Report component-level allocation information to log
+ */
+void PerfMonMTSvc::report2Log_MallocLevel() {
+  using boost::format;
+
+  ATH_MSG_INFO("=======================================================================================");
+  ATH_MSG_INFO("                            Component Level Allocations                                ");
+  ATH_MSG_INFO("=======================================================================================");
+
+  ATH_MSG_INFO(format("%1% %|15t|%2% %|25t|%3% %|37t|%4% %|49t|%5% %|62t|%6% %|75t|%7%") % "Step" % "Count" %
+               "nMalloc" % "nFree" % "Alloc [kB]" % "Net [kB]" % "Component");
+
+  ATH_MSG_INFO("---------------------------------------------------------------------------------------");
+
+  // The data was aggregated over the slots and divided into steps by report()
+  for (const auto& vec_itr : m_stdoutVec_serial) {
+    // Sort the results by the allocated memory
+    std::vector<std::pair<PMonMT::StepComp, PMonMT::ComponentData*>> pairs(vec_itr.begin(), vec_itr.end());
+
+    sort(pairs.begin(), pairs.end(),
+         [=](std::pair<PMonMT::StepComp, PMonMT::ComponentData*>& a,
+             std::pair<PMonMT::StepComp, PMonMT::ComponentData*>& b) {
+           return a.second->getDeltaMallocCounters().allocated > b.second->getDeltaMallocCounters().allocated;
+         });
+
+    int counter = 0;
+    for (const auto& it : pairs) {
+      // Only write out a certian number of components
+      if (counter >= m_printNComps) {
+        break;
+      }
+      counter++;
+
+      const PMonMT::MallocCounters& counters = it.second->getDeltaMallocCounters();
+      const double allocated = counters.allocated / 1024.;
+      const double net = (static_cast<double>(counters.allocated) - static_cast<double>(counters.freed)) / 1024.;
+
+      ATH_MSG_INFO(format("%1% %|15t|%2% %|25t|%3% %|37t|%4% %|49t|%5$.0f %|62t|%6$.0f %|75t|%7%") % it.first.stepName %
+                   it.second->getCallCount() % counters.nmalloc % counters.nfree % allocated % net %
+                   it.first.compName);
+    }
+    if(counter>0) {
+      ATH_MSG_INFO("=======================================================================================");
+    }
+  }
+}
+
+/*
+ * Report component-level hardware counter information to log
+ */
+void PerfMonMTSvc::report2Log_PerfEventLevel() {
+  using boost::format;
+
+  ATH_MSG_INFO("=======================================================================================");
+  ATH_MSG_INFO("                         Component Level Hardware Counters                             ");
+  ATH_MSG_INFO("=======================================================================================");
+
+  ATH_MSG_INFO(format("%1% %|15t|%2% %|25t|%3% %|37t|%4% %|49t|%5% %|55t|%6% %|66t|%7% %|77t|%8%") % "Step" %
+               "Count" % "Cycles [M]" % "Instr [M]" % "IPC" % "LLC-M [k]" % "Br-M [k]" % "Component");
+
+  ATH_MSG_INFO("---------------------------------------------------------------------------------------");
+
+  // The data was aggregated over the slots and divided into steps by report()
+  for (const auto& vec_itr : m_stdoutVec_serial) {
+    // Sort the results by the number of cycles
+    std::vector<std::pair<PMonMT::StepComp, PMonMT::ComponentData*>> pairs(vec_itr.begin(), vec_itr.end());
+
+    sort(pairs.begin(), pairs.end(),
+         [=](std::pair<PMonMT::StepComp, PMonMT::ComponentData*>& a,
+             std::pair<PMonMT::StepComp, PMonMT::ComponentData*>& b) {
+           return a.second->getDeltaPerfCounters().cycles > b.second->getDeltaPerfCounters().cycles;
+         });
+
+    int counter = 0;
+    for (const auto& it : pairs) {
+      // Only write out a certian number of components
+      if (counter >= m_printNComps) {
+        break;
+      }
+      counter++;
+
+      const PMonMT::PerfEventCounters& counters = it.second->getDeltaPerfCounters();
+      const double ipc = counters.cycles > 0 ? static_cast<double>(counters.instructions) / counters.cycles : 0.;
+
+      ATH_MSG_INFO(format("%1% %|15t|%2% %|25t|%3$.1f %|37t|%4$.1f %|49t|%5$.2f %|55t|%6$.1f %|66t|%7$.1f %|77t|%8%") %
+                   it.first.stepName % it.second->getCallCount() % (counters.cycles * 1e-6) %
+                   (counters.instructions * 1e-6) % ipc % (counters.llc_misses * 1e-3) %
+                   (counters.branch_misses * 1e-3) % it.first.compName);
+    }
+    if(counter>0) {
+      ATH_MSG_INFO("=======================================================================================");
+    }
+  }
+}
+
+/*
+ * Report the critical path through the event data flow to log
+ */
+void PerfMonMTSvc::report2Log_CriticalPath() {
+  using boost::format;
+
+  // The data flow is collected by report
+  if (!m_isDataFlowAnalysed) {
+    return;
+  }
+
+  ATH_MSG_INFO("=======================================================================================");
+  ATH_MSG_INFO("                                Critical Path Analysis                                 ");
+  ATH_MSG_INFO("          (Using the mean execution time of the algorithms after the first event)      ");
+  ATH_MSG_INFO("=======================================================================================");
+
+  ATH_MSG_INFO(format("%1% %|15t|%2% %|30t|%3%") % "Start [ms]" % "Time [ms]" % "Algorithm");
+
+  ATH_MSG_INFO("---------------------------------------------------------------------------------------");
+
+  const std::vector<PMonMT::DataFlowGraph::Node>& nodes = m_dataFlow.nodes();
+  for (size_t idx : m_dataFlow.criticalPath()) {
+    ATH_MSG_INFO(format("%1$.2f %|15t|%2$.2f %|30t|%3%") % nodes[idx].earliestStart % nodes[idx].time %
+                 nodes[idx].name);
+  }
+
+  ATH_MSG_INFO("***************************************************************************************");
+
+  // Upper limits on the throughput: all threads busy, all slots busy
+  // for the length of the critical path, and each non-reentrant algorithm
+  // busy in all of its clones
+  const double length = m_dataFlow.criticalPathLength();
+  const double total = m_dataFlow.totalTime();
+  const double threadLimit = total > 0 ? m_numberOfThreads * 1000. / total : 0;
+  const double slotLimit = length > 0 ? m_numberOfSlots * 1000. / length : 0;
+
+  ATH_MSG_INFO(format("%1% %|45t|%2$.2f ") % "Critical path per event [ms]:" % length);
+  ATH_MSG_INFO(format("%1% %|45t|%2$.2f ") % "Algorithm time per event [ms]:" % total);
+  ATH_MSG_INFO(format("%1% %|45t|%2$.2f ") % "Parallelism within an event:" % (length > 0 ? total / length : 0));
+  ATH_MSG_INFO(format("%1% %|45t|%2$.3f ") % "Max. events per second from threads:" % threadLimit);
+  ATH_MSG_INFO(format("%1% %|45t|%2$.3f ") % "Max. events per second from slots:" % slotLimit);
+
+  std::vector<std::pair<double, size_t>> serialising;
+  for (size_t idx = 0; idx < nodes.size(); ++idx) {
+    if (nodes[idx].cardinality == 0 || nodes[idx].time <= 0) continue;
+    const double limit = nodes[idx].cardinality * 1000. / nodes[idx].time;
+    if (limit < threadLimit) {
+      serialising.emplace_back(limit, idx);
+    }
+  }
+  std::sort(serialising.begin(), serialising.end());
+
+  if (!serialising.empty()) {
+    ATH_MSG_INFO("***************************************************************************************");
+    ATH_MSG_INFO("  >> Algorithms limiting the throughput below the thread limit:");
+    ATH_MSG_INFO(format("%1% %|15t|%2% %|30t|%3% %|45t|%4%") % "Max. evt/s" % "Time [ms]" % "Cardinality" %
+                 "Algorithm");
+    int counter = 0;
+    for (const auto& it : serialising) {
+      // Only write out a certian number of components
+      if (counter >= m_printNComps) {
+        break;
+      }
+      counter++;
+
+      const PMonMT::DataFlowGraph::Node& node = nodes[it.second];
+      ATH_MSG_INFO(format("%1$.3f %|15t|%2$.2f %|30t|%3% %|45t|%4%") % it.first % node.time % node.cardinality %
+                   node.name);
+    }
+  }
+
+  ATH_MSG_INFO("=======================================================================================");
+}
+
 /*
  * Report event-level information to log as we capture it
  */
@@ -632,6 +898,9 @@ void PerfMonMTSvc::report2Log_EnvInfo() const {
 
   ATH_MSG_INFO(format("%1% %|35t|%2% ") % "Malloc Library:" % path(PMonSD::symb2lib("malloc")).filename().string());
   ATH_MSG_INFO(format("%1% %|35t|%2% ") % "Math Library:" % path(PMonSD::symb2lib("atan2")).filename().string());
+  if (m_doMallocMonitoring) {
+    ATH_MSG_INFO(format("%1% %|35t|%2% ") % "Malloc Hooks:" % m_mallocHooksBackend);
+  }
 
   ATH_MSG_INFO("=======================================================================================");
 
@@ -653,6 +922,9 @@ void PerfMonMTSvc::report2JsonFile() {
   if (m_doEventLoopMonitoring) {
     report2JsonFile_EventLevel(j);  // Event-level
   }
+  if (m_isDataFlowAnalysed) {
+    report2JsonFile_DataFlow(j);  // Data flow
+  }
 
   // Write and close the JSON file
   std::ofstream o(m_jsonFileName);
@@ -741,10 +1013,15 @@ void PerfMonMTSvc::report2JsonFile_Summary(nlohmann::json& j) const {
 
   j["summary"]["envInfo"] = {{"mallocLib", mallocLib},
                              {"mathLib", mathLib}};
+  if (m_doMallocMonitoring) {
+    j["summary"]["envInfo"]["mallocHooks"] = m_mallocHooksBackend;
+  }
 
   // Report CPU utilization efficiency;
   const int cpuUtilEff = getCpuEfficiency();
-  j["summary"]["misc"] = {{"cpuUtilEff", cpuUtilEff}};
+  j["summary"]["misc"] = {{"cpuUtilEff", cpuUtilEff},
+                          {"nThreads", m_numberOfThreads.value()},
+                          {"nSlots", m_numberOfSlots.value()}};
 
 }
 
@@ -767,6 +1044,24 @@ void PerfMonMTSvc::report2JsonFile_ComponentLevel(nlohmann::json& j) const {
                                               {"wallTime", wallTime},
                                               {"vmem", vmem},
                                               {"malloc", mall}};
+
+      // Allocations, in kB to match the other memory measurements
+      if (m_doMallocMonitoring) {
+        const PMonMT::MallocCounters& counters = meas.second->getDeltaMallocCounters();
+        j["componentLevel"][step][component]["nMalloc"] = counters.nmalloc;
+        j["componentLevel"][step][component]["nFree"] = counters.nfree;
+        j["componentLevel"][step][component]["mallocAlloc"] = counters.allocated / 1024.;
+        j["componentLevel"][step][component]["mallocFree"] = counters.freed / 1024.;
+      }
+
+      // Hardware counters
+      if (m_doPerfEventMonitoring) {
+        const PMonMT::PerfEventCounters& counters = meas.second->getDeltaPerfCounters();
+        j["componentLevel"][step][component]["cycles"] = counters.cycles;
+        j["componentLevel"][step][component]["instructions"] = counters.instructions;
+        j["componentLevel"][step][component]["llcMisses"] = counters.llc_misses;
+        j["componentLevel"][step][component]["branchMisses"] = counters.branch_misses;
+      }
     }
 
   }
@@ -806,6 +1101,84 @@ PMonMT::StepComp PerfMonMTSvc::generate_state(const std::string& stepName, const
   return currentState;
 }
 
+void PerfMonMTSvc::report2JsonFile_DataFlow(nlohmann::json& j) const {
+
+  for (const PMonMT::DataFlowGraph::Node& node : m_dataFlow.nodes()) {
+    j["dataFlow"][node.name] = {{"inputs", node.inputs},
+                                {"outputs", node.outputs},
+                                {"cardinality", node.cardinality}};
+  }
+
+}
+
+/*
+ * Build the data flow graph of the event algorithms
+ */
+void PerfMonMTSvc::collectDataFlow() {
+  // Mean wall time per execution, the first event is not included
+  std::map<std::string, double> meanTimes;
+  for (const auto& it : m_compLevelDataMap_evt) {
+    if (it.second->getCallCount() > 0) {
+      meanTimes[it.first.compName] = it.second->getDeltaWall() / it.second->getCallCount();
+    }
+  }
+
+  SmartIF<IAlgManager> algMgr(serviceLocator());
+  if (!algMgr) {
+    ATH_MSG_WARNING("Could not retrieve the algorithm manager, the critical path is not computed");
+    return;
+  }
+
+  for (IAlgorithm* alg : algMgr->getAlgorithms()) {
+    // Sequences only steer the control flow
+    if (alg->isSequence()) continue;
+    // Only the algorithms that ran in the event loop
+    auto itr = meanTimes.find(alg->name());
+    if (itr == meanTimes.end()) continue;
+
+    std::vector<std::string> inputs, outputs;
+    if (const IDataHandleHolder* holder = dynamic_cast<const IDataHandleHolder*>(alg)) {
+      for (const DataObjID& obj : holder->inputDataObjs()) inputs.push_back(obj.fullKey());
+      for (const DataObjID& obj : holder->outputDataObjs()) outputs.push_back(obj.fullKey());
+    }
+    // The data object collections are unordered
+    std::sort(inputs.begin(), inputs.end());
+    std::sort(outputs.begin(), outputs.end());
+
+    m_dataFlow.addNode(alg->name(), itr->second, alg->cardinality(), inputs, outputs);
+  }
+
+  m_isDataFlowAnalysed = m_dataFlow.analyse();
+  if (!m_isDataFlowAnalysed) {
+    ATH_MSG_WARNING("The data flow of the event algorithms has a cycle, the critical path is not computed");
+  }
+}
+
+/*
+ * Write the algorithm priorities to JSON
+ */
+void PerfMonMTSvc::writeSchedulingHints() const {
+  nlohmann::json j;
+
+  const std::vector<PMonMT::DataFlowGraph::Node>& nodes = m_dataFlow.nodes();
+  j["criticalPathLength"] = m_dataFlow.criticalPathLength();
+  for (size_t idx : m_dataFlow.criticalPath()) {
+    j["criticalPath"].push_back(nodes[idx].name);
+  }
+
+  // Algorithms with the longest remaining path are scheduled first
+  unsigned int rank = 0;
+  for (size_t idx : m_dataFlow.priorityOrder()) {
+    j["priorities"][nodes[idx].name] = {{"rank", rank++},
+                                        {"bottomLevel", nodes[idx].bottomLevel},
+                                        {"slack", nodes[idx].slack}};
+  }
+
+  std::ofstream o(m_schedulingHintsFile);
+  o << std::setw(4) << j << std::endl;
+  ATH_MSG_INFO("Wrote the scheduling hints into " << m_schedulingHintsFile.toString());
+}
+
 /*
  * Aggregate component-level data from all slots
  */
@@ -822,6 +1195,8 @@ void PerfMonMTSvc::aggregateSlotData() {
         m_compLevelDataMap[it.first]->add2DeltaWall(it.second->getDeltaWall());
         m_compLevelDataMap[it.first]->add2DeltaVmem(it.second->getDeltaVmem());
         m_compLevelDataMap[it.first]->add2DeltaMalloc(it.second->getDeltaMalloc());
+        m_compLevelDataMap[it.first]->add2DeltaMallocCounters(it.second->getDeltaMallocCounters());
+        m_compLevelDataMap[it.first]->add2DeltaPerfCounters(it.second->getDeltaPerfCounters());
       }
       // Do a quick consistency check here and print any suspicious measurements.
       // Timing measurements should always be positive definite
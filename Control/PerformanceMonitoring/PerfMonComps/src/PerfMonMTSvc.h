@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /*
@@ -21,6 +21,7 @@
 
 // PerfMonComps includes
 #include "LinFitSglPass.h"
+#include "PerfMonMTDataFlow.h"
 #include "PerfMonMTUtils.h"
 
 // Containers
@@ -79,6 +80,9 @@ class PerfMonMTSvc : virtual public IPerfMonMTSvc, virtual public IIncidentListe
   void report2Log();
   void report2Log_Description() const;
   void report2Log_ComponentLevel();
+  void report2Log_MallocLevel();
+  void report2Log_PerfEventLevel();
+  void report2Log_CriticalPath();
   void report2Log_EventLevel_instant() const;
   void report2Log_EventLevel();
   void report2Log_Summary();  // make it const
@@ -90,6 +94,11 @@ class PerfMonMTSvc : virtual public IPerfMonMTSvc, virtual public IIncidentListe
   void report2JsonFile_Summary(nlohmann::json& j) const;
   void report2JsonFile_ComponentLevel(nlohmann::json& j) const;
   void report2JsonFile_EventLevel(nlohmann::json& j) const;
+  void report2JsonFile_DataFlow(nlohmann::json& j) const;
+
+  /// Critical path analysis
+  void collectDataFlow();
+  void writeSchedulingHints() const;
 
   /// A few helper functions
   void aggregateSlotData();
@@ -124,6 +133,25 @@ class PerfMonMTSvc : virtual public IPerfMonMTSvc, virtual public IIncidentListe
       this, "doComponentLevelMonitoring", false,
       "True if component level monitoring is enabled, false o/w. Component monitoring may cause a decrease in the "
       "performance due to the usage of locks."};
+  /// Do allocation monitoring
+  Gaudi::Property<bool> m_doMallocMonitoring{
+      this, "doMallocMonitoring", false,
+      "True if the number and size of the heap allocations of each component are counted, false o/w. "
+      "Requires component level monitoring, and tcmalloc or a glibc version that provides malloc hooks."};
+  /// Do hardware counter monitoring
+  Gaudi::Property<bool> m_doPerfEventMonitoring{
+      this, "doPerfEventMonitoring", false,
+      "True if the cycles, instructions, last level cache misses and branch misses of each component are counted "
+      "with perf_event_open, false o/w. Requires component level monitoring."};
+  /// Do critical path analysis
+  Gaudi::Property<bool> m_doCriticalPathAnalysis{
+      this, "doCriticalPathAnalysis", false,
+      "True if the critical path through the data flow of the event algorithms is computed from their mean "
+      "execution times, false o/w. Requires component level monitoring."};
+  /// Name of the scheduling hints file
+  Gaudi::Property<std::string> m_schedulingHintsFile{
+      this, "schedulingHintsFile", "",
+      "Name of the JSON file with the algorithm priorities from the critical path analysis, not written if empty."};
   /// Report results to JSON
   Gaudi::Property<bool> m_reportResultsToJSON{this, "reportResultsToJSON", true, "Report results into the json file."};
   /// Name of the JSON file
@@ -208,6 +236,13 @@ class PerfMonMTSvc : virtual public IPerfMonMTSvc, virtual public IIncidentListe
 
   std::vector<data_map_t> m_stdoutVec_serial;
 
+  // Data flow of the event algorithms, weighted by their mean execution time
+  PMonMT::DataFlowGraph m_dataFlow;
+  bool m_isDataFlowAnalysed{false};
+
+  // Allocator whose hooks are used for allocation monitoring
+  std::string m_mallocHooksBackend;
+
   // Leak estimates
   PerfMon::LinFitSglPass m_fit_vmem;
   PerfMon::LinFitSglPass m_fit_pss;
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /*
@@ -14,6 +14,8 @@
 
 // PerfMon includes
 #include "SemiDetMisc.h"   // borrow from existing code
+#include "PerfMonMTMallocHooks.h"
+#include "PerfMonMTPerfEvents.h"
 #include "PerfMonEvent/mallinfo.h"
 
 // STL includes
@@ -71,6 +73,8 @@ namespace PMonMT {
     // Variables to store measurements
     double cpu_time{}, wall_time{}; // Timing
     double vmem{}, malloc{}; // Memory: Vmem, Malloc
+    MallocCounters malloc_counters; // Allocations of the current thread
+    PerfEventCounters perf_counters; // Hardware counters of the current thread
 
     // Capture component-level measurements
     void capture() {
@@ -89,6 +93,16 @@ namespace PMonMT {
       return true;  // dummy return value for use with thread-checker macros
     }
 
+    // Capture the allocation counters of the current thread
+    void capture_malloc_counters() {
+      malloc_counters = MallocHooks::threadCounters();
+    }
+
+    // Capture the hardware counters of the current thread
+    void capture_perf_counters() {
+      perf_counters = PerfEvents::threadCounters();
+    }
+
     // Constructor
     ComponentMeasurement() : cpu_time{0.}, wall_time{0.}, vmem{0.}, malloc{0.} { }
 
@@ -103,14 +117,23 @@ namespace PMonMT {
     double m_tmp_wall{}, m_delta_wall{};
     double m_tmp_vmem{}, m_delta_vmem{};
     double m_tmp_malloc{}, m_delta_malloc{};
+    MallocCounters m_tmp_malloc_counters{}, m_delta_malloc_counters{};
+    PerfEventCounters m_tmp_perf_counters{}, m_delta_perf_counters{};
 
     // [Component Level Monitoring] : Start
-    void addPointStart(const ComponentMeasurement& meas, const bool doMem = false) {
+    void addPointStart(const ComponentMeasurement& meas, const bool doMem = false, const bool doMalloc = false,
+                       const bool doPerf = false) {
 
       // Timing
       m_tmp_cpu = meas.cpu_time;
       m_tmp_wall = meas.wall_time;
 
+      // Allocations if only necessary
+      if (doMalloc) m_tmp_malloc_counters = meas.malloc_counters;
+
+      // Hardware counters if only necessary
+      if (doPerf) m_tmp_perf_counters = meas.perf_counters;
+
       // Memory if only necessary
       if (!doMem) return;
 
@@ -121,7 +144,8 @@ namespace PMonMT {
     }
 
     // [Component Level Monitoring] : Stop
-    void addPointStop(const ComponentMeasurement& meas, const bool doMem = false) {
+    void addPointStop(const ComponentMeasurement& meas, const bool doMem = false, const bool doMalloc = false,
+                      const bool doPerf = false) {
 
       // Call count
       m_call_count++;
@@ -130,6 +154,25 @@ namespace PMonMT {
       m_delta_cpu += meas.cpu_time - m_tmp_cpu;
       m_delta_wall += meas.wall_time - m_tmp_wall;
 
+      // Allocations if only necessary
+      if (doMalloc) {
+        m_delta_malloc_counters.nmalloc += meas.malloc_counters.nmalloc - m_tmp_malloc_counters.nmalloc;
+        m_delta_malloc_counters.nfree += meas.malloc_counters.nfree - m_tmp_malloc_counters.nfree;
+        m_delta_malloc_counters.allocated += meas.malloc_counters.allocated - m_tmp_malloc_counters.allocated;
+        m_delta_malloc_counters.freed += meas.malloc_counters.freed - m_tmp_malloc_counters.freed;
+      }
+
+      // Hardware counters if only necessary
+      if (doPerf) {
+        // Multiplexed counters are scaled estimates, which can decrease when the scaling changes:
+        // such a difference is counted as zero rather than wrapping around
+        auto delta = [](uint64_t stop, uint64_t start) -> uint64_t { return stop > start ? stop - start : 0; };
+        m_delta_perf_counters.cycles += delta(meas.perf_counters.cycles, m_tmp_perf_counters.cycles);
+        m_delta_perf_counters.instructions += delta(meas.perf_counters.instructions, m_tmp_perf_counters.instructions);
+        m_delta_perf_counters.llc_misses += delta(meas.perf_counters.llc_misses, m_tmp_perf_counters.llc_misses);
+        m_delta_perf_counters.branch_misses += delta(meas.perf_counters.branch_misses, m_tmp_perf_counters.branch_misses);
+      }
+
       // Memory if only necessary
       if (!doMem) return;
 
@@ -155,6 +198,22 @@ namespace PMonMT {
     double getDeltaMalloc() const { return m_delta_malloc; }
     void add2DeltaMalloc(double val) { m_delta_malloc += val; }
 
+    const MallocCounters& getDeltaMallocCounters() const { return m_delta_malloc_counters; }
+    void add2DeltaMallocCounters(const MallocCounters& val) {
+      m_delta_malloc_counters.nmalloc += val.nmalloc;
+      m_delta_malloc_counters.nfree += val.nfree;
+      m_delta_malloc_counters.allocated += val.allocated;
+      m_delta_malloc_counters.freed += val.freed;
+    }
+
+    const PerfEventCounters& getDeltaPerfCounters() const { return m_delta_perf_counters; }
+    void add2DeltaPerfCounters(const PerfEventCounters& val) {
+      m_delta_perf_counters.cycles += val.cycles;
+      m_delta_perf_counters.instructions += val.instructions;
+      m_delta_perf_counters.llc_misses += val.llc_misses;
+      m_delta_perf_counters.branch_misses += val.branch_misses;
+    }
+
     // Constructor
     ComponentData() : m_call_count{0}, m_tmp_cpu{0.}, m_delta_cpu{0.}, m_tmp_wall{0.}, m_delta_wall{0.},
       m_tmp_vmem{0.}, m_delta_vmem{0.}, m_tmp_malloc{0.}, m_delta_malloc{0.} { }
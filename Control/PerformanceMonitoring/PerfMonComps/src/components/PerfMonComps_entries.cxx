@@ -7,6 +7,8 @@
 
 #include "../PerfMonMTSvc.h"
 #include "../PerfMonMTAuditor.h"
+#include "../EventTraceSvc.h"
+#include "../EventTraceAuditor.h"
   
 DECLARE_COMPONENT( PerfMonSvc )
 DECLARE_COMPONENT( Athena::PerfMonAuditor )
@@ -18,3 +20,6 @@ DECLARE_COMPONENT( PerfMon::StorePayloadMon )
 
 DECLARE_COMPONENT( PerfMonMTSvc )
 DECLARE_COMPONENT( PerfMonMTAuditor )
+
+DECLARE_COMPONENT( EventTraceSvc )
+DECLARE_COMPONENT( EventTraceAuditor )
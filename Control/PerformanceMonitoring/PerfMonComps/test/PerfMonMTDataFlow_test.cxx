@@ -0,0 +1,101 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file PerfMonComps/test/PerfMonMTDataFlow_test.cxx
+ * @date Oct, 2026
+ * @brief Unit test for the critical path analysis of PerfMonMTSvc.
+ */
+
+
+#undef NDEBUG
+#include "../src/PerfMonMTDataFlow.h"
+#include <cassert>
+#include <iostream>
+
+
+using PMonMT::DataFlowGraph;
+
+
+// A -> B -> D, A -> C -> D, and two independent algorithms, one of them
+// reading an object that no algorithm produces.
+void test1()
+{
+  std::cout << "test1\n";
+
+  DataFlowGraph g;
+  g.addNode ("A", 2, 1, {}, {"a"});
+  g.addNode ("B", 5, 1, {"a"}, {"b"});
+  g.addNode ("C", 1, 0, {"a"}, {"c"});
+  g.addNode ("D", 3, 1, {"b", "c"}, {"d"});
+  g.addNode ("E", 4, 1, {}, {"e"});
+  g.addNode ("F", 1, 1, {"x"}, {});
+  assert (g.analyse());
+
+  const std::vector<DataFlowGraph::Node>& nodes = g.nodes();
+  assert (nodes.size() == 6);
+  assert (nodes[0].children == (std::vector<size_t>{1, 2}));
+  assert (nodes[3].parents == (std::vector<size_t>{1, 2}));
+  assert (nodes[5].parents.empty());
+
+  assert (g.criticalPath() == (std::vector<size_t>{0, 1, 3}));
+  assert (g.criticalPathLength() == 10);
+  assert (g.totalTime() == 16);
+
+  const double earliestStart[] = {0, 2, 2, 7, 0, 0};
+  const double bottomLevel[] = {10, 8, 4, 3, 4, 1};
+  const double slack[] = {0, 0, 4, 0, 6, 9};
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    assert (nodes[i].earliestStart == earliestStart[i]);
+    assert (nodes[i].bottomLevel == bottomLevel[i]);
+    assert (nodes[i].slack == slack[i]);
+  }
+
+  // Ties keep the order of the nodes
+  assert (g.priorityOrder() == (std::vector<size_t>{0, 1, 2, 4, 3, 5}));
+}
+
+
+// Several producers of the same object, an algorithm reading its own output,
+// and negative times.
+void test2()
+{
+  std::cout << "test2\n";
+
+  DataFlowGraph g;
+  g.addNode ("A", 2, 1, {}, {"a"});
+  g.addNode ("Decorator", 6, 1, {"a", "a.dec"}, {"a", "a.dec"});
+  g.addNode ("B", 1, 1, {"a", "a.dec"}, {});
+  g.addNode ("Negative", -1, 1, {}, {});
+  assert (g.analyse());
+
+  const std::vector<DataFlowGraph::Node>& nodes = g.nodes();
+  assert (nodes[1].parents == (std::vector<size_t>{0}));
+  assert (nodes[2].parents == (std::vector<size_t>{0, 1}));
+  assert (nodes[3].time == 0);
+  assert (g.criticalPath() == (std::vector<size_t>{0, 1, 2}));
+  assert (g.criticalPathLength() == 9);
+}
+
+
+// A cycle in the data flow.
+void test3()
+{
+  std::cout << "test3\n";
+
+  DataFlowGraph g;
+  g.addNode ("A", 1, 1, {}, {"a"});
+  g.addNode ("X", 1, 1, {"a", "y"}, {"x"});
+  g.addNode ("Y", 1, 1, {"x"}, {"y"});
+  assert (!g.analyse());
+}
+
+
+int main()
+{
+  std::cout << "PerfMonComps/PerfMonMTDataFlow_test\n";
+  test1();
+  test2();
+  test3();
+  return 0;
+}
@@ -0,0 +1,43 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef PERMONKERNEL_IEVENTTRACESVC_H
+#define PERMONKERNEL_IEVENTTRACESVC_H
+
+/// STL includes
+#include <string>
+
+/// Framework include
+#include "GaudiKernel/IService.h"
+
+/// Service recording a timeline of the component executions in a job
+class IEventTraceSvc : virtual public IService
+{
+
+  public:
+
+    /// Framework - Service InterfaceID
+    static const InterfaceID& interfaceID();
+
+    /// Start of a traced step of a component in the current thread
+    virtual void startTrace( const std::string& stepName,
+                             const std::string& compName ) = 0;
+
+    /// End of a traced step of a component in the current thread
+    virtual void stopTrace( const std::string& stepName,
+                            const std::string& compName ) = 0;
+
+
+}; // class IEventTraceSvc
+
+///////////////////////////////////////////////////////////////////
+// Inline methods:
+///////////////////////////////////////////////////////////////////
+inline const InterfaceID& IEventTraceSvc::interfaceID()
+{
+  static const InterfaceID IID_IEventTraceSvc("IEventTraceSvc", 1, 0);
+  return IID_IEventTraceSvc;
+}
+
+#endif // PERMONKERNEL_IEVENTTRACESVC_H
@@ -1,7 +1,7 @@
 // This file's extension implies that it's C, but it's really -*- C++ -*-.
 
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef SGTOOLS_DATAPROXY_H
@@ -15,11 +15,14 @@
 #include <memory>
 #include <mutex>
 #include <atomic>
+#include <cstddef>
+#include <new>
 #include "GaudiKernel/IRegistry.h"
 #include "GaudiKernel/ClassID.h"
 #include "AthenaKernel/getMessageSvc.h" /*Athena::IMessageSvcHolder*/
 #include "AthenaKernel/IRegisterTransient.h"
 #include "SGTools/TransientAddress.h"
+#include "SGTools/IProxyAllocator.h"
 #include "SGTools/exceptions.h"
 #include "CxxUtils/checker_macros.h"
 
@@ -83,6 +86,24 @@ class DataStore;
     // Destructor
     virtual ~DataProxy();
 
+    ///\name Allocation
+    /// A proxy may be allocated from the heap as usual, or from
+    /// a pooled allocator with @c new(alloc) DataProxy(...).
+    /// In either case, @c delete returns the memory to where it came from.
+    /// Only pooled proxies carry a header remembering their allocator;
+    /// heap proxies are allocated with plain @c ::operator new.
+    //@{
+    /// Extra space needed in front of a pooled proxy to remember its allocator.
+    static constexpr size_t allocHeaderSize = alignof(std::max_align_t);
+    static void* operator new (size_t sz);
+    static void* operator new (size_t sz, IProxyAllocator& alloc);
+    /// Destroys the proxy, then frees it according to m_pooled.
+    static void operator delete (DataProxy* p, std::destroying_delete_t);
+    /// Called if a constructor throws.
+    static void operator delete (void* p);
+    static void operator delete (void* p, IProxyAllocator& alloc);
+    //@}
+
     ///\name IRegistry implementation
     //@{
     /// Add reference to object
@@ -350,6 +371,9 @@ class DataStore;
     /// errno-style error code for accessData
     enum ErrNo m_errno;
 
+    /// True if allocated with @c new(alloc), so preceded by the allocator header.
+    bool m_pooled;
+
     
     /**
      * @brief Lock the data object we're holding, if any.
@@ -446,7 +470,8 @@ class DataStore;
 // DP+128: IMessageSvc* m_ims
 // DP+130: std::atomic<IProxyDict*> m_store
 // DP+138: ErrNo m_errno
-// DP+13c: padding
+// DP+13c: bool m_pooled
+// DP+13d: padding
 // DP+140: end
 
 
@@ -0,0 +1,60 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file SGTools/IProxyAllocator.h
+ * @date Oct, 2026
+ * @brief Interface for pooled allocation of DataProxy objects.
+ */
+
+
+#ifndef SGTOOLS_IPROXYALLOCATOR_H
+#define SGTOOLS_IPROXYALLOCATOR_H
+
+
+#include <cstddef>
+
+
+namespace SG {
+
+
+/**
+ * @brief Interface for pooled allocation of DataProxy objects.
+ *
+ * A store may create its proxies with
+ *@code
+ *   new (alloc) DataProxy (...)
+ @endcode
+ * rather than taking them from the system heap.  DataProxy remembers
+ * the allocator from which it came, so a proxy allocated this way
+ * is returned to the right place by the usual @c release / @c delete.
+ * Since proxies may be released from any thread, @c deallocate must
+ * be thread-safe.  The allocator must also stay alive until
+ * the last proxy taken from it has been returned.
+ */
+class IProxyAllocator
+{
+public:
+  virtual ~IProxyAllocator() = default;
+
+
+  /**
+   * @brief Allocate memory for a proxy.
+   * @param sz Number of bytes required.
+   */
+  virtual void* allocate (size_t sz) = 0;
+
+
+  /**
+   * @brief Return memory obtained from @c allocate.
+   * @param p The memory to release.
+   */
+  virtual void deallocate (void* p) = 0;
+};
+
+
+} // namespace SG
+
+
+#endif // not SGTOOLS_IPROXYALLOCATOR_H
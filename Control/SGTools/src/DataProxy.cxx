@@ -1,10 +1,12 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include <algorithm> 
 
 #include <cassert>
+#include <cstddef>
+#include <new>
 #include <stdexcept>
 
 #include "AthenaKernel/IResetable.h"
@@ -42,6 +44,23 @@ namespace SG {
 
 namespace {
 
+/// Space reserved in front of a pooled proxy to remember the allocator
+/// from which it came.  Keeps the proxy aligned.
+constexpr size_t proxyHeaderSize = DataProxy::allocHeaderSize;
+static_assert (proxyHeaderSize >= sizeof (SG::IProxyAllocator*));
+
+/// Set by the pooled operator new, and picked up by the constructor
+/// that follows it on the same thread.
+thread_local bool pooledNew = false;
+
+/// Return (and clear) the flag set by the pooled operator new.
+bool takePooledNew()
+{
+  bool pooled = pooledNew;
+  pooledNew = false;
+  return pooled;
+}
+
 class PushStore
 {
 public:
@@ -98,7 +117,8 @@ DataProxy::DataProxy():
   m_dataLoader(nullptr),
   m_t2p(nullptr),
   m_store(nullptr),
-  m_errno(ALLOK)
+  m_errno(ALLOK),
+  m_pooled(takePooledNew())
 { 
 }
 
@@ -137,7 +157,8 @@ DataProxy::DataProxy(TransientAddress&& tAddr,
   m_dataLoader(svc),
   m_t2p(nullptr),
   m_store(nullptr),
-  m_errno(ALLOK)
+  m_errno(ALLOK),
+  m_pooled(takePooledNew())
 {
   //assert( tAddr->clID() != 0 );
   if (svc) svc->addRef();
@@ -158,7 +179,8 @@ DataProxy::DataProxy(DataObject* dObject,
   m_dataLoader(nullptr),
   m_t2p(nullptr),
   m_store(nullptr),
-  m_errno(ALLOK)
+  m_errno(ALLOK),
+  m_pooled(takePooledNew())
 {
   setObject(dObject);
   delete tAddr;
@@ -177,7 +199,8 @@ DataProxy::DataProxy(DataObject* dObject,
   m_dataLoader(nullptr),
   m_t2p(nullptr),
   m_store(nullptr),
-  m_errno(ALLOK)
+  m_errno(ALLOK),
+  m_pooled(takePooledNew())
 {
   setObject(dObject);
 }
@@ -188,6 +211,55 @@ DataProxy::~DataProxy()
   finalReset();
 }
 
+
+/// Allocate a proxy from the heap.
+void* DataProxy::operator new (size_t sz)
+{
+  pooledNew = false;
+  return ::operator new (sz);
+}
+
+
+/// Allocate a proxy from a pooled allocator.
+void* DataProxy::operator new (size_t sz, IProxyAllocator& alloc)
+{
+  void* p = alloc.allocate (sz + proxyHeaderSize);
+  if (!p) throw std::bad_alloc();
+  *static_cast<IProxyAllocator**> (p) = &alloc;
+  pooledNew = true;
+  return static_cast<char*> (p) + proxyHeaderSize;
+}
+
+
+/// Destroy a proxy and return it to the heap or allocator from which it came.
+void DataProxy::operator delete (DataProxy* p, std::destroying_delete_t)
+{
+  const bool pooled = p->m_pooled;
+  p->~DataProxy();
+  if (pooled) {
+    void* base = reinterpret_cast<char*> (p) - proxyHeaderSize;
+    (*static_cast<IProxyAllocator**> (base))->deallocate (base);
+  }
+  else {
+    ::operator delete (p);
+  }
+}
+
+
+/// Called if a constructor throws after a heap allocation.
+void DataProxy::operator delete (void* p)
+{
+  ::operator delete (p);
+}
+
+
+/// Called if a constructor throws after a pooled allocation.
+void DataProxy::operator delete (void* p, IProxyAllocator& alloc)
+{
+  pooledNew = false;
+  alloc.deallocate (static_cast<char*> (p) - proxyHeaderSize);
+}
+
 void DataProxy::setT2p(T2pMap* t2p)
 {
   lock_t lock (m_mutex);
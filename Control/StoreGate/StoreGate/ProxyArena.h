@@ -0,0 +1,152 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file StoreGate/ProxyArena.h
+ * @date Oct, 2026
+ * @brief Pooled allocator for the DataProxy objects of one store.
+ */
+
+
+#ifndef STOREGATE_PROXYARENA_H
+#define STOREGATE_PROXYARENA_H
+
+
+#include "SGTools/IProxyAllocator.h"
+#include "AthAllocators/ArenaHeapAllocator.h"
+#include <mutex>
+#include <string>
+#include <iosfwd>
+
+
+namespace SG {
+
+
+/**
+ * @brief Pooled allocator for the DataProxy objects of one store.
+ *
+ * When enabled (SGImplSvc property @c UseProxyArena), each store
+ * (so, in MT, each event slot) owns one of these, and the proxies
+ * it creates are taken from it rather than from the system heap.
+ * Proxies released at the end of an event go back onto this pool's
+ * free list, to be reused by the next event in the same slot.  This avoids
+ * contention in malloc between slots and the fragmentation from
+ * many small allocations and frees interleaved between events.
+ *
+ * The pool can't simply be reset in bulk when the slot is cleared:
+ * reset-only proxies persist across events, and proxies may be kept
+ * alive past clearStore by references from links.  Instead, memory
+ * is returned to the system only when the pool is deleted.
+ * The owning store calls @c disown when it no longer needs the pool;
+ * the pool then deletes itself once the last proxy has been returned.
+ *
+ * Allocation and deallocation are protected by a mutex, since proxies
+ * may be released from any thread.  Since each slot has its own pool,
+ * contention on this lock is low.
+ *
+ * We keep track of the maximum number of proxies in use at any one time;
+ * see @c highWater.
+ */
+class ProxyArena
+  : public IProxyAllocator
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param name Name of the pool, to use in reports.
+   * @param nblock Number of proxies to allocate per block.
+   */
+  ProxyArena (const std::string& name, size_t nblock = 512);
+
+
+  ProxyArena (const ProxyArena&) = delete;
+  ProxyArena& operator= (const ProxyArena&) = delete;
+
+
+  /**
+   * @brief Allocate memory for a proxy.
+   * @param sz Number of bytes required.
+   *
+   * Returns nullptr if @c sz is larger than the pool's element size.
+   */
+  virtual void* allocate (size_t sz) override;
+
+
+  /**
+   * @brief Return memory obtained from @c allocate.
+   * @param p The memory to release.
+   */
+  virtual void deallocate (void* p) override;
+
+
+  /**
+   * @brief Called by the owner when it no longer needs the pool.
+   *
+   * The pool will be deleted once all proxies have been returned
+   * (possibly immediately).  The pool must not be referenced by the
+   * owner after this is called.
+   */
+  void disown();
+
+
+  /**
+   * @brief Return the name of the pool.
+   */
+  const std::string& name() const;
+
+
+  /**
+   * @brief Number of proxies currently allocated from the pool.
+   */
+  size_t inuse() const;
+
+
+  /**
+   * @brief Maximum number of proxies allocated at any one time.
+   */
+  size_t highWater() const;
+
+
+  /**
+   * @brief Return the statistics block for the pool.
+   */
+  ArenaAllocatorBase::Stats stats() const;
+
+
+  /**
+   * @brief Generate a report of the memory in use by the pool.
+   * @param os The stream to which to write the report.
+   */
+  void report (std::ostream& os) const;
+
+
+private:
+  /// Only deleted via disown().
+  virtual ~ProxyArena();
+
+  /// Name of the pool.
+  const std::string m_name;
+
+  /// Size of the elements we allocate.
+  const size_t m_eltSize;
+
+  /// Serialize access to the allocator.
+  mutable std::mutex m_mutex;
+  typedef std::lock_guard<std::mutex> lock_t;
+
+  /// The underlying allocator.
+  ArenaHeapAllocator m_alloc;
+
+  /// Maximum number of elements in use at any one time.
+  size_t m_highWater;
+
+  /// Set once the owner has called disown().
+  bool m_disowned;
+};
+
+
+} // namespace SG
+
+
+#endif // not STOREGATE_PROXYARENA_H
@@ -66,6 +66,7 @@ namespace SG {
   class AuxVectorBase;
   class AuxElement;
   class DataStore;
+  class ProxyArena;
 }
 
 class DataObject;
@@ -676,6 +677,10 @@ private:
                           const std::string& key,
                           CLID auxclid) const;
 
+  /// Create a new proxy, from m_proxyArena if it's enabled.
+  template <class... ARGS>
+  SG::DataProxy* makeProxy (ARGS&&... args);
+
 /// Add automatically-made symlinks for DP.
   void addAutoSymLinks (const std::string& key, CLID clid, SG::DataProxy* dp,
                         const std::type_info* tinfo,
@@ -704,6 +709,7 @@ private:
   bool m_DumpStore; ///< Dump Property flag: triggers dump() at EndEvent 
   bool m_ActivateHistory; ///< Activate the history service
   bool m_DumpArena; ///< DumpArena Property flag : trigger m_arena->report() at clearStore
+  bool m_useProxyArena; ///< UseProxyArena Property flag : allocate proxies from m_proxyArena
 
   //  typedef std::list<std::string> StrList; 
   StringArrayProperty m_folderNameList; ///< FolderNameList Property
@@ -721,6 +727,9 @@ private:
   /// Allocation arena to associate with this store.
   SG::Arena m_arena;
 
+  /// Pool from which to allocate our proxies, if UseProxyArena is set.
+  SG::ProxyArena* m_proxyArena;
+
   /// The Hive slot number for this store, or -1 if this isn't a Hive store.
   int m_slotNumber;
 
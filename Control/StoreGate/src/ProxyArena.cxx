@@ -0,0 +1,165 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file StoreGate/src/ProxyArena.cxx
+ * @date Oct, 2026
+ * @brief Pooled allocator for the DataProxy objects of one store.
+ */
+
+
+#include "StoreGate/ProxyArena.h"
+#include "SGTools/DataProxy.h"
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+
+
+namespace {
+
+
+/// Storage for one proxy, including the space DataProxy uses
+/// to remember its allocator.
+struct ProxyStorage
+{
+  alignas(std::max_align_t)
+  char m_data[sizeof (SG::DataProxy) + SG::DataProxy::allocHeaderSize];
+};
+
+
+} // anonymous namespace
+
+
+namespace SG {
+
+
+/**
+ * @brief Constructor.
+ * @param name Name of the pool, to use in reports.
+ * @param nblock Number of proxies to allocate per block.
+ */
+ProxyArena::ProxyArena (const std::string& name, size_t nblock /*= 512*/)
+  : m_name (name),
+    m_eltSize (sizeof (ProxyStorage)),
+    m_alloc (ArenaHeapAllocator::initParams<ProxyStorage, false, true, true>
+             (nblock, name)),
+    m_highWater (0),
+    m_disowned (false)
+{
+}
+
+
+/**
+ * @brief Destructor.  Returns all memory to the system.
+ */
+ProxyArena::~ProxyArena()
+{
+}
+
+
+/**
+ * @brief Allocate memory for a proxy.
+ * @param sz Number of bytes required.
+ *
+ * Returns nullptr if @c sz is larger than the pool's element size.
+ */
+void* ProxyArena::allocate (size_t sz)
+{
+  if (sz > m_eltSize) return nullptr;
+  lock_t lock (m_mutex);
+  void* p = m_alloc.allocate();
+  m_highWater = std::max (m_highWater, m_alloc.stats().elts.inuse);
+  return p;
+}
+
+
+/**
+ * @brief Return memory obtained from @c allocate.
+ * @param p The memory to release.
+ */
+void ProxyArena::deallocate (void* p)
+{
+  bool done = false;
+  {
+    lock_t lock (m_mutex);
+    m_alloc.free (static_cast<ArenaHeapAllocator::pointer> (p));
+    done = m_disowned && m_alloc.stats().elts.inuse == 0;
+  }
+  if (done) delete this;
+}
+
+
+/**
+ * @brief Called by the owner when it no longer needs the pool.
+ *
+ * The pool will be deleted once all proxies have been returned
+ * (possibly immediately).  The pool must not be referenced by the
+ * owner after this is called.
+ */
+void ProxyArena::disown()
+{
+  bool done = false;
+  {
+    lock_t lock (m_mutex);
+    m_disowned = true;
+    done = m_alloc.stats().elts.inuse == 0;
+  }
+  if (done) delete this;
+}
+
+
+/**
+ * @brief Return the name of the pool.
+ */
+const std::string& ProxyArena::name() const
+{
+  return m_name;
+}
+
+
+/**
+ * @brief Number of proxies currently allocated from the pool.
+ */
+size_t ProxyArena::inuse() const
+{
+  lock_t lock (m_mutex);
+  return m_alloc.stats().elts.inuse;
+}
+
+
+/**
+ * @brief Maximum number of proxies allocated at any one time.
+ */
+size_t ProxyArena::highWater() const
+{
+  lock_t lock (m_mutex);
+  return m_highWater;
+}
+
+
+/**
+ * @brief Return the statistics block for the pool.
+ */
+ArenaAllocatorBase::Stats ProxyArena::stats() const
+{
+  lock_t lock (m_mutex);
+  return m_alloc.stats();
+}
+
+
+/**
+ * @brief Generate a report of the memory in use by the pool.
+ * @param os The stream to which to write the report.
+ */
+void ProxyArena::report (std::ostream& os) const
+{
+  lock_t lock (m_mutex);
+  ArenaAllocatorBase::Stats::header (os);
+  os << std::endl;
+  m_alloc.report (os);
+  os << " High-water mark: " << m_highWater << " proxies ("
+     << m_highWater * m_eltSize << " bytes)" << std::endl;
+}
+
+
+} // namespace SG
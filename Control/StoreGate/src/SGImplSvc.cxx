@@ -40,6 +40,7 @@
 #include "PersistentDataModel/DataHeader.h"
 #include "StoreGate/StoreClearedIncident.h"
 #include "AthAllocators/ArenaHeader.h"
+#include "StoreGate/ProxyArena.h"
 #include "CxxUtils/checker_macros.h"
 
 // StoreGateSvc. must come before SGImplSvc.h
@@ -95,10 +96,12 @@ SGImplSvc::SGImplSvc(const string& name,ISvcLocator* svc)
     m_DumpStore(false), 
     m_ActivateHistory(false),
     m_DumpArena(false),
+    m_useProxyArena(false),
     m_pIOVSvc(0),
     m_storeLoaded(false),
     m_remap_impl (new SG::RemapImpl),
     m_arena (name),
+    m_proxyArena (nullptr),
     m_slotNumber(-1),
     m_numSlots(1)
 {
@@ -107,6 +110,8 @@ SGImplSvc::SGImplSvc(const string& name,ISvcLocator* svc)
   declareProperty("Dump", m_DumpStore);
   declareProperty("ActivateHistory", m_ActivateHistory);
   declareProperty("DumpArena", m_DumpArena);
+  declareProperty("UseProxyArena", m_useProxyArena,
+                  "Allocate DataProxy objects from a pool owned by this store.");
   //StoreGateSvc properties
   declareProperty("IncidentSvc", m_pIncSvc);
   //add handler for Service base class property
@@ -124,6 +129,7 @@ SGImplSvc::~SGImplSvc()  {
 
   delete m_pStore;
   delete m_remap_impl;
+  if (m_proxyArena) m_proxyArena->disown();
 }
 
 //////////////////////////////////////////////////////////////
@@ -138,6 +144,8 @@ StatusCode SGImplSvc::initialize()    {
     m_pStore = new DataStore (*this);
   if (!m_remap_impl)
     m_remap_impl = new SG::RemapImpl;
+  if (m_useProxyArena && !m_proxyArena)
+    m_proxyArena = new SG::ProxyArena (name() + "_proxies");
 
   //properties accessible from now on
   
@@ -272,6 +280,17 @@ string SGImplSvc::createKey(const CLID& id)
   string ret(o.str());
   return ret;
 }
+//////////////////////////////////////////////////////////////
+/// Create a new proxy, from m_proxyArena if it's enabled.
+template <class... ARGS>
+DataProxy* SGImplSvc::makeProxy (ARGS&&... args)
+{
+  if (m_proxyArena) {
+    return new (*m_proxyArena) DataProxy (std::forward<ARGS>(args)...);
+  }
+  return new DataProxy (std::forward<ARGS>(args)...);
+}
+
 //////////////////////////////////////////////////////////////
 // clear store
 StatusCode SGImplSvc::clearStore(bool forceRemove)
@@ -282,6 +301,12 @@ StatusCode SGImplSvc::clearStore(bool forceRemove)
       m_arena.report(s);
       info() << "Report for Arena: " << m_arena.name() << '\n'
              << s.str() << endmsg;
+      if (m_proxyArena) {
+        std::ostringstream sp;
+        m_proxyArena->report(sp);
+        info() << "Report for proxy arena: " << m_proxyArena->name() << '\n'
+               << sp.str() << endmsg;
+      }
     }
   }
   {
@@ -329,6 +354,16 @@ StatusCode SGImplSvc::finalize()    {
   m_remap_impl = 0;
   m_arena.erase();
 
+  if (m_proxyArena) {
+    info() << "Proxy arena high-water mark: " << m_proxyArena->highWater()
+           << " proxies; " << m_proxyArena->inuse()
+           << " still referenced at finalize" << endmsg;
+    // Proxies still referenced from elsewhere will return their memory
+    // to the pool when released; it deletes itself after the last one.
+    m_proxyArena->disown();
+    m_proxyArena = nullptr;
+  }
+
   return Service::finalize();
 }
 //////////////////////////////////////////////////////////////
@@ -424,9 +459,9 @@ StatusCode SGImplSvc::recordAddress(const std::string& skey,
   if (0 == dp) 
     {
       // create the proxy object and register it
-      dp = new DataProxy (TransientAddress (dataID, skey,
-                                            pAddress, clearAddressFlag),
-                          m_pDataLoader, true, true);
+      dp = makeProxy (TransientAddress (dataID, skey,
+                                        pAddress, clearAddressFlag),
+                      m_pDataLoader, true, true);
       m_pStore->addToStore(dataID, dp).ignore();
 
       addAutoSymLinks (skey, dataID, dp, 0, false);
@@ -498,9 +533,9 @@ DataProxy* SGImplSvc::setupProxy(const CLID& dataID,
     } 
   } else {
     // Case 2: No Proxy found:
-    dp = new DataProxy(pDObj,
-                       TransientAddress(dataID, gK),
-                       !allowMods, resetOnly);
+    dp = makeProxy(pDObj,
+                   TransientAddress(dataID, gK),
+                   !allowMods, resetOnly);
     if (!(m_pStore->addToStore(dataID, dp).isSuccess())) {
       warning() << " setupProxy:: could not addToStore proxy @" << dp
                 << endmsg;
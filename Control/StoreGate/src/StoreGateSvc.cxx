@@ -40,6 +40,8 @@ StoreGateSvc::StoreGateSvc(const std::string& name,ISvcLocator* svc) :
   declareProperty("Dump", m_DumpStore=false, "Dump contents at EndEvent");
   declareProperty("ActivateHistory", m_ActivateHistory=false, "record DataObjects history");
   declareProperty("DumpArena", m_DumpArena=false, "Dump Arena usage stats");
+  declareProperty("UseProxyArena", m_useProxyArena=false,
+                  "Allocate DataProxy objects from a per-store pool");
   declareProperty("ProxyProviderSvc", m_pPPSHandle);
   declareProperty("IncidentSvc", m_incSvc);
 
@@ -0,0 +1,98 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+/**
+ * @file  StoreGate/test/ProxyArena_test.cxx
+ * @date Oct, 2026
+ * @brief Regression test for ProxyArena.
+ */
+
+
+#undef NDEBUG
+
+#include "StoreGate/ProxyArena.h"
+#include "SGTools/DataProxy.h"
+#include <cassert>
+#include <iostream>
+
+
+// Heap and pooled proxies.
+void test1()
+{
+  std::cout << "test1\n";
+
+  SG::DataProxy* dp0 = new SG::DataProxy;
+  dp0->addRef();
+  assert (dp0->release() == 0);
+
+  SG::ProxyArena* arena = new SG::ProxyArena ("test1", 4);
+  assert (arena->name() == "test1");
+  assert (arena->inuse() == 0);
+  assert (arena->allocate (1000000) == nullptr);
+
+  SG::DataProxy* dp[10];
+  for (size_t i = 0; i < 10; i++) {
+    dp[i] = new (*arena) SG::DataProxy;
+    dp[i]->addRef();
+    assert (arena->inuse() == i+1);
+  }
+  assert (arena->highWater() == 10);
+
+  for (size_t i = 0; i < 5; i++) {
+    assert (dp[i]->release() == 0);
+  }
+  assert (arena->inuse() == 5);
+  assert (arena->highWater() == 10);
+
+  // Freed proxies should be reused.
+  for (size_t i = 0; i < 5; i++) {
+    dp[i] = new (*arena) SG::DataProxy;
+    dp[i]->addRef();
+  }
+  assert (arena->inuse() == 10);
+  assert (arena->highWater() == 10);
+  assert (arena->stats().blocks.total == 3);
+
+  for (size_t i = 0; i < 10; i++) {
+    assert (dp[i]->release() == 0);
+  }
+  assert (arena->inuse() == 0);
+  arena->disown();
+}
+
+
+// Proxies outliving the owner's reference to the pool.
+void test2()
+{
+  std::cout << "test2\n";
+
+  SG::ProxyArena* arena = new SG::ProxyArena ("test2");
+  SG::DataProxy* dp1 = new (*arena) SG::DataProxy;
+  SG::DataProxy* dp2 = new (*arena) SG::DataProxy;
+  dp1->addRef();
+  dp2->addRef();
+
+  // Proxies created after pooled ones still come from the heap.
+  SG::DataProxy* dp3 = new SG::DataProxy;
+  dp3->addRef();
+  {
+    SG::DataProxy dp4;
+  }
+  assert (arena->inuse() == 2);
+
+  // Pool stays alive until the last proxy is returned.
+  arena->disown();
+  assert (dp1->release() == 0);
+  assert (dp3->release() == 0);
+  assert (dp2->release() == 0);
+}
+
+
+int main()
+{
+  std::cout << "StoreGate/ProxyArena_test\n";
+  test1();
+  test2();
+  return 0;
+}
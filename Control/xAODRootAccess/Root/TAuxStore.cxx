@@ -1,7 +1,9 @@
-// Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+// Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 // System include(s):
+#include <algorithm>
 #include <cassert>
+#include <memory>
 #include <string.h>
 #include <sstream>
 #include <stdexcept>
@@ -29,6 +31,7 @@
 
 // Local include(s):
 #include "xAODRootAccess/TAuxStore.h"
+#include "xAODRootAccess/TAuxBatch.h"
 #include "xAODRootAccess/tools/Utils.h"
 #include "xAODRootAccess/tools/Message.h"
 #include "xAODRootAccess/tools/TAuxVectorFactory.h"
@@ -255,14 +258,18 @@ namespace xAOD {
       // If we don't need everything loaded, return now:
       if( ! getall ) return 0;
 
-      // Get all the variables at once:
+      // Get all the variables at once. When called from TEvent::fill(), only
+      // the ones that are written out: the others are read on first access.
       ::Int_t bytesRead = 0;
-      std::vector< TBranchHandle* >::iterator itr = m_branches.begin();
-      std::vector< TBranchHandle* >::iterator end = m_branches.end();
-      for( ; itr != end; ++itr ) {
-         if( *itr ) {
-            bytesRead += ( *itr )->getEntry();
+      for( auxid_t auxid = 0; auxid < m_branches.size(); ++auxid ) {
+         if( ! m_branches[ auxid ] ) {
+            continue;
+         }
+         if( ( getall == 99 ) &&
+             ( ( ! m_outTree ) || ( ! isAuxIDSelected( auxid ) ) ) ) {
+            continue;
          }
+         bytesRead += m_branches[ auxid ]->getEntry();
       }
 
       return bytesRead;
@@ -283,6 +290,123 @@ namespace xAOD {
       return;
    }
 
+   /// This function reads the values of a single variable for a range of
+   /// entries of the input TTree, and appends them to a batch object.
+   /// Reading the entries of one branch one after the other means that each
+   /// basket of the branch only needs to be decompressed once for the
+   /// whole range.
+   ///
+   /// The values are read into a separate in-memory object, so the values
+   /// that the store holds for the current entry are not affected by the
+   /// call.
+   ///
+   /// @param auxid The ID of the variable to read
+   /// @param first The first entry of the input TTree to read
+   /// @param n The (maximal) number of entries to read
+   /// @param batch The object to append the values to
+   /// @returns <code>StatusCode::RECOVERABLE</code> if the variable is not
+   ///          available from the input, the usual StatusCode types otherwise
+   ///
+   StatusCode TAuxStore::readBatch( auxid_t auxid, ::Long64_t first,
+                                    ::Long64_t n, TAuxBatchBase& batch ) {
+
+      // Guard against multi-threaded execution:
+      guard_t guard( m_mutex1 );
+
+      // A little sanity check:
+      if( ! m_inTree ) {
+         ::Error( "xAOD::TAuxStore::readBatch",
+                  XAOD_MESSAGE( "No input TTree set up!" ) );
+         return StatusCode::FAILURE;
+      }
+
+      // Check that the batch is of the right type:
+      const SG::AuxTypeRegistry& reg = SG::AuxTypeRegistry::instance();
+      const std::type_info* type = reg.getType( auxid );
+      if( ( ! type ) || ( *type != batch.type() ) ) {
+         ::Error( "xAOD::TAuxStore::readBatch",
+                  XAOD_MESSAGE( "Variable %s can't be read as type %s" ),
+                  reg.getName( auxid ).c_str(),
+                  Utils::getTypeName( batch.type() ).c_str() );
+         return StatusCode::FAILURE;
+      }
+
+      // Connect to the variable if it was not used yet:
+      if( ( auxid >= m_vecs.size() ) || ( ! m_vecs[ auxid ] ) ||
+          ( auxid >= m_branches.size() ) || ( ! m_branches[ auxid ] ) ) {
+         // If we only handle the dynamic variables of an auxiliary container
+         // object, the static variables are read by that object. Connecting
+         // to their branches here would interfere with that.
+         if( ( ! m_topStore ) &&
+             m_inTree->GetBranch( ( m_prefix +
+                                    reg.getName( auxid ) ).c_str() ) ) {
+            return StatusCode::RECOVERABLE;
+         }
+         const StatusCode sc = setupInputData( auxid );
+         if( ! sc.isSuccess() ) {
+            return sc;
+         }
+         RETURN_CHECK( "xAOD::TAuxStore::readBatch",
+                       setupOutputData( auxid ) );
+      }
+
+      // Decorations that are not on the input have no branch:
+      TBranchHandle* handle = m_branches[ auxid ];
+      ::TBranch* br = *( handle->branchPtr() );
+      if( ! br ) {
+         return StatusCode::RECOVERABLE;
+      }
+
+      // The entries of a friend tree with an index don't follow the
+      // numbering of the main tree, so we can't read those in batches:
+      if( br->GetTree() != m_inTree ) {
+         ::Error( "xAOD::TAuxStore::readBatch",
+                  XAOD_MESSAGE( "Branch %s is not in the main input tree, it "
+                                "can't be read in batches" ),
+                  br->GetName() );
+         return StatusCode::FAILURE;
+      }
+
+      // Don't try to read past the end of the tree:
+      if( ( first < 0 ) || ( n < 0 ) ) {
+         ::Error( "xAOD::TAuxStore::readBatch",
+                  XAOD_MESSAGE( "Invalid entry range requested: %lld, %lld" ),
+                  first, n );
+         return StatusCode::FAILURE;
+      }
+      n = std::max( std::min( n, m_inTree->GetEntries() - first ),
+                    static_cast< ::Long64_t >( 0 ) );
+
+      // Create an object to read into, of the same kind as the one used for
+      // reading the current entry:
+      std::unique_ptr< SG::IAuxTypeVector > vec =
+         reg.makeVector( auxid, ( size_t ) 0, ( size_t ) 0 );
+      const std::type_info* objType = m_vecs[ auxid ]->objType();
+      if( objType && vec->objType() && ( *objType != *vec->objType() ) ) {
+         vec = vec->toPacked();
+      }
+      const ::Bool_t container = ( m_structMode == kContainerStore );
+      if( ! container ) {
+         vec->resize( 1 );
+      }
+      void* obj = ( container ? vec->toVector() : vec->toPtr() );
+
+      // Read all the entries, handing each one to the batch:
+      const ::Int_t nbytes =
+         handle->getEntries( first, n, obj, [ & ]() {
+            batch.addEntry( vec->toPtr(), container ? vec->size() : 1 );
+         } );
+      if( nbytes < 0 ) {
+         ::Error( "xAOD::TAuxStore::readBatch",
+                  XAOD_MESSAGE( "Couldn't read in variable %s" ),
+                  reg.getName( auxid ).c_str() );
+         return StatusCode::FAILURE;
+      }
+
+      // Return gracefully:
+      return StatusCode::SUCCESS;
+   }
+
    const void* TAuxStore::getData( auxid_t auxid ) const {
 
       // Guard against multi-threaded execution:
@@ -1942,6 +2066,63 @@ namespace xAOD {
       return nbytes;
    }
 
+   /// Used for reading a variable for many entries at once. The branch is
+   /// pointed at a separate object for the duration of the call, so the
+   /// object normally connected to the branch keeps the values of the
+   /// current entry.
+   ///
+   /// @param first The first entry to read
+   /// @param n The number of entries to read
+   /// @param obj The object to read the entries into
+   /// @param callback Function called after each entry was read
+   /// @returns The number of bytes read. A negative number in case of error.
+   ///
+   ::Int_t TAuxStore::TBranchHandle::getEntries( ::Long64_t first,
+                                                 ::Long64_t n, void* obj,
+                                                 const std::function< void() >&
+                                                 callback ) {
+
+      // A little sanity check:
+      if( ! m_branch ) {
+         return 0;
+      }
+
+      // Switch the branch in the right mode:
+      if( ! m_primitive ) {
+         if( ( m_branch->GetMakeClass() != m_static ) &&
+             ( ! m_branch->SetMakeClass( m_static ) ) ) {
+            ::Error( "xAOD::TAuxStore::TBranchHandle::getEntries",
+                     XAOD_MESSAGE( "Failed to call SetMakeClass(%i) on "
+                                   "branch \"%s\"" ),
+                     static_cast< int >( m_static ), m_branch->GetName() );
+            return -1;
+         }
+      }
+
+      // Point the branch at the object given to us:
+      void* objPtr = obj;
+      m_branch->SetAddress( ( m_static || m_primitive ) ? obj : &objPtr );
+
+      // Read the entries one by one:
+      ::Int_t result = 0;
+      for( ::Long64_t entry = first; entry < first + n; ++entry ) {
+         IOStats::instance().stats().readBranch( *m_prefix, m_auxid );
+         const ::Int_t nbytes = m_branch->GetEntry( entry );
+         if( nbytes < 0 ) {
+            result = nbytes;
+            break;
+         }
+         result += nbytes;
+         callback();
+      }
+
+      // Connect the branch back to our own object:
+      m_branch->SetAddress( inputObjectPtr() );
+
+      // Return the number of bytes read.
+      return result;
+   }
+
    /// No magic here. <code>TTree::SetBranchAddress</code> needs a pointer
    /// to a <code>TBranch</code> pointer. This function just makes sure that
    /// we can give it such a pointer, which will stay valid during the job.
@@ -1499,6 +1499,97 @@ namespace xAOD {
       return getEntry( entry, getall );
    }
 
+   /// This function reads the values of a single auxiliary variable of a
+   /// container (or standalone object) for a range of entries, into one
+   /// contiguous buffer. This allows code to run selections over the
+   /// objects of many events at once, without re-resolving the variable
+   /// for every single event, while the baskets of the branch only need
+   /// to be decompressed once for the whole range.
+   ///
+   /// Entries are numbered the same way as for getEntry(...). Only entries
+   /// of the currently loaded input file can be read, the batch ends at the
+   /// end of that file. So, when reading a TChain, the batch may hold fewer
+   /// entries than requested. Load the next entry with getEntry(...) before
+   /// asking for the next batch in that case.
+   ///
+   /// Variables are read through the TAuxStore objects reading the
+   /// container. In kClassAccess and kAthenaAccess modes this means that
+   /// only the dynamic variables of the container can be read this way.
+   ///
+   /// The entry loaded by the object is not changed by this call.
+   ///
+   /// @param key The key (branch name) of the container/object
+   /// @param auxid The ID of the variable to read
+   /// @param first The first entry to read
+   /// @param n The (maximal) number of entries to read
+   /// @param batch The object receiving the values
+   /// @returns The usual StatusCode types
+   ///
+   StatusCode TEvent::readAuxBatch( const std::string& key, SG::auxid_t auxid,
+                                     ::Long64_t first, ::Long64_t n,
+                                     TAuxBatchBase& batch ) {
+
+      // Start from an empty batch:
+      batch.clear( first );
+
+      // A little sanity check:
+      if( ! m_inTree ) {
+         ::Error( "xAOD::TEvent::readAuxBatch",
+                  XAOD_MESSAGE( "Function called on an uninitialised "
+                                "object" ) );
+         return StatusCode::FAILURE;
+      }
+
+      // Translate the entry number to the numbering of the current file:
+      const ::Long64_t offset =
+         ( m_inChain ? m_inChain->GetTreeOffset()[ m_inTreeNumber ] : 0 );
+      const ::Long64_t fileFirst = first - offset;
+      if( ( fileFirst < 0 ) || ( fileFirst >= m_inTree->GetEntries() ) ) {
+         ::Error( "xAOD::TEvent::readAuxBatch",
+                  XAOD_MESSAGE( "Entry %lld is not in the current input "
+                                "file" ), first );
+         return StatusCode::FAILURE;
+      }
+
+      // Check if a name remapping should be applied or not:
+      std::string keyToUse = key;
+      auto remap_itr = m_nameRemapping.find( key );
+      if( ( remap_itr != m_nameRemapping.end() ) &&
+          ( ! m_inputEventFormat.exists( key ) ) &&
+          m_inputEventFormat.exists( remap_itr->second ) ) {
+         keyToUse = remap_itr->second;
+      }
+
+      // Make sure that the container and its auxiliary store(s) are
+      // connected to:
+      RETURN_CHECK( "xAOD::TEvent::readAuxBatch", connectBranch( keyToUse ) );
+
+      // Ask the stores reading the auxiliary variables to read the batch:
+      for( const char* postfix : { "Aux.", "Aux.Dynamic" } ) {
+         Object_t::const_iterator itr =
+            m_inputObjects.find( keyToUse + postfix );
+         if( itr == m_inputObjects.end() ) {
+            continue;
+         }
+         TAuxManager* mgr = dynamic_cast< TAuxManager* >( itr->second );
+         if( ! mgr ) {
+            continue;
+         }
+         const StatusCode sc =
+            mgr->getStore()->readBatch( auxid, fileFirst, n, batch );
+         if( ! sc.isRecoverable() ) {
+            return sc;
+         }
+      }
+
+      // The variable was not found:
+      ::Error( "xAOD::TEvent::readAuxBatch",
+               XAOD_MESSAGE( "Variable %s of %s can't be read in batches" ),
+               SG::AuxTypeRegistry::instance().getName( auxid ).c_str(),
+               key.c_str() );
+      return StatusCode::RECOVERABLE;
+   }
+
    /// This function needs to be called by the user at the end of processing
    /// each event that is meant to be written out.
    ///
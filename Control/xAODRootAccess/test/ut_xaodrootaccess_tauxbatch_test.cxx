@@ -0,0 +1,118 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+// System include(s):
+#include <memory>
+#include <vector>
+
+// ROOT include(s):
+#include <TTree.h>
+
+// EDM include(s):
+#include "AthContainers/AuxTypeRegistry.h"
+
+#include "AsgMessaging/MessageCheck.h"
+
+// Local include(s):
+#include "xAODRootAccess/Init.h"
+#include "xAODRootAccess/TAuxStore.h"
+#include "xAODRootAccess/TAuxBatch.h"
+#include "xAODRootAccess/tools/ReturnCheck.h"
+
+/// Helper macro for evaluating logical tests
+#define SIMPLE_ASSERT( EXP )                                            \
+   do {                                                                 \
+      const bool result = EXP;                                          \
+      if( ! result ) {                                                  \
+         ::Error( APP_NAME, "Expression \"%s\" failed the evaluation",  \
+                  #EXP );                                               \
+         return 1;                                                      \
+      }                                                                 \
+   } while( 0 )
+
+int main() {
+
+   ANA_CHECK_SET_TYPE (int);
+   using namespace asg::msgUserCode;
+
+   // The name of the application:
+   const char* APP_NAME = "ut_xaodrootaccess_tauxbatch_test";
+
+   // Initialise the environment:
+   ANA_CHECK( xAOD::Init( APP_NAME ) );
+
+   // Reference to the auxiliary type registry:
+   SG::AuxTypeRegistry& reg = SG::AuxTypeRegistry::instance();
+
+   // Create a TTree in memory, with a different number of elements in
+   // every entry:
+   std::unique_ptr< ::TTree > itree( new ::TTree( "InputTree", "Input Tree" ) );
+   itree->SetDirectory( 0 );
+   std::vector< float > var1;
+   std::vector< float >* var1Ptr = &var1;
+   if( ! itree->Branch( "PrefixAuxDyn.var1", &var1Ptr ) ) {
+      ::Error( APP_NAME, "Couldn't create branch in transient input tree" );
+      return 1;
+   }
+   for( int entry = 0; entry < 4; ++entry ) {
+      var1.clear();
+      for( int i = 0; i < entry; ++i ) {
+         var1.push_back( 10 * entry + i );
+      }
+      if( itree->Fill() < 0 ) {
+         ::Error( APP_NAME, "Failed to fill the transient data into the "
+                  "input tree" );
+         return 1;
+      }
+   }
+
+   // Connect a store to the tree, and load its second entry:
+   xAOD::TAuxStore store( "PrefixAux." );
+   store.lock();
+   ANA_CHECK( store.readFrom( itree.get() ) );
+   SIMPLE_ASSERT( itree->LoadTree( 1 ) == 1 );
+   const SG::auxid_t var1Id = reg.getAuxID< float >( "var1" );
+   const float* current =
+      static_cast< const float* >( store.getData( var1Id ) );
+   SIMPLE_ASSERT( current != nullptr );
+   SIMPLE_ASSERT( store.size() == 1 );
+   SIMPLE_ASSERT( current[ 0 ] == 10 );
+
+   // Read more entries than the tree has, starting from the second one:
+   xAOD::TAuxBatch< float > batch;
+   batch.clear( 1 );
+   ANA_CHECK( store.readBatch( var1Id, 1, 10, batch ) );
+   SIMPLE_ASSERT( batch.firstEntry() == 1 );
+   SIMPLE_ASSERT( batch.nEntries() == 3 );
+   SIMPLE_ASSERT( batch.size() == 6 );
+   SIMPLE_ASSERT( ( batch.offsets() ==
+                    std::vector< std::size_t >{ 0, 1, 3, 6 } ) );
+   const std::vector< float > expected{ 10, 20, 21, 30, 31, 32 };
+   for( std::size_t i = 0; i < expected.size(); ++i ) {
+      SIMPLE_ASSERT( batch.data()[ i ] == expected[ i ] );
+   }
+   SIMPLE_ASSERT( batch.entry( 1 ).size() == 2 );
+   SIMPLE_ASSERT( batch.entry( 1 )[ 1 ] == 21 );
+
+   // The values of the current entry must not have been touched:
+   SIMPLE_ASSERT( store.getData( var1Id ) == current );
+   SIMPLE_ASSERT( store.size() == 1 );
+   SIMPLE_ASSERT( current[ 0 ] == 10 );
+
+   // Moving on to the next entry must still work as before:
+   SIMPLE_ASSERT( itree->LoadTree( 2 ) == 2 );
+   current = static_cast< const float* >( store.getData( var1Id ) );
+   SIMPLE_ASSERT( store.size() == 2 );
+   SIMPLE_ASSERT( current[ 1 ] == 21 );
+
+   // A batch of the wrong type must be refused:
+   xAOD::TAuxBatch< int > intBatch;
+   SIMPLE_ASSERT( store.readBatch( var1Id, 0, 4, intBatch ).isFailure() );
+
+   // Variables that are not on the input are reported as such:
+   const SG::auxid_t missingId = reg.getAuxID< float >( "missing" );
+   SIMPLE_ASSERT( store.readBatch( missingId, 0, 4, batch ).isRecoverable() );
+
+   return 0;
+}
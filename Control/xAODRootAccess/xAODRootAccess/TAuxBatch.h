@@ -0,0 +1,116 @@
+// Dear emacs, this is -*- c++ -*-
+//
+// Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+//
+#ifndef XAODROOTACCESS_TAUXBATCH_H
+#define XAODROOTACCESS_TAUXBATCH_H
+
+// System include(s):
+#include <cstddef>
+#include <typeinfo>
+#include <type_traits>
+#include <vector>
+
+// ROOT include(s):
+#include <Rtypes.h>
+
+// EDM include(s):
+#include "CxxUtils/span.h"
+
+namespace xAOD {
+
+   /// @short Type independent part of @c xAOD::TAuxBatch
+   ///
+   /// This is the interface through which @c xAOD::TAuxStore fills
+   /// a batch, without having to know the type of the variable at
+   /// compile time.
+   ///
+   class TAuxBatchBase {
+
+   public:
+      /// Destructor
+      virtual ~TAuxBatchBase() = default;
+
+      /// The type of the elements held by the batch
+      virtual const std::type_info& type() const = 0;
+
+      /// The (global) number of the first entry in the batch
+      ::Long64_t firstEntry() const;
+      /// The number of entries held in the batch
+      std::size_t nEntries() const;
+      /// The total number of elements held in the batch
+      std::size_t size() const;
+      /// Offsets of the entries in the buffer (one more than the entries)
+      const std::vector< std::size_t >& offsets() const;
+
+      /// Remove all entries, setting the number of the first entry
+      void clear( ::Long64_t firstEntry = 0 );
+      /// Add the values of one entry to the end of the batch
+      void addEntry( const void* data, std::size_t n );
+
+   protected:
+      /// Append elements to the buffer
+      virtual void append( const void* data, std::size_t n ) = 0;
+      /// Remove all elements from the buffer
+      virtual void clearValues() = 0;
+
+   private:
+      /// Number of the first entry in the batch
+      ::Long64_t m_firstEntry = 0;
+      /// Offsets of the entries in the buffer
+      std::vector< std::size_t > m_offsets{ 0 };
+
+   }; // class TAuxBatchBase
+
+   /// @short Values of one auxiliary variable for a range of entries
+   ///
+   /// Filled by @c xAOD::TEvent::readAuxBatch, this holds the values of a
+   /// single auxiliary variable for a number of consecutive entries of the
+   /// input, in one contiguous buffer. The values belonging to entry
+   /// <code>firstEntry()+i</code> are found at indices
+   /// <code>[offsets()[i], offsets()[i+1])</code> of <code>data()</code>.
+   /// For standalone objects each entry holds exactly one value.
+   ///
+   /// Code doing selections over many objects at once can run over
+   /// <code>data()</code> directly, and use the offsets only to map the
+   /// results back to events.
+   ///
+   /// Only arithmetic types (other than bool) can be read this way.
+   ///
+   template< typename T >
+   class TAuxBatch : public TAuxBatchBase {
+
+      static_assert( std::is_arithmetic_v< T > &&
+                     ( ! std::is_same_v< T, bool > ),
+                     "Only arithmetic variables can be read in batches" );
+
+   public:
+      /// The type of the elements held by the batch
+      virtual const std::type_info& type() const override;
+
+      /// Pointer to the start of the buffer
+      const T* data() const;
+      /// The values belonging to the i'th entry of the batch
+      CxxUtils::span< const T > entry( std::size_t i ) const;
+
+      /// Reserve space for a given number of elements
+      void reserve( std::size_t n );
+
+   protected:
+      /// Append elements to the buffer
+      virtual void append( const void* data, std::size_t n ) override;
+      /// Remove all elements from the buffer
+      virtual void clearValues() override;
+
+   private:
+      /// The values for all entries of the batch
+      std::vector< T > m_values;
+
+   }; // class TAuxBatch
+
+} // namespace xAOD
+
+// Include the template implementation(s).
+#include "TAuxBatch.icc"
+
+#endif // XAODROOTACCESS_TAUXBATCH_H
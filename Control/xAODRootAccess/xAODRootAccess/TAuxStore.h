@@ -1,11 +1,12 @@
 // Dear emacs, this is -*- c++ -*-
 //
-// Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+// Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 //
 #ifndef XAODROOTACCESS_TAUXSTORE_H
 #define XAODROOTACCESS_TAUXSTORE_H
 
 // STL include(s):
+#include <functional>
 #include <vector>
 #include <string>
 
@@ -32,6 +33,7 @@ namespace xAOD {
 
    // Forward declaration(s):
    class TEvent;
+   class TAuxBatchBase;
 
    /// @short "ROOT implementation" of IAuxStore
    ///
@@ -98,11 +100,16 @@ namespace xAOD {
       StatusCode writeTo( ::TTree* tree );
 
       /// Read the values from the TTree entry that was loaded with TTree::LoadTree()
+      /// (with getall==99 only the variables written to the output TTree)
       Int_t getEntry( Int_t getall = 0 );
 
       /// Tell the object that all branches will need to be re-read
       void reset();
 
+      /// Read one variable for a range of entries of the input TTree
+      StatusCode readBatch( auxid_t auxid, ::Long64_t first, ::Long64_t n,
+                            TAuxBatchBase& batch );
+
       /// @name Functions implementing the SG::IConstAuxStore interface
       /// @{
 
@@ -260,6 +267,9 @@ namespace xAOD {
 
          /// Get entry from the branch that was loaded with TTree::LoadTree()
          ::Int_t getEntry();
+         /// Read a range of entries into a separate object
+         ::Int_t getEntries( ::Long64_t first, ::Long64_t n, void* obj,
+                             const std::function< void() >& callback );
          /// Get a pointer to the branch being held
          ::TBranch** branchPtr();
          /// Get a pointer to the object
@@ -22,6 +22,7 @@
 #include "CxxUtils/checker_macros.h"
 #include "AthContainers/tools/threading.h"
 #include "CxxUtils/sgkey_t.h"
+#include "AthContainersInterfaces/AuxTypes.h"
 
 // Interface include(s):
 #include "xAODRootAccessInterfaces/TVirtualEvent.h"
@@ -30,6 +31,7 @@
 #include "AsgMessaging/StatusCode.h"
 #include "CxxUtils/checker_macros.h"
 #include "xAODRootAccess/tools/IProxyDict.h"
+#include "xAODRootAccess/TAuxBatch.h"
 
 // Forward declaration(s):
 class TFile;
@@ -255,6 +257,17 @@ namespace xAOD {
       /// Load the first event for a given file from the input TChain
       ::Int_t getFile( ::Long64_t file, ::Int_t getall = 0 );
 
+      /// Read one auxiliary variable for a range of entries
+      template< typename T >
+      StatusCode readAuxBatch( const std::string& key,
+                                const std::string& name,
+                                ::Long64_t first, ::Long64_t n,
+                                TAuxBatch< T >& batch );
+      /// Read one auxiliary variable for a range of entries
+      StatusCode readAuxBatch( const std::string& key, SG::auxid_t auxid,
+                                ::Long64_t first, ::Long64_t n,
+                                TAuxBatchBase& batch );
+
       /// Function filling one event into the output tree
       ::Int_t fill();
 
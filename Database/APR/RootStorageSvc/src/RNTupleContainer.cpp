@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //====================================================================
@@ -556,6 +556,11 @@ DbStatus RNTupleContainer::transAct(Transaction::Action action) {
 /// Close the container and deallocate resources
 DbStatus RNTupleContainer::close() {
   m_dbH = DbDatabase(POOL_StorageType);
+  for (auto& desc : m_fieldDescs) {
+    if (desc.auxdyn_reader && m_rootDb) {
+      m_rootDb->addAuxDynReadStats(desc.auxdyn_reader->readStats());
+    }
+  }
   m_fieldDescs.clear();
   m_rootDb = nullptr;
   return DbContainerImp::close();
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //====================================================================
@@ -17,12 +17,14 @@
 #include "StorageSvc/DbDomain.h"
 #include "POOLCore/DbPrint.h"
 #include "RootAuxDynIO/RootAuxDynIO.h"
+#include "CxxUtils/ArrayCodec.h"
 
 #include "GaudiKernel/Bootstrap.h"
 #include "GaudiKernel/ISvcLocator.h"
 #include "GaudiKernel/IFileMgr.h"
 
 #include <string>
+#include <stdexcept>
 #include <cerrno>
 #include <sys/stat.h>
 
@@ -36,11 +38,25 @@
 #include "TSystem.h"
 
 #include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RPageStorage.hxx"
+#include "ROOT/TTaskGroup.hxx"
 using ROOT::Experimental::Detail::RFieldBase;
 
 using namespace pool;
 using namespace std;
 
+/// Runs the page decompression of an RNTuple cluster as ROOT implicit MT tasks
+class pool::RNTupleUnzipTasks : public ROOT::Experimental::Detail::RPageStorage::RTaskScheduler {
+public:
+   RNTupleUnzipTasks() { Reset(); }
+   virtual void Reset() override { m_taskGroup = std::make_unique<ROOT::Experimental::TTaskGroup>(); }
+   virtual void AddTask(const std::function<void(void)>& taskFunc) override { m_taskGroup->Run(taskFunc); }
+   virtual void Wait() override { m_taskGroup->Wait(); }
+private:
+   std::unique_ptr<ROOT::Experimental::TTaskGroup> m_taskGroup;
+};
+
 /// Standard Constuctor
 RootDatabase::RootDatabase() :
         m_file(nullptr), 
@@ -55,6 +71,8 @@ RootDatabase::RootDatabase() :
         m_defWritePolicy(TObject::kOverwrite),   // On write create new versions
         m_branchOffsetTabLen(0),
         m_defTreeCacheLearnEvents(-1),
+        m_parallelUnzip(false),
+        m_asyncPrefetching(false),
         m_indexMasterID(0),
         m_fileMgr(nullptr)
 {
@@ -117,18 +135,24 @@ DbStatus RootDatabase::open(const DbDomain& domH,const std::string& nam,DbAccess
   DbOption opt4("DEFAULT_AUTOSAVE","");
   DbOption opt5("DEFAULT_BUFFERSIZE","");
   DbOption opt6("TREE_BRANCH_OFFSETTAB_LEN","");
+  DbOption opt7("ENABLE_PARALLEL_UNZIP","");
+  DbOption opt8("ENABLE_ASYNC_PREFETCHING","");
   domH.getOption(opt1);
   domH.getOption(opt2);
   domH.getOption(opt3);
   domH.getOption(opt4);
   domH.getOption(opt5);
   domH.getOption(opt6);
+  domH.getOption(opt7);
+  domH.getOption(opt8);
   opt1._getValue(m_defCompression);
   opt2._getValue(m_defCompressionAlg);
   opt3._getValue(m_defSplitLevel);
   opt4._getValue(m_defAutoSave);
   opt5._getValue(m_defBufferSize);
   opt6._getValue(m_branchOffsetTabLen);
+  opt7._getValue(m_parallelUnzip);
+  opt8._getValue(m_asyncPrefetching);
   //gDebug = 2;
   TDirectory::TContext dirCtxt(0);
 
@@ -339,6 +363,17 @@ DbStatus RootDatabase::close(DbAccessMode /* mode */ )  {
                err = 1;
             }
          }
+         const RootAuxDynIO::AuxDynReadStats& aux = m_auxDynReadStats;
+         if( aux.touchedAttributes + aux.untouchedAttributes > 0 ) {
+            log << DbPrintLvl::Info << "Dynamic aux attributes read from " << nam << ": "
+                << aux.touchedAttributes << " of " << aux.touchedAttributes + aux.untouchedAttributes
+                << ", never read: " << aux.untouchedAttributes;
+            if( aux.touchedBytes + aux.untouchedBytes > 0 ) {
+               log << " (" << aux.untouchedBytes << " of " << aux.touchedBytes + aux.untouchedBytes
+                   << " bytes on disk untouched)";
+            }
+            log << DbPrint::endmsg;
+         }
          log << DbPrintLvl::Debug
              << "I/O READ  Bytes: " << byteCount(READ_COUNTER)  << DbPrint::endmsg
              << "I/O WRITE Bytes: " << byteCount(WRITE_COUNTER) << DbPrint::endmsg
@@ -384,6 +419,12 @@ long long int RootDatabase::byteCount(int which) const   {
 DbStatus RootDatabase::getOption(DbOption& opt)  {
   const char* n = opt.name().c_str();
   switch( ::toupper(n[0]) )  {
+    case 'A':
+      if ( !strcasecmp(n, "AUX_CODEC") )  {
+        auto it = m_auxCodecs.find( opt.option() );
+        return opt._setValue( (it != m_auxCodecs.end()) ? it->second.c_str() : "" );
+      }
+      break;
     case 'C':
       if ( !m_file )
         return Error;
@@ -523,6 +564,27 @@ DbStatus RootDatabase::getOption(DbOption& opt)  {
 DbStatus RootDatabase::setOption(const DbOption& opt)  {
   const char* n = opt.name().c_str();
   switch( ::toupper(n[0]) )  {
+    case 'A':
+      if ( !strcasecmp(n, "AUX_CODEC") )  {
+        // Option is the aux variable "<key>Aux.<attribute>", value the codec specification
+        DbPrint log("RootDatabase.setOption");
+        if (!opt.option().size()) {
+          log << DbPrintLvl::Error << "Must set option to aux variable name to set AUX_CODEC" << DbPrint::endmsg;
+          return Error;
+        }
+        const char* spec = "";
+        opt._getValue(spec);
+        try {
+          CxxUtils::ArrayCodec codec( spec );
+        }
+        catch( const std::invalid_argument& e ) {
+          log << DbPrintLvl::Error << "Bad AUX_CODEC for " << opt.option() << ": " << e.what() << DbPrint::endmsg;
+          return Error;
+        }
+        m_auxCodecs[opt.option()] = spec;
+        return Success;
+      }
+      break;
     case 'C':
       if ( !m_file )
         return Error;
@@ -870,6 +932,13 @@ DbStatus RootDatabase::transAct(Transaction::Action action)
 
    // process flush to write file
    if( action == Transaction::TRANSACT_FLUSH ) {
+      if( dynamic_cast<TMemFile*>(m_file) != nullptr ) {
+         // The memory file content is sent to the shared writer and reset: finish the RNTuples
+         // so their compressed clusters can be appended to the output file as they are
+         for( auto& writer : m_ntupleWriterMap ) {
+            writer.second->closeSegment();
+         }
+      }
       m_file->Write();
       if (dynamic_cast<TMemFile*>(m_file) == nullptr) {
          TIter nextKey(m_file->GetListOfKeys());
@@ -1061,8 +1130,20 @@ RootDatabase::getNTupleReader(std::string ntuple_name)
       return reader_entry->second.get();
    }
    const std::string file_name = m_file->GetName();
-   auto native_reader = RPageSource::Create(string("RNT:")+ntuple_name, file_name);
+   ROOT::Experimental::RNTupleReadOptions options;
+   if( m_asyncPrefetching ) {
+      // The cluster pool reads the next clusters in its I/O thread
+      options.SetClusterCache( ROOT::Experimental::RNTupleReadOptions::EClusterCache::kOn );
+   }
+   auto native_reader = RPageSource::Create(string("RNT:")+ntuple_name, file_name, options);
    RPageSource *ps = native_reader.get();
+   if( m_parallelUnzip ) {
+      // Without a task scheduler, the pages are decompressed serially when first accessed.
+      // The tasks run sequentially until implicit MT is enabled.
+      auto& tasks = m_ntupleUnzipTasks[ntuple_name];
+      tasks = std::make_unique<RNTupleUnzipTasks>();
+      ps->SetTaskScheduler( tasks.get() );
+   }
    ps->Attach();
    m_ntupleReaderMap.emplace(ntuple_name, std::move(native_reader));
    return ps;
@@ -1075,6 +1156,7 @@ RootDatabase::getNTupleWriter(std::string ntuple_name, bool create)
    auto& writer = m_ntupleWriterMap[ntuple_name];
    if( !writer and create ) {
       writer = RootAuxDynIO::getNTupleAuxDynWriter(m_file, string("RNT:")+ntuple_name, m_file->GetCompressionSettings() );
+      writer->setAuxCodecs( m_auxCodecs );
    }
    if( writer and create ) {
       // treat the create flag as an indication of a new container client and count them
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //====================================================================
@@ -14,6 +14,7 @@
 // Framework include files
 #include "StorageSvc/IDbDatabase.h"
 #include "StorageSvc/DbDatabase.h"
+#include "RootAuxDynIO/RootAuxDynIO.h"
 
 #include <set>
 #include <map>
@@ -32,10 +33,6 @@ class TFile;
 class TTree;
 class TBranch;
 class IFileMgr;
-namespace RootAuxDynIO {
-   class IRootAuxDynReader;
-   class IRNTupleWriter;
-}
 
 /*
  * POOL namespace declaration
@@ -43,6 +40,7 @@ namespace RootAuxDynIO {
 namespace pool  {  
 
    class RootTreeContainer;
+   class RNTupleUnzipTasks;
    
   /** @class RootDatabase RootDatabase.h src/RootDatabase.h
     *
@@ -89,6 +87,10 @@ namespace pool  {
     std::string   m_treeNameWithCache;
     /// Default tree cache learn events
     int           m_defTreeCacheLearnEvents;
+    /// Decompress the pages of the next RNTuple cluster in parallel
+    bool          m_parallelUnzip;
+    /// Read the next RNTuple cluster in a background thread
+    bool          m_asyncPrefetching;
 
     /// name of the container with master index ('*' means use the biggest)
     std::string   m_indexMaster;
@@ -113,17 +115,25 @@ namespace pool  {
     
     std::map< std::string, int >        m_customSplitLevel;
 
+    /// Codecs for dynamic aux variables, set with the AUX_CODEC option
+    std::map< std::string, std::string > m_auxCodecs;
+
     IFileMgr*     m_fileMgr;
 
     // mutex to prevent concurrent read I/O from AuxDynReader
     std::recursive_mutex  m_iomutex;
 
     std::map<std::string, std::unique_ptr<RootAuxDynIO::IRNTupleWriter> >  m_ntupleWriterMap;
+    // unzip task schedulers must outlive the readers using them
+    std::map<std::string, std::unique_ptr<RNTupleUnzipTasks> >             m_ntupleUnzipTasks;
     std::map<std::string, std::unique_ptr<RPageSource> >                   m_ntupleReaderMap;
 
     using indexLookup_t = std::unordered_map<uint64_t, uint64_t>;
     std::map<void*, indexLookup_t>                                         m_ntupleIndexMap;
 
+    /// dynamic aux attributes read / not read from this file, reported when it is closed
+    RootAuxDynIO::AuxDynReadStats  m_auxDynReadStats;
+
   public:
     /// Standard Constuctor
     RootDatabase();
@@ -172,8 +182,14 @@ namespace pool  {
     /// Mark that a given TTree had its index rebuilt
     void	markIndexRebuilt(const std::string& treeName)  { m_indexRebuilt.insert(treeName); };
 
+    /// Codecs to apply when writing dynamic aux variables
+    const std::map<std::string, std::string>& auxCodecs() const { return m_auxCodecs; }
+
     /// provide access to the I/O mutex for AuxDynReader and Containers
     std::recursive_mutex& ioMutex()         { return m_iomutex; }
+
+    /// Do some statistics: add the dynamic aux attributes read by a container
+    void addAuxDynReadStats(const RootAuxDynIO::AuxDynReadStats& stats) { m_auxDynReadStats += stats; }
     
     /// Access options
     /** @param opt      [IN]  Reference to option object.
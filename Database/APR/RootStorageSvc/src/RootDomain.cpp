@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //====================================================================
@@ -15,9 +15,11 @@
 #include "RootDatabase.h"
 
 #include "TSystem.h"
+#include "TEnv.h"
 #include "TFile.h"
 #include "TROOT.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
 #include "TVirtualStreamerInfo.h"
 
 using namespace pool;
@@ -29,7 +31,9 @@ RootDomain::RootDomain() :
   m_defSplitLevel(99),
   m_defAutoSave(16*1024*1024),
   m_defBufferSize(16*1024),
-  m_branchOffsetTabLen(0)
+  m_branchOffsetTabLen(0),
+  m_parallelUnzip(false),
+  m_asyncPrefetching(false)
 {
 }
 
@@ -84,6 +88,22 @@ DbStatus RootDomain::setOption(const DbOption& opt)  {
         }
         return sc;
       }
+      else if ( !strcasecmp(n, "ENABLE_PARALLEL_UNZIP") )  {
+        DbStatus sc = opt._getValue(m_parallelUnzip);
+        if ( sc.isSuccess() )  {
+           // Tree caches created from now on unzip the baskets of a cluster in parallel
+           TTreeCacheUnzip::SetParallelUnzip(m_parallelUnzip ? TTreeCacheUnzip::kEnable : TTreeCacheUnzip::kDisable);
+        }
+        return sc;
+      }
+      else if ( !strcasecmp(n, "ENABLE_ASYNC_PREFETCHING") )  {
+        DbStatus sc = opt._getValue(m_asyncPrefetching);
+        if ( sc.isSuccess() )  {
+           // Only affects the files opened from now on
+           gEnv->SetValue("TFile.AsyncPrefetching", m_asyncPrefetching ? 1 : 0);
+        }
+        return sc;
+      }
       break;
     case 'F':
       if ( !strncasecmp(n+5, "READSTREAMERINFO",15) )  {
@@ -153,6 +173,12 @@ DbStatus RootDomain::getOption(DbOption& opt) const   {
       if ( !strcasecmp(n, "ERRNO") )  {
         return opt._setValue(int(gSystem->GetErrno()));
       }
+      else if ( !strcasecmp(n, "ENABLE_PARALLEL_UNZIP") )  {
+        return opt._setValue(m_parallelUnzip);
+      }
+      else if ( !strcasecmp(n, "ENABLE_ASYNC_PREFETCHING") )  {
+        return opt._setValue(m_asyncPrefetching);
+      }
       break;
     case 'N':
       if ( !strcasecmp(n, "NUM_CLASSES") )  {
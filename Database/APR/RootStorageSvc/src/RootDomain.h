@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //====================================================================
@@ -46,6 +46,10 @@ namespace pool  {
     int m_defBufferSize;
     /// Offset table length for branches
     int	m_branchOffsetTabLen;
+    /// Decompress the baskets/pages of the next cluster in parallel (needs implicit MT)
+    bool m_parallelUnzip;
+    /// Read the next cluster in a background thread
+    bool m_asyncPrefetching;
     
   public:
     /// Standard Constuctor
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //====================================================================
@@ -449,6 +449,9 @@ DbStatus RootTreeContainer::close()   {
   }
   for(Branches::iterator k=m_branches.begin(); k != m_branches.end(); ++k)  {
     BranchDesc& dsc = (*k);
+    if ( dsc.auxdyn_reader && m_rootDb )  {
+      m_rootDb->addAuxDynReadStats( dsc.auxdyn_reader->readStats() );
+    }
     if ( dsc.buffer && dsc.clazz )  {
       // This somehow fails for templates.
       dsc.clazz->Destructor(dsc.buffer);
@@ -795,6 +798,7 @@ DbStatus  RootTreeContainer::addObject(DbDatabase& dbH,
                      // TBranch Writer
                      bool do_branch_fill = isBranchContainer() && !m_treeFillMode;
                      dsc.auxdyn_writer = RootAuxDynIO::getBranchAuxDynWriter(m_tree, dynBufferSize, dynSplitLevel, branchOffsetTabLen, do_branch_fill);
+                     if( m_rootDb ) dsc.auxdyn_writer->setAuxCodecs( m_rootDb->auxCodecs() );
                   }
                }
                return Success;
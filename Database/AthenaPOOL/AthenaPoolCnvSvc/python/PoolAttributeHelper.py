@@ -1,4 +1,4 @@
-# Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 """ A basic module that helps with setting various common Pool Attributes """
 
@@ -81,6 +81,14 @@ def setBranchBasketSize( fileName = None, treeName = None, basketSize = None ):
                              attrName  = "BRANCH_BASKET_SIZE",
                              attrValue = basketSize )
 
+def setAuxCodec( fileName = None, auxName = None, codec = None ):
+    """ Convenience method for setting the codec of a dynamic aux variable ("<key>Aux.<attribute>") in a given file. """
+
+    return setPoolAttribute( fileName  = fileName,
+                             contName  = f"TTree={auxName}",
+                             attrName  = "AUX_CODEC",
+                             attrValue = codec )
+
 # Main Function: Only to check the basic functionality
 # Can be run via python PoolAttributeHelper.py
 if "__main__" in __name__:
@@ -95,6 +103,7 @@ if "__main__" in __name__:
     attrs += [ setMinBufferEntries( "*", 10 ) ]
     attrs += [ setTreeAutoFlush( "AOD.pool.root", "CollectionTree", 10 ) ]
     attrs += [ setContainerSplitLevel( None, "POOLContainerForm(DataHeaderForm)", 99 ) ]
+    attrs += [ setAuxCodec( "AOD.pool.root", "AnalysisJetsAux.pt", "mantissa:10" ) ]
 
     # Low-level
     attrs += [ setPoolAttribute( attrName = "DEFAULT_SPLITLEVEL", attrValue = 0) ]
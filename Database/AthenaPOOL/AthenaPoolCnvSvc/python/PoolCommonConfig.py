@@ -1,4 +1,4 @@
-# Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
 from AthenaConfiguration.ComponentFactory import CompFactory
@@ -8,6 +8,8 @@ def PoolSvcCfg(flags, withCatalogs=False, **kwargs):
     acc = ComponentAccumulator()
 
     kwargs.setdefault("MaxFilesOpen", flags.PoolSvc.MaxFilesOpen)
+    kwargs.setdefault("UseROOTParallelUnzip", flags.PoolSvc.UseParallelUnzip)
+    kwargs.setdefault("UseROOTAsyncPrefetching", flags.PoolSvc.UseAsyncPrefetching)
 
     if withCatalogs:
         catalogs = [
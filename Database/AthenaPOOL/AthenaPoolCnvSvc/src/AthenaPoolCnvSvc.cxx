@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /** @file AthenaPoolCnvSvc.cxx
@@ -626,7 +626,11 @@ StatusCode AthenaPoolCnvSvc::commitOutput(const std::string& outputConnectionSpe
    if (!processPoolAttributes(m_containerAttr, outputConnection, contextId).isSuccess()) {
       ATH_MSG_DEBUG("commitOutput failed process POOL container attributes.");
    }
-   // lock.unlock();  //MN: first need to make commitCache slot-specific
+   if (m_concurrentCommit.value() && m_persSvcPerOutput.value() && m_outputStreamingTool.empty()) {
+      // Shared state is done with. The commit (with its compression and write) only needs the lock
+      // of this output context, which keeps commits to the same file ordered while other streams proceed
+      lock.unlock();
+   }
    try {
       if (doCommit) {
          if (!m_poolSvc->commit(contextId).isSuccess()) {
@@ -1002,6 +1006,7 @@ AthenaPoolCnvSvc::decodeOutputSpec(std::string& fileSpec, int& outputTech) const
 }
 //______________________________________________________________________________
 StatusCode AthenaPoolCnvSvc::registerCleanUp(IAthenaPoolCleanUp* cnv) {
+   std::lock_guard<std::mutex> lock(m_cnvsMutex);
    m_cnvs.push_back(cnv);
    return(StatusCode::SUCCESS);
 }
@@ -1018,6 +1023,7 @@ StatusCode AthenaPoolCnvSvc::cleanUp(const std::string& connection) {
    if (bpos != std::string::npos) bpos = bpos - cpos;
    const std::string conn = connection.substr(cpos, bpos);
    ATH_MSG_VERBOSE("Cleanup for Connection='"<< conn <<"'");
+   std::lock_guard<std::mutex> lock(m_cnvsMutex);
    for (auto converter : m_cnvs) {
       if (!converter->cleanUp(conn).isSuccess()) {
          ATH_MSG_WARNING("AthenaPoolConverter cleanUp failed.");
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ATHENAPOOLCNVSVC_ATHENAPOOLCNVSVC_H
@@ -244,6 +244,13 @@ private: // properties
    /// default = "", no tree name results in a single persistency service.
    StringProperty m_persSvcPerInputType{this,"PersSvcPerInputType",""};
    std::mutex  m_mutex;
+   /// protection for the list of registered converters, m_cnvs
+   std::mutex  m_cnvsMutex;
+
+   /// ConcurrentCommit, boolean property to commit different output files concurrently.
+   /// Commits of the same file stay ordered by the PoolSvc lock of its output context.
+   /// default = false.
+   BooleanProperty m_concurrentCommit{this,"ConcurrentCommit",false};
 
    /// For SharedWriter:
    /// To use MetadataSvc to merge data placed in a certain container
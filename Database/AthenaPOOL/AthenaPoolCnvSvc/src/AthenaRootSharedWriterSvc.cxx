@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /** @file AthenaRootSharedWriterSvc.cxx
@@ -19,13 +19,18 @@
 #include "TMemFile.h"
 #include "TMessage.h"
 #include "TMonitor.h"
+#include "TROOT.h"
 #include "TServerSocket.h"
 #include "TSocket.h"
 #include "TString.h"
 #include "TTree.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <set>
 #include <map>
+#include <thread>
 
 /// Definiton of a branch descriptor from RootTreeContainer
 struct BranchDesc {
@@ -64,6 +69,13 @@ struct ParallelFileMerger : public TObject
 
    ~ParallelFileMerger()
    {
+      // The queued data is still merged before the worker thread ends
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fStop = true;
+      }
+      fQueued.notify_one();
+      if (fWorker.joinable()) fWorker.join();
    }
 
    ULong_t Hash() const
@@ -152,6 +164,59 @@ struct ParallelFileMerger : public TObject
       }
       return result;
    }
+
+// Queue the data to be merged in a separate thread, in the order it was received, without waiting.
+// TTrees and RNTuples arrive with their baskets/pages already compressed by the client,
+// and are copied as they are (kKeepCompression), so the merge is I/O-bound
+   void MergeTreesAsync(std::unique_ptr<TMemFile> input)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fQueue.push_back(std::move(input));
+      if (!fWorker.joinable()) {
+         fWorker = std::thread(&ParallelFileMerger::MergeQueue, this);
+      }
+      fQueued.notify_one();
+   }
+
+// Wait until all the data queued by MergeTreesAsync is merged, returns kFALSE if any merge failed since the last call
+   Bool_t WaitMerge()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fMerged.wait(lock, [this]() { return fQueue.empty() && !fMerging; });
+      const Bool_t result = !fFailed;
+      fFailed = false;
+      return result;
+   }
+
+private:
+// Worker thread: merge the queued data until the merger is deleted
+   void MergeQueue()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      while (true) {
+         fQueued.wait(lock, [this]() { return fStop || !fQueue.empty(); });
+         if (fQueue.empty()) return;
+         std::unique_ptr<TMemFile> input = std::move(fQueue.front());
+         fQueue.pop_front();
+         fMerging = true;
+         lock.unlock();
+         const Bool_t result = MergeTrees(input.get());
+         input.reset();
+         lock.lock();
+         fMerging = false;
+         if (!result) fFailed = true;
+         fMerged.notify_all();
+      }
+   }
+
+   std::mutex fMutex;
+   std::condition_variable fQueued;
+   std::condition_variable fMerged;
+   std::deque<std::unique_ptr<TMemFile> > fQueue;
+   std::thread fWorker;
+   bool fMerging = false;
+   bool fFailed = false;
+   bool fStop = false;
 };
 
 //___________________________________________________________________________
@@ -196,6 +261,10 @@ StatusCode AthenaRootSharedWriterSvc::initialize() {
             ATH_MSG_FATAL("Could not set Conversion Service property " << propertyName << " from " << streamPortString << " to " << newStreamPortString);
             return StatusCode::FAILURE;
          }
+         if (m_parallelMerge.value()) {
+            // Mergers for different files run in their own threads
+            ROOT::EnableThreadSafety();
+         }
          m_rootMonitor = new TMonitor;
          m_rootMonitor->Add(m_rootServerSocket);
          ATH_MSG_DEBUG("Successfully created ROOT TServerSocket and added it to TMonitor: ready to accept connections, " << streamPort);
@@ -293,7 +362,12 @@ StatusCode AthenaRootSharedWriterSvc::share(int numClients, bool motherClient) {
                      m_rootMergers.Add(info);
                      ATH_MSG_INFO("ROOT Monitor ParallelFileMerger: " << info << ", for: " << filename);
                   }
-                  info->MergeTrees(transient.get());
+                  if (m_parallelMerge.value()) {
+                     // Failures are reported by waitForMerges() at the end of the loop
+                     info->MergeTreesAsync(std::move(transient));
+                  } else {
+                     info->MergeTrees(transient.get());
+                  }
                }
                delete message; message = nullptr;
             }
@@ -313,10 +387,22 @@ StatusCode AthenaRootSharedWriterSvc::share(int numClients, bool motherClient) {
          }
       }
    }
+   if (!waitForMerges()) {
+      ATH_MSG_WARNING("ROOT Monitor ParallelFileMerger failed to merge some data");
+   }
    ATH_MSG_INFO("End commitOutput loop");
    return StatusCode::SUCCESS;
 }
 //___________________________________________________________________________
+bool AthenaRootSharedWriterSvc::waitForMerges() {
+   bool success = true;
+   TIter nextMerger(&m_rootMergers);
+   while (ParallelFileMerger* info = static_cast<ParallelFileMerger*>(nextMerger())) {
+      if (!info->WaitMerge()) success = false;
+   }
+   return success;
+}
+//___________________________________________________________________________
 StatusCode AthenaRootSharedWriterSvc::stop() {
    m_rootMergers.Delete();
    return StatusCode::SUCCESS;
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ATHENAROOTSHAREDWRITERSVC_H
@@ -42,7 +42,14 @@ public:
    virtual StatusCode share(int numClients = 0, bool motherClient = false) override;
 
 private:
+   /// Wait for the merges still running, returns false if any failed
+   bool waitForMerges();
+
    ServiceHandle<IAthenaPoolCnvSvc> m_cnvSvc{this,"AthenaPoolCnvSvc","AthenaPoolCnvSvc"};
+   /// ParallelMerge, boolean property to merge the data received for each output file in its own thread,
+   /// while the mother process keeps receiving. Data for the same file is merged in the order it was received.
+   /// default = false.
+   BooleanProperty m_parallelMerge{this,"ParallelMerge",false};
 
    TServerSocket* m_rootServerSocket;
    TMonitor* m_rootMonitor;
@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+"""Test the concurrent commit of several output streams
+
+The first step copies events to two output streams in a multithreaded job,
+with the ConcurrentCommit property of AthenaPoolCnvSvc, so that the streams
+commit their files at the same time.  The next steps (--read AOD, --read ESD)
+read back each file and check that it holds all the processed events.
+
+Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+"""
+import sys
+from argparse import ArgumentParser
+
+from AthenaConfiguration.AllConfigFlags import initConfigFlags
+from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
+from AthenaConfiguration.MainServicesConfig import MainServicesCfg
+from AthenaConfiguration.TestDefaults import defaultTestFiles
+from AthenaPoolCnvSvc.PoolReadConfig import PoolReadCfg
+from AthenaPython.PyAthenaComps import Alg, StatusCode
+from OutputStreamAthenaPool.OutputStreamConfig import OutputStreamCfg
+
+streams = ["AOD", "ESD"]
+writtenEventsFile = "ConcurrentCommit_written.txt"
+maxEvents = 40
+
+
+def outputFile(stream):
+    return f"ConcurrentCommit.{stream}.pool.root"
+
+
+class RecordEvents(Alg):
+    """Writes the "<run>:<event>" numbers of the processed events to a text file"""
+    def __init__(self, name="RecordEvents", fileName=""):
+        Alg.__init__(self, name)
+        self.fileName = fileName
+        self.events = []
+
+    def execute(self):
+        ei = self.evtStore.retrieve("xAOD::EventInfo", "EventInfo")
+        self.events.append(f"{ei.runNumber()}:{ei.eventNumber()}")
+        return StatusCode.Success
+
+    def finalize(self):
+        with open(self.fileName, "w") as f:
+            f.write("".join(f"{event}\n" for event in self.events))
+        return StatusCode.Success
+
+
+def readEvents(fileName):
+    with open(fileName) as f:
+        return sorted(f.read().split())
+
+
+parser = ArgumentParser(prog='test_ConcurrentCommit')
+parser.add_argument("--read", choices=streams,
+                    help="Read back the file of this stream written by the first step")
+args = parser.parse_args()
+
+flags = initConfigFlags()
+if args.read:
+    flags.Input.Files = [outputFile(args.read)]
+    readEventsFile = f"ConcurrentCommit_read{args.read}.txt"
+else:
+    flags.Input.Files = defaultTestFiles.AOD_RUN2_MC
+    flags.Concurrency.NumThreads = 4
+    flags.Concurrency.NumConcurrentEvents = 4
+    for stream in streams:
+        setattr(flags.Output, f"{stream}FileName", outputFile(stream))
+flags.lock()
+
+acc = MainServicesCfg(flags)
+acc.merge(PoolReadCfg(flags))
+
+algs = ComponentAccumulator()
+algs.addEventAlgo(RecordEvents(fileName=readEventsFile if args.read else writtenEventsFile))
+acc.merge(algs)
+
+if not args.read:
+    for stream in streams:
+        acc.merge(OutputStreamCfg(flags, stream,
+                                  ItemList=["xAOD::EventInfo#EventInfo",
+                                            "xAOD::EventAuxInfo#EventInfoAux."]))
+    acc.getService("AthenaPoolCnvSvc").ConcurrentCommit = True
+
+sc = acc.run(maxEvents=maxEvents)
+if not sc.isSuccess():
+    sys.exit(1)
+
+written = readEvents(writtenEventsFile)
+if len(written) != maxEvents:
+    print(f"Not all the {maxEvents} events were processed")
+    sys.exit(1)
+if args.read:
+    read = readEvents(readEventsFile)
+    print(f"{len(read)} events read from {outputFile(args.read)}")
+    if read != written:
+        print(f"Events read differ from the {len(written)} written")
+        sys.exit(1)
+
+sys.exit(0)
@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+"""Test the merging of RNTuple segments by the shared writer
+
+The first step copies events to an RNTuple output file in an AthenaMP job
+with the shared writer and parallel compression: the workers ship their
+RNTuple segments to the mother process, which merges them into the output
+file with the ParallelMerge property of AthenaRootSharedWriterSvc.
+The second step (--read) reads back the file and checks that it holds
+all the events, each once.
+
+Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+"""
+import sys
+from argparse import ArgumentParser
+
+from AthenaConfiguration.AllConfigFlags import initConfigFlags
+from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
+from AthenaConfiguration.ComponentFactory import CompFactory
+from AthenaConfiguration.MainServicesConfig import MainServicesCfg
+from AthenaConfiguration.TestDefaults import defaultTestFiles
+from AthenaPoolCnvSvc.PoolReadConfig import PoolReadCfg
+from AthenaPython.PyAthenaComps import Alg, StatusCode
+from OutputStreamAthenaPool.OutputStreamConfig import OutputStreamCfg
+
+outputFile = "SharedWriterRNTuple.AOD.pool.root"
+readEventsFile = "SharedWriterRNTuple_read.txt"
+maxEvents = 100
+
+
+class RecordEvents(Alg):
+    """Writes the "<run>:<event>" numbers of the processed events to a text file"""
+    def __init__(self, name="RecordEvents", fileName=""):
+        Alg.__init__(self, name)
+        self.fileName = fileName
+        self.events = []
+
+    def execute(self):
+        ei = self.evtStore.retrieve("xAOD::EventInfo", "EventInfo")
+        self.events.append(f"{ei.runNumber()}:{ei.eventNumber()}")
+        return StatusCode.Success
+
+    def finalize(self):
+        with open(self.fileName, "w") as f:
+            f.write("".join(f"{event}\n" for event in self.events))
+        return StatusCode.Success
+
+
+parser = ArgumentParser(prog='test_SharedWriterRNTuple')
+parser.add_argument("--read", default=False, action="store_true",
+                    help="Read back the file written by the first step")
+args = parser.parse_args()
+
+flags = initConfigFlags()
+if args.read:
+    flags.Input.Files = [outputFile]
+else:
+    flags.Input.Files = defaultTestFiles.AOD_RUN2_MC
+    flags.Concurrency.NumProcs = 2
+    flags.MP.UseSharedWriter = True
+    flags.MP.UseParallelCompression = True
+    flags.MP.WorkerTopDir = "athenaMP_workers_SharedWriterRNTuple"
+    flags.Output.AODFileName = outputFile
+    flags.Output.StorageTechnology.EventData = "ROOTRNTUPLE"
+    # Several segments from each worker
+    flags.Output.TreeAutoFlush = {"AOD": 10}
+flags.lock()
+
+acc = MainServicesCfg(flags)
+acc.merge(PoolReadCfg(flags))
+
+if args.read:
+    algs = ComponentAccumulator()
+    algs.addEventAlgo(RecordEvents(fileName=readEventsFile))
+    acc.merge(algs)
+else:
+    acc.merge(OutputStreamCfg(flags, "AOD",
+                              ItemList=["xAOD::EventInfo#EventInfo",
+                                        "xAOD::EventAuxInfo#EventInfoAux."]))
+    acc.addService(CompFactory.AthenaRootSharedWriterSvc(ParallelMerge=True))
+
+sc = acc.run(maxEvents=maxEvents)
+if not sc.isSuccess():
+    sys.exit(1)
+
+if args.read:
+    with open(readEventsFile) as f:
+        read = f.read().split()
+    print(f"{len(read)} events read from {outputFile}")
+    if len(read) != maxEvents or len(set(read)) != maxEvents:
+        print(f"Expected the {maxEvents} written events, each once")
+        sys.exit(1)
+
+sys.exit(0)
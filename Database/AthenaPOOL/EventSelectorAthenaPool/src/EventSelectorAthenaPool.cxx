@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /** @file EventSelectorAthenaPool.cxx
@@ -19,6 +19,7 @@
 #include "StoreGate/StoreGateSvc.h"
 #include "StoreGate/ReadHandle.h"
 #include "StoreGate/WriteHandle.h"
+#include "SGTools/StlVectorClids.h"
 
 #include "AthenaKernel/ICollectionSize.h"
 
@@ -143,6 +144,32 @@ StatusCode EventSelectorAthenaPool::initialize() {
       ATH_MSG_FATAL("EventSelector.CollectionType must be one of: ExplicitROOT, ImplicitROOT (default)");
       return(StatusCode::FAILURE);
    }
+   // Events to select, as <run>:<event>
+   m_selectEvents.clear();
+   for (const std::string& runEvent : m_selectEventsProp.value()) {
+      std::stringstream strstr( runEvent );
+      unsigned long long run, event;
+      char sep;
+      if (!(strstr >> run >> sep >> event) || sep != ':' || !strstr.eof()) {
+         ATH_MSG_FATAL("EventSelector.SelectEvents entries must be <run>:<event>, got: " << runEvent);
+         return(StatusCode::FAILURE);
+      }
+      m_selectEvents.emplace_back(run, event);
+   }
+   std::sort(m_selectEvents.begin(), m_selectEvents.end());
+   m_selectEvents.erase(std::unique(m_selectEvents.begin(), m_selectEvents.end()), m_selectEvents.end());
+   if (!m_selectEvents.empty()) {
+      // The index gives entries in the DataHeader container of the payload files, found in their metadata
+      if (m_isSecondary.value() || m_collectionType.value() != "ImplicitROOT" || !m_processMetadata.value()) {
+         ATH_MSG_FATAL("EventSelector.SelectEvents needs a primary ImplicitROOT selector processing metadata");
+         return(StatusCode::FAILURE);
+      }
+      if (!m_inputMetaStore.retrieve().isSuccess()) {
+         ATH_MSG_FATAL("Cannot get " << m_inputMetaStore.typeAndName() << ".");
+         return(StatusCode::FAILURE);
+      }
+      ATH_MSG_INFO("Selecting " << m_selectEvents.size() << " events using the input event index");
+   }
    // Get IncidentSvc
    if (!m_incidentSvc.retrieve().isSuccess()) {
       ATH_MSG_FATAL("Cannot get " << m_incidentSvc.typeAndName() << ".");
@@ -262,6 +289,7 @@ StatusCode EventSelectorAthenaPool::reinit() const {
    m_inputCollectionsChanged = false;
    m_evtCount = 0;
    m_headerIterator = 0;
+   m_selectedEntriesReady = false;
    if (!m_eventStreamingTool.empty() && m_eventStreamingTool->isClient()) {
       ATH_MSG_INFO("Done reinitialization for shared reader client");
       return(StatusCode::SUCCESS);
@@ -389,6 +417,7 @@ StatusCode EventSelectorAthenaPool::start() {
       m_headerIterator = &m_poolCollectionConverter->executeQuery(/*m_query.value()*/);
    }
    m_evtCount = 0;
+   m_selectedEntriesReady = false;
    delete m_endIter;
    m_endIter = nullptr;
    m_endIter = new EventContextAthenaPool(nullptr);
@@ -644,8 +673,9 @@ StatusCode EventSelectorAthenaPool::nextHandleFileTransition(IEvtSelector::Conte
    }
    else {   // advance to the next (not needed after reinit)
       // Check if we're at the end of file
-      if (m_headerIterator == nullptr || m_headerIterator->next() == 0) {
+      if (m_headerIterator == nullptr || !nextHeader()) {
          m_headerIterator = nullptr;
+         m_selectedEntriesReady = false;
          // Close previous collection.
          delete m_poolCollectionConverter; m_poolCollectionConverter = nullptr;
 
@@ -707,6 +737,11 @@ StatusCode EventSelectorAthenaPool::nextHandleFileTransition(IEvtSelector::Conte
             FileIncident beginInputFileIncident(name(), "BeginInputFile", *m_inputCollectionsIterator, m_guid.toString());
             m_incidentSvc->fireIncident(beginInputFileIncident);
          }
+         if (!m_selectEvents.empty()) {
+            // The index is now in the input metadata: go to the first selected event
+            selectEntries();
+            return StatusCode::RECOVERABLE;
+         }
       } else {
          // Check if File is BS
          if (tech != 0x00001000 && m_processMetadata.value()) {
@@ -718,6 +753,63 @@ StatusCode EventSelectorAthenaPool::nextHandleFileTransition(IEvtSelector::Conte
    return StatusCode::SUCCESS;
 }
 //________________________________________________________________________________
+bool EventSelectorAthenaPool::nextHeader() const {
+   if (!m_selectedEntriesReady) {
+      return m_headerIterator->next() != 0;
+   }
+   if (m_nextSelectedEntry >= m_selectedEntries.size()) {
+      return false;
+   }
+   pool::IPositionSeek* is = dynamic_cast<pool::IPositionSeek*>(m_headerIterator);
+   if (is == nullptr) {
+      ATH_MSG_ERROR("Container does not allow seeking, reading the remaining events of " << *m_inputCollectionsIterator);
+      m_selectedEntriesReady = false;
+      return m_headerIterator->next() != 0;
+   }
+   // seek() positions before the entry, next() reads it
+   return is->seek(m_selectedEntries[m_nextSelectedEntry++]) && m_headerIterator->next() != 0;
+}
+//________________________________________________________________________________
+void EventSelectorAthenaPool::selectEntries() const {
+   m_selectedEntries.clear();
+   m_nextSelectedEntry = 0;
+   m_selectedEntriesReady = true;
+
+   std::string key = m_eventIndexKey.value();
+   if (key.empty()) {
+      std::vector<std::string> keys;
+      m_inputMetaStore->keys<std::vector<unsigned long long>>(keys);
+      auto it = std::find_if(keys.begin(), keys.end(),
+                             [](const std::string& k) { return k.compare(0, 11, "EventIndex_") == 0; });
+      if (it != keys.end()) key = *it;
+   }
+   const std::vector<unsigned long long>* index = nullptr;
+   if (key.empty() || !m_inputMetaStore->contains<std::vector<unsigned long long>>(key)
+       || !m_inputMetaStore->retrieve(index, key).isSuccess() || index->size() % 3 != 0) {
+      ATH_MSG_WARNING("No event index in " << *m_inputCollectionsIterator << ", skipping the file");
+      return;
+   }
+   // The index holds (run, event, entry) triplets sorted by run and event number
+   using Row = std::pair<unsigned long long, unsigned long long>;
+   const std::size_t rows = index->size() / 3;
+   auto rowAt = [index](std::size_t i) { return Row((*index)[3 * i], (*index)[3 * i + 1]); };
+   for (const Row& runEvent : m_selectEvents) {
+      std::size_t lo = 0, hi = rows;
+      while (lo < hi) {
+         const std::size_t mid = lo + (hi - lo) / 2;
+         if (rowAt(mid) < runEvent) lo = mid + 1;
+         else hi = mid;
+      }
+      for (; lo < rows && rowAt(lo) == runEvent; ++lo) {
+         m_selectedEntries.push_back((*index)[3 * lo + 2]);
+      }
+   }
+   // Read the file in order
+   std::sort(m_selectedEntries.begin(), m_selectedEntries.end());
+   ATH_MSG_DEBUG("Found " << m_selectedEntries.size() << " selected events in " << rows
+                 << " indexed events of " << *m_inputCollectionsIterator);
+}
+//________________________________________________________________________________
 StatusCode EventSelectorAthenaPool::nextWithSkip(IEvtSelector::Context& ctxt) const {
    ATH_MSG_DEBUG("EventSelectorAthenaPool::nextWithSkip");
 
@@ -822,6 +914,10 @@ StatusCode EventSelectorAthenaPool::resetCriteria(const std::string& /*criteria*
 }
 //__________________________________________________________________________
 StatusCode EventSelectorAthenaPool::seek(Context& /*ctxt*/, int evtNum) const {
+   if (!m_selectEvents.empty()) {
+      ATH_MSG_ERROR("seek() can not be used together with SelectEvents");
+      return(StatusCode::FAILURE);
+   }
 
    if( m_inputCollectionsChanged ) {
       StatusCode rc = reinit();
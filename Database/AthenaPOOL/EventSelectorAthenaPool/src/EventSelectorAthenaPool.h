@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef EVENTSELECTORATHENAPOOL_H
@@ -28,6 +28,8 @@
 
 #include <map>
 #include <atomic>
+#include <utility>
+#include <vector>
 
 // Forward declarations
 class IIncidentSvc;
@@ -164,6 +166,10 @@ private: // internal member functions
    int findEvent(int evtNum) const;
    /// Fires the EndInputFile incident (if there is an open file) at end of selector
    void fireEndFileIncidents(bool isLastFile) const;
+   /// Move the DataHeader iterator to the next event, or to the next selected event with SelectEvents.
+   bool nextHeader() const;
+   /// Find the entries of the SelectEvents events in the event index of the current input file.
+   void selectEntries() const;
 
 private: // data
    EventContextAthenaPool*         m_endIter{};
@@ -176,6 +182,7 @@ private: // data
 
    ServiceHandle<IAthenaPoolCnvSvc> m_athenaPoolCnvSvc{this, "AthenaPoolCnvSvc", "AthenaPoolCnvSvc", ""};
    ServiceHandle<IIncidentSvc> m_incidentSvc{this, "IncidentSvc", "IncidentSvc", ""};
+   ServiceHandle<StoreGateSvc> m_inputMetaStore{this, "InputMetaDataStore", "StoreGateSvc/InputMetaDataStore", ""};
 
 private: // properties
    /// IsSecondary, know if this is an instance of secondary event selector
@@ -242,6 +249,20 @@ private: // properties
    Gaudi::Property<std::string> m_skipEventRangesProp{this, "SkipEventRanges", {}, ""};
    mutable std::vector<std::pair<long,long>> m_skipEventRanges ATLAS_THREAD_SAFE;
 
+   /// SelectEvents, "<run>:<event>" numbers of the only events to read.
+   /// The events are located with the event index of each input file (written by MakeEventIndex),
+   /// which lets the selector seek to them directly; files without index are skipped.
+   Gaudi::Property<std::vector<std::string>> m_selectEventsProp{this, "SelectEvents", {}, ""};
+   /// EventIndexKey, key of the event index in the input metadata, by default the first EventIndex_* one.
+   Gaudi::Property<std::string> m_eventIndexKey{this, "EventIndexKey", "", ""};
+   /// sorted (run, event) numbers of the selected events
+   std::vector<std::pair<unsigned long long, unsigned long long>> m_selectEvents;
+   /// sorted entries of the selected events in the current input file
+   mutable std::vector<long long> m_selectedEntries ATLAS_THREAD_SAFE;
+   mutable std::size_t m_nextSelectedEntry ATLAS_THREAD_SAFE {};
+   /// m_selectedEntries is set for the current input file
+   mutable bool m_selectedEntriesReady ATLAS_THREAD_SAFE {};
+
    mutable std::atomic_int m_evtCount{}; // internal count of events
    mutable std::atomic_bool m_firedIncident{};
 
@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+"""Test the event selection with the event index
+
+The first step writes a file with the event index of its stream (MakeEventIndex),
+the second one (--read) reads back only some of its events with the SelectEvents
+property of the EventSelector and checks that they are the expected ones.
+
+Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+"""
+import sys
+from argparse import ArgumentParser
+
+from AthenaConfiguration.AllConfigFlags import initConfigFlags
+from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
+from AthenaConfiguration.MainServicesConfig import MainServicesCfg
+from AthenaConfiguration.TestDefaults import defaultTestFiles
+from AthenaPoolCnvSvc.PoolReadConfig import PoolReadCfg
+from AthenaPython.PyAthenaComps import Alg, StatusCode
+from OutputStreamAthenaPool.OutputStreamConfig import OutputStreamCfg, addEventIndex
+
+outputFile = "EventIndexSelection.pool.root"
+writtenEventsFile = "EventIndexSelection_written.txt"
+readEventsFile = "EventIndexSelection_read.txt"
+maxEvents = 20
+# Positions in the written file of the events to select, not in file order
+selectedPositions = [17, 3, 8]
+
+
+class RecordEvents(Alg):
+    """Writes the "<run>:<event>" numbers of the processed events to a text file"""
+    def __init__(self, name="RecordEvents", fileName=""):
+        Alg.__init__(self, name)
+        self.fileName = fileName
+        self.events = []
+
+    def execute(self):
+        ei = self.evtStore.retrieve("xAOD::EventInfo", "EventInfo")
+        self.events.append(f"{ei.runNumber()}:{ei.eventNumber()}")
+        return StatusCode.Success
+
+    def finalize(self):
+        with open(self.fileName, "w") as f:
+            f.write("".join(f"{event}\n" for event in self.events))
+        return StatusCode.Success
+
+
+def readEvents(fileName):
+    with open(fileName) as f:
+        return f.read().split()
+
+
+parser = ArgumentParser(prog='test_EventIndexSelection')
+parser.add_argument("--read", default=False, action="store_true",
+                    help="Read the selected events of the file written by the first step")
+args = parser.parse_args()
+
+flags = initConfigFlags()
+if args.read:
+    flags.Input.Files = [outputFile]
+else:
+    flags.Input.Files = defaultTestFiles.AOD_RUN2_MC
+    flags.Output.AODFileName = outputFile
+flags.lock()
+
+acc = MainServicesCfg(flags)
+acc.merge(PoolReadCfg(flags))
+
+algs = ComponentAccumulator()
+algs.addEventAlgo(RecordEvents(fileName=readEventsFile if args.read else writtenEventsFile))
+acc.merge(algs)
+
+if args.read:
+    written = readEvents(writtenEventsFile)
+    selector = acc.getService("EventSelector")
+    # An event that is not in the file is ignored
+    selector.SelectEvents = [written[i] for i in selectedPositions] + ["999999:1"]
+    selector.EventIndexKey = "EventIndex_StreamAOD"
+else:
+    acc.merge(OutputStreamCfg(flags, "AOD",
+                              ItemList=["xAOD::EventInfo#EventInfo",
+                                        "xAOD::EventAuxInfo#EventInfoAux."]))
+    acc.merge(addEventIndex(flags, "AOD"))
+
+sc = acc.run(maxEvents=maxEvents)
+if not sc.isSuccess():
+    sys.exit(1)
+
+if args.read:
+    # The selected events are read in file order
+    expected = [written[i] for i in sorted(selectedPositions)]
+    read = readEvents(readEventsFile)
+    print(f"Selected events read: {read}")
+    if read != expected:
+        print(f"Events read differ from the expected {expected}")
+        sys.exit(1)
+elif len(readEvents(writtenEventsFile)) != maxEvents:
+    print(f"Not all the {maxEvents} events were written")
+    sys.exit(1)
+
+sys.exit(0)
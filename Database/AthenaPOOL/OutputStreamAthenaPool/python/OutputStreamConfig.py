@@ -1,9 +1,33 @@
-# Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator, ConfigurationError
 from AthenaConfiguration.ComponentFactory import CompFactory
 from AthenaConfiguration.Enums import ProductionStep
 from AthenaCommon.Logging import logging
+import re
+
+
+def extractAuxCodecs(itemList):
+   """
+   Strip the codec annotations from the aux variables of an ItemList
+
+   A dynamic aux variable can be given a codec, applied when it is written, as in
+   "xAOD::JetAuxContainer#AnalysisJetsAux.pt{mantissa:10}.eta{fixed:16:-5:5,shuffle}"
+   (see CxxUtils/ArrayCodec.h for the available codecs).
+
+   Returns the ItemList without the annotations and a dictionary of the codecs
+   keyed by "<key>Aux.<attribute>"
+   """
+   codecRE = re.compile(r"(\w+)\{([^}]*)\}")
+   items, codecs = [], {}
+   for item in itemList:
+      if "{" in item and "#" in item:
+         key = item.split("#", 1)[1].split(".", 1)[0]
+         for attr, codec in codecRE.findall(item):
+            codecs[f"{key}.{attr}"] = codec
+         item = codecRE.sub(r"\1", item)
+      items.append(item)
+   return items, codecs
 
 
 def OutputStreamCfg(flags, streamName, ItemList=[], MetadataItemList=[],
@@ -52,6 +76,14 @@ def OutputStreamCfg(flags, streamName, ItemList=[], MetadataItemList=[],
       writingTool.MetaDataPoolContainerPrefix = f"MetaData_{streamName}"
       msg.info("Stream %s running in augmentation mode with %s as parent", streamName, flags._get(parentStream))
 
+   # Codecs requested for aux variables are passed to the writers as POOL attributes
+   ItemList, auxCodecs = extractAuxCodecs(ItemList)
+   if auxCodecs:
+      from AthenaPoolCnvSvc.PoolAttributeHelper import setAuxCodec
+      from AthenaPoolCnvSvc.PoolCommonConfig import AthenaPoolCnvSvcCfg
+      result.merge(AthenaPoolCnvSvcCfg(flags, PoolAttributes=[
+         setAuxCodec(fileName, auxName, codec) for auxName, codec in auxCodecs.items()]))
+
    # In DAOD production the EventInfo is prepared specially by the SlimmingHelper to ensure it is written in AuxDyn form
    # So for derivations the ItemList from the SlimmingHelper alone is used without the extra EventInfo items
    finalItemList = []
@@ -163,3 +195,20 @@ def addToMetaData(flags, streamName, itemOrList, AcceptAlgs=[], HelperTools=[],
    items = [itemOrList] if isinstance(itemOrList, str) else itemOrList
    return OutputStreamCfg(flags, streamName, MetadataItemList=items,
                           AcceptAlgs=AcceptAlgs, HelperTools=HelperTools, **kwargs)
+
+def addEventIndex(flags, streamName, **kwargs):
+   """
+   Writes the run/event number index of the stream named streamName
+
+   The index lets EventSelectorAthenaPool read only the events given in its SelectEvents
+   property when the file is used as input. The entries it stores are only valid if this
+   stream is the sole writer of the file, so it must not be used with the shared writer.
+
+   Returns CA to be merged
+   """
+   outputStreamName = f"Stream{streamName}"
+   indexTool = CompFactory.MakeEventIndex(f"{outputStreamName}_MakeEventIndex",
+                                          DataHeaderKey=outputStreamName)
+   return addToMetaData(flags, streamName,
+                        f"std::vector<unsigned long long>#EventIndex_{outputStreamName}",
+                        HelperTools=[indexTool], **kwargs)
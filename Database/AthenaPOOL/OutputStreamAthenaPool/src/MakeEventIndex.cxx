@@ -0,0 +1,126 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+/** @file MakeEventIndex.cxx
+ *  @brief This file contains the implementation for the MakeEventIndex class.
+ **/
+
+#include "MakeEventIndex.h"
+
+#include "GaudiKernel/IAlgorithm.h"
+
+#include "PersistentDataModel/DataHeader.h"
+#include "EventInfo/EventInfo.h"
+#include "EventInfo/EventID.h"
+#include "SGTools/StlVectorClids.h"
+#include "StoreGate/ReadHandle.h"
+#include "xAODEventInfo/EventInfo.h"
+
+#include <algorithm>
+#include <memory>
+
+//___________________________________________________________________________
+MakeEventIndex::MakeEventIndex(const std::string& type,
+	const std::string& name,
+	const IInterface* parent) : base_class(type, name, parent)
+{
+}
+//___________________________________________________________________________
+MakeEventIndex::~MakeEventIndex() {
+}
+//___________________________________________________________________________
+StatusCode MakeEventIndex::initialize() {
+   ATH_MSG_DEBUG("Initializing " << name());
+   // Locate the MetaDataStore
+   if (!m_metaDataSvc.retrieve().isSuccess()) {
+      ATH_MSG_FATAL("Could not find MetaDataSvc");
+      return(StatusCode::FAILURE);
+   }
+
+   // Autoconfigure data header key
+   if (m_dataHeaderKey.empty()){
+      const IAlgorithm* parentAlg = dynamic_cast<const IAlgorithm*>(this->parent());
+      if (parentAlg == nullptr) {
+         ATH_MSG_ERROR("Unable to get parent Algorithm");
+         return(StatusCode::FAILURE);
+      }
+      m_dataHeaderKey.setValue(parentAlg->name());
+   }
+   if (m_key.empty()) {
+      m_key.setValue("EventIndex_" + m_dataHeaderKey.value());
+   }
+
+   m_index.clear();
+
+   return(StatusCode::SUCCESS);
+}
+//___________________________________________________________________________
+StatusCode MakeEventIndex::postInitialize() {
+   // Remove an index with same key if it exists
+   bool ignoreIfAbsent = true;
+   if( !m_metaDataSvc->remove<std::vector<unsigned long long>>(m_key.value(), ignoreIfAbsent).isSuccess() ) {
+      ATH_MSG_ERROR("Unable to remove event index with key " << m_key.value());
+      return StatusCode::FAILURE;
+   }
+   return(StatusCode::SUCCESS);
+}
+//___________________________________________________________________________
+StatusCode MakeEventIndex::preExecute() {
+   return(StatusCode::SUCCESS);
+}
+//___________________________________________________________________________
+StatusCode MakeEventIndex::preStream() {
+   return(StatusCode::SUCCESS);
+}
+//___________________________________________________________________________
+StatusCode MakeEventIndex::postExecute() {
+   // The DataHeader is only there if the event was written
+   SG::ReadHandle<DataHeader> dataHeader(m_dataHeaderKey);
+   if (!dataHeader.isValid()) {
+      return(StatusCode::SUCCESS);
+   }
+   unsigned long long runN = 0;
+   unsigned long long evtN = 0;
+   SG::ReadHandle<xAOD::EventInfo> xEventInfo(m_eventInfoKey);
+   if (xEventInfo.isValid()) {
+      runN = xEventInfo->runNumber();
+      evtN = xEventInfo->eventNumber();
+   } else {
+      SG::ReadHandle<EventInfo> oEventInfo(m_oEventInfoKey);
+      if (oEventInfo.isValid()) {
+         runN = oEventInfo->event_ID()->run_number();
+         evtN = oEventInfo->event_ID()->event_number();
+      } else {
+         ATH_MSG_ERROR("Unable to retrieve EventInfo object");
+         return(StatusCode::FAILURE);
+      }
+   }
+   const unsigned long long entry = m_index.size();
+   m_index.push_back({runN, evtN, entry});
+   return(StatusCode::SUCCESS);
+}
+//___________________________________________________________________________
+StatusCode MakeEventIndex::preFinalize() {
+   // Sort by run and event number, the entries keep duplicates in write order
+   std::sort(m_index.begin(), m_index.end());
+
+   auto index = std::make_unique<std::vector<unsigned long long>>();
+   index->reserve(3 * m_index.size());
+   for (const auto& row : m_index) {
+      index->insert(index->end(), row.begin(), row.end());
+   }
+   ATH_MSG_DEBUG("Recording event index " << m_key.value() << " of " << m_index.size() << " events");
+   m_index.clear();
+   ATH_CHECK(m_metaDataSvc->record(std::move(index), m_key.value()));
+   return(StatusCode::SUCCESS);
+}
+//___________________________________________________________________________
+StatusCode MakeEventIndex::finalize() {
+   ATH_MSG_DEBUG("in finalize()");
+   // release the MetaDataStore
+   if (!m_metaDataSvc.release().isSuccess()) {
+      ATH_MSG_WARNING("Could not release MetaDataStore");
+   }
+   return(StatusCode::SUCCESS);
+}
@@ -0,0 +1,71 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef MAKEEVENTINDEX_H
+#define MAKEEVENTINDEX_H
+/** @file MakeEventIndex.h
+ *  @brief This file contains the class definition for the MakeEventIndex class.
+ **/
+
+#include "AthenaKernel/IAthenaOutputTool.h"
+
+#include "AthenaBaseComps/AthAlgTool.h"
+#include "GaudiKernel/ServiceHandle.h"
+#include "AthenaKernel/IMetaDataSvc.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+/** @class MakeEventIndex
+ *  @brief This class provides a tool to write the run/event number index of an output file.
+ *
+ *  For each event written to the stream the (run number, event number, entry) triplet is
+ *  collected, where entry is the position of the event in the DataHeader container of the file.
+ *  At the end of the job the triplets are sorted by run and event number and recorded, as one flat
+ *  std::vector<unsigned long long>, in the MetaDataStore. EventSelectorAthenaPool uses it to
+ *  seek directly to selected events (see its SelectEvents property).
+ *  The entries are only valid if this stream is the only writer of the file: it must not be used
+ *  with the shared writer, which interleaves the events of several workers.
+ **/
+class MakeEventIndex : public extends<::AthAlgTool, IAthenaOutputTool> {
+public:
+   /// Standard AlgTool Constructor
+   MakeEventIndex(const std::string& type, const std::string& name, const IInterface* parent);
+   /// Destructor
+   virtual ~MakeEventIndex();
+   /// Required of all IAthenaOutputTools:
+   /// Called by AthenaOutputStream::initialize() (via ToolSvc retrieve()).
+   virtual StatusCode initialize() override;
+   /// Called at the end of AthenaOutputStream::initialize().
+   virtual StatusCode postInitialize() override;
+   /// Called at the beginning of AthenaOutputStream::execute().
+   virtual StatusCode preExecute() override;
+   /// Called before actually streaming objects.
+   virtual StatusCode preStream() override;
+   /// Called at the end of AthenaOutputStream::execute().
+   virtual StatusCode postExecute() override;
+   /// Called at the beginning of AthenaOutputStream::finalize().
+   virtual StatusCode preFinalize() override;
+   /// Called at the end of AthenaOutputStream::finalize() (via release()).
+   virtual StatusCode finalize() override;
+
+private:
+   /// Name of DataHeader key
+   StringProperty m_dataHeaderKey{this, "DataHeaderKey", "", "name of the data header key"};
+   /// Key, the StoreGate key for the index, default is EventIndex_<DataHeaderKey>.
+   StringProperty m_key{this, "Key", "", "name of the event index object"};
+
+   /// Key, the StoreGate key for the xAOD::EventInfo object.
+   StringProperty m_eventInfoKey{this, "EventInfoKey", "EventInfo", "name of the xAOD::EventInfo"};
+   /// Key, the StoreGate key for the old EventInfo object, if there is no xAOD::EventInfo.
+   StringProperty m_oEventInfoKey{this, "OldEventInfoKey", "McEventInfo", "name of the legacy EventInfo"};
+
+   /// Pointer to the metadata store
+   ServiceHandle<IMetaDataSvc> m_metaDataSvc{this, "MetaDataSvc", "MetaDataSvc"};
+
+   /// (run, event, entry) triplets of the events written so far
+   std::vector<std::array<unsigned long long, 3>> m_index;
+};
+#endif
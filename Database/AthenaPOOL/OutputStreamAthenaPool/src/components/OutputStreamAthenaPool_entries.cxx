@@ -1,10 +1,12 @@
 #include "../MakeInputDataHeader.h"
 #include "../MakeEventStreamInfo.h"
+#include "../MakeEventIndex.h"
 #include "../CopyEventStreamInfo.h"
 #include "../EventInfoAttListTool.h"
 #include "../EventInfoTagBuilder.h"
 
 DECLARE_COMPONENT( MakeEventStreamInfo )
+DECLARE_COMPONENT( MakeEventIndex )
 DECLARE_COMPONENT( CopyEventStreamInfo )
 DECLARE_COMPONENT( EventInfoAttListTool )
 DECLARE_COMPONENT( MakeInputDataHeader )
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /** @file PoolSvc.cxx
@@ -198,6 +198,19 @@ StatusCode PoolSvc::setupPersistencySvc() {
       ATH_MSG_FATAL("Failed to enable thread safety in ROOT via PersistencySvc.");
       return(StatusCode::FAILURE);
    }
+   // Must be set before the input files are opened
+   if (m_useROOTAsyncPrefetching && !m_persistencySvcVec[IPoolSvc::kInputStream]->session().technologySpecificAttributes(pool::ROOT_StorageType.type()).setAttribute<bool>("ENABLE_ASYNC_PREFETCHING", true)) {
+      ATH_MSG_FATAL("Failed to enable asynchronous prefetching in ROOT via PersistencySvc.");
+      return(StatusCode::FAILURE);
+   }
+   // The decompression runs in the implicit multithreading thread pool, enabled in start()
+   if (m_useROOTParallelUnzip && m_useROOTIMT && Gaudi::Concurrency::ConcurrencyFlags::numThreads() > 1) {
+      if (!m_persistencySvcVec[IPoolSvc::kInputStream]->session().technologySpecificAttributes(pool::ROOT_StorageType.type()).setAttribute<bool>("ENABLE_PARALLEL_UNZIP", true)) {
+         ATH_MSG_FATAL("Failed to enable parallel decompression in ROOT via PersistencySvc.");
+         return(StatusCode::FAILURE);
+      }
+      ATH_MSG_INFO("Enabled parallel decompression of the input clusters in ROOT via PersistencySvc");
+   }
    m_contextMaxFile.insert(std::pair<unsigned int, int>(IPoolSvc::kInputStream, m_dbAgeLimit));
    if (!connect(pool::ITransaction::READ, IPoolSvc::kInputStream).isSuccess()) {
       ATH_MSG_FATAL("Failed to connect Input PersistencySvc.");
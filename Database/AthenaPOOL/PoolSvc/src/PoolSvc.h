@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef POOLSVC_H
@@ -235,6 +235,10 @@ private: // properties
    BooleanProperty m_useROOTIMT{this,"UseROOTImplicitMT",true};
    /// Increase virtual TTree size to avoid backreads in multithreading, default = false.
    BooleanProperty m_useROOTMaxTree{this,"UseROOTIncreaseVMaxTree",false};
+   /// Decompress the baskets (pages) of the next TTree (RNTuple) cluster in parallel with ROOT Implicit MT, default = false.
+   BooleanProperty m_useROOTParallelUnzip{this,"UseROOTParallelUnzip",false};
+   /// Read the next cluster of the input files in a background thread, default = false.
+   BooleanProperty m_useROOTAsyncPrefetching{this,"UseROOTAsyncPrefetching",false};
 
    /// AttemptCatalogPatch, option to create catalog: default = false.
    BooleanProperty m_attemptCatalogPatch{this,"AttemptCatalogPatch",true};
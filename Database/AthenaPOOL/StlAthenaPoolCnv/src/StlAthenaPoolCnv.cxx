@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "AthenaPoolCnvSvc/T_AthenaPoolCnv.h"
@@ -67,6 +67,7 @@ DECL_CNV(std::vector<int>, AthenaPoolStdVectorIntCnv)
 DECL_CNV(std::vector<unsigned int>, AthenaPoolStdVectorUIntCnv)
 DECL_CNV(std::vector<float>, AthenaPoolStdVectorFloatCnv)
 DECL_CNV(std::vector<double>, AthenaPoolStdVectorDoubleCnv)
+DECL_CNV(std::vector<unsigned long long>, AthenaPoolStdVectorULongLongCnv)
 
 #include "SGTools/StlMapClids.h"
 DECL2_CNV(std::map<int, int>, AthenaPoolStdMapIntIntCnv)
@@ -1,10 +1,15 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ROOTAUXDYN_IO_H
 #define ROOTAUXDYN_IO_H
 
+#include "AthContainersInterfaces/AuxTypes.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
 #include <string>
 #include <mutex>
 
@@ -32,6 +37,12 @@ namespace RootAuxDynIO
    constexpr char   AUXDYN_POSTFIX[] = "Dyn.";
    constexpr size_t AUXDYN_POSTFIX_LEN = sizeof(AUXDYN_POSTFIX)-1;
 
+   /// Codec specifications (see CxxUtils::ArrayCodec) for dynamic attributes,
+   /// keyed by "<SG key>Aux.<attribute name>"
+   typedef std::map<std::string, std::string>  AuxCodecMap_t;
+   /// Prefix of the RNTuple field description recording the codec of a dynamic attribute
+   constexpr char   AUXCODEC_PREFIX[] = "codec=";
+
    /// check if a string ends with AUX_POSTFIX
    inline bool endsWithAuxPostfix(std::string_view str) {
       return str.size() >= AUX_POSTFIX_LEN and
@@ -67,6 +78,17 @@ namespace RootAuxDynIO
    */
    std::string getKeyFromBranch(TBranch* branch);
 
+  /**
+   * @brief Find the codec configured for a dynamic attribute
+   * @param codecs the configured codecs
+   * @param attr_name the name of the attribute
+   * @param baseName branch or field name of the main AuxStore object
+   *
+   * Returns an empty string if no codec is configured for this attribute.
+   */
+   std::string findAuxCodec(const AuxCodecMap_t& codecs, const std::string& attr_name,
+                            const std::string& baseName);
+
    std::unique_ptr<IRootAuxDynReader> getBranchAuxDynReader(TTree*, TBranch*);
    std::unique_ptr<IRootAuxDynWriter> getBranchAuxDynWriter(TTree*, int bufferSize, int splitLevel,
                                                               int offsettab_len, bool do_branch_fill);
@@ -76,6 +98,25 @@ namespace RootAuxDynIO
    std::unique_ptr<IRNTupleWriter>    getNTupleAuxDynWriter(TFile*,  const std::string& ntupleName, int compression);
 
 
+   /// Summary of the dynamic attributes of AuxStores in a file, split by whether they were read
+   struct AuxDynReadStats
+   {
+      size_t   touchedAttributes = 0;
+      size_t   untouchedAttributes = 0;
+      /// size on disk (compressed) of the attributes, where the reader knows it
+      size_t   touchedBytes = 0;
+      size_t   untouchedBytes = 0;
+
+      AuxDynReadStats& operator+=(const AuxDynReadStats& other) {
+         touchedAttributes += other.touchedAttributes;
+         untouchedAttributes += other.untouchedAttributes;
+         touchedBytes += other.touchedBytes;
+         untouchedBytes += other.untouchedBytes;
+         return *this;
+      }
+   };
+
+
    class IRootAuxDynReader
    {
    public :
@@ -95,6 +136,13 @@ namespace RootAuxDynIO
 
       virtual void resetBytesRead() = 0; 
 
+      /// Attributes read so far (on first access) and those never read
+      virtual AuxDynReadStats readStats() const = 0;
+
+      /// Attribute cheapest to read when only the number of elements of the store is needed,
+      /// null_auxid if the reader can not tell
+      virtual SG::auxid_t sizeAuxID() const = 0;
+
       virtual ~IRootAuxDynReader() {}
    };
 
@@ -117,6 +165,9 @@ namespace RootAuxDynIO
 
       /// set per-branch independent commit/fill mode
       virtual void setBranchFillMode(bool) = 0;
+
+      /// set the codecs applied to dynamic attributes before writing
+      virtual void setAuxCodecs(const AuxCodecMap_t& codecs) = 0;
    };
 
    
@@ -140,6 +191,9 @@ namespace RootAuxDynIO
       //  may throw exceptions
       virtual int writeAuxAttributes(const std::string& base_branch, SG::IAuxStoreIO* store, size_t rows_written ) = 0;
 
+      /// set the codecs applied to dynamic attributes before writing
+      virtual void setAuxCodecs(const AuxCodecMap_t& codecs) = 0;
+
       /// Add a APR container to this RNTuple - if there is more than one than do grouped DB commit
       virtual void increaseClientCount() = 0;
       /// Check if there is more than one container writing to this RNTuple
@@ -151,6 +205,10 @@ namespace RootAuxDynIO
       /// Call Fill() on the ROOT object used by this writer
       virtual int commit() = 0;
 
+      /// Finish the RNTuple written so far (with its compressed clusters) so the file content
+      /// can be shipped away, and start a new one with the same fields at the next commit
+      virtual void closeSegment() = 0;
+
       virtual void close() = 0;
    };
 
@@ -0,0 +1,69 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "AuxCodecBuffer.h"
+#include "AthContainers/AuxTypeRegistry.h"
+#include "CxxUtils/checker_macros.h"
+
+#include <cstring>
+
+
+namespace RootAuxDynIO
+{
+
+   bool AuxCodecBuffer::init( SG::auxid_t auxid, const std::type_info& io_type, const std::string& spec )
+   {
+      const SG::AuxTypeRegistry& r = SG::AuxTypeRegistry::instance();
+      CxxUtils::ArrayCodec codec( spec );
+      const std::type_info* elt_type = r.getType(auxid);
+      const std::type_info* vec_type = r.getVecType(auxid);
+      // only plain vectors (or single elements for standalone objects) of numbers
+      const bool isVector = vec_type and io_type == *vec_type;
+      if( !elt_type or !( isVector or io_type == *elt_type ) or !codec.supports(*elt_type) ) {
+         return false;
+      }
+      m_auxid = auxid;
+      m_codec = std::move(codec);
+      m_eltType = elt_type;
+      m_eltSize = r.getEltSize(auxid);
+      m_isVector = isVector;
+      m_buffer = r.makeVector(auxid, 0, 0);
+      return true;
+   }
+
+
+   void* AuxCodecBuffer::encode( const void* data )
+   {
+      size_t n = 1;
+      const void* elts = data;
+      std::unique_ptr<SG::IAuxTypeVector> src;
+      if( m_isVector ) {
+         // non-owning view of the std::vector being written
+         void* vec ATLAS_THREAD_SAFE = const_cast<void*>( data );
+         src = SG::AuxTypeRegistry::instance().makeVectorFromData(m_auxid, vec, false, false);
+         n = src->size();
+         elts = src->toPtr();
+      }
+      m_buffer->resize(n);
+      if( n > 0 ) {
+         std::memcpy( m_buffer->toPtr(), elts, n * m_eltSize );
+         m_codec.encode( *m_eltType, m_buffer->toPtr(), n );
+      }
+      return m_isVector ? m_buffer->toVector() : m_buffer->toPtr();
+   }
+
+
+   void* AuxCodecBuffer::encodeDefault()
+   {
+      // a zero element is not zero once encoded, e.g. with a fixed-point range
+      const size_t n = m_isVector ? 0 : 1;
+      m_buffer->resize(n);
+      if( n > 0 ) {
+         std::memset( m_buffer->toPtr(), 0, n * m_eltSize );
+         m_codec.encode( *m_eltType, m_buffer->toPtr(), n );
+      }
+      return m_isVector ? m_buffer->toVector() : m_buffer->toPtr();
+   }
+
+} // namespace
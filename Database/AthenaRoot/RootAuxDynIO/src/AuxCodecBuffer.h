@@ -0,0 +1,54 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef AUXCODECBUFFER_H
+#define AUXCODECBUFFER_H
+
+#include "AthContainersInterfaces/AuxTypes.h"
+#include "AthContainersInterfaces/IAuxTypeVector.h"
+#include "CxxUtils/ArrayCodec.h"
+
+#include <memory>
+#include <string>
+#include <typeinfo>
+
+
+namespace RootAuxDynIO
+{
+
+   /// Applies a codec to a dynamic attribute before it is written.
+   /// The data is encoded in a copy of the same type, kept until the next write.
+   class AuxCodecBuffer
+   {
+   public:
+      /// set up the codec @c spec for attribute @c auxid written as @c io_type
+      /// returns false if the codec can not be applied to this attribute
+      //  throws std::invalid_argument if the spec is not valid
+      bool init( SG::auxid_t auxid, const std::type_info& io_type, const std::string& spec );
+
+      /// is there a codec to apply?
+      bool empty() const { return m_codec.empty(); }
+
+      const CxxUtils::ArrayCodec& codec() const { return m_codec; }
+
+      /// encode a copy of @c data (as returned by IAuxStoreIO::getIOData())
+      /// and return the address of the copy, with the same type as @c data
+      void* encode( const void* data );
+
+      /// encode a default object (an empty vector, or a zero element)
+      /// to write in the rows where the attribute is missing, or when backfilling,
+      /// and return its address with the same type as encode()
+      void* encodeDefault();
+
+   private:
+      SG::auxid_t                          m_auxid = SG::null_auxid;
+      CxxUtils::ArrayCodec                 m_codec;
+      const std::type_info*                m_eltType = nullptr;
+      size_t                               m_eltSize = 0;
+      bool                                 m_isVector = false;
+      std::unique_ptr<SG::IAuxTypeVector>  m_buffer;
+   };
+
+} // namespace
+#endif
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "AthContainersInterfaces/IAuxStoreHolder.h"
@@ -20,6 +20,7 @@
 
 
 #include <ROOT/RNTuple.hxx>
+#include <stdexcept>
 using std::string;
 
 namespace {
@@ -216,6 +217,21 @@ namespace RootAuxDynIO
             }
          }
 #endif
+         // codec applied when writing, recorded by RNTupleAuxDynWriter in the field description
+         const string description = fieldInfo.field->GetDescription();
+         if( description.rfind(AUXCODEC_PREFIX, 0) == 0 ) {
+            try {
+               fieldInfo.codec = CxxUtils::ArrayCodec( description.substr(std::char_traits<char>::length(AUXCODEC_PREFIX)) );
+            } catch( const std::invalid_argument& e ) {
+               fieldInfo.status = FieldInfo::TypeError;
+               throw string("Error reading codec for AUX field ") + fieldInfo.field->GetName() + ": " + e.what();
+            }
+            if( fieldInfo.isPackedContainer ) {
+               fieldInfo.status = FieldInfo::TypeError;
+               throw string("Can not decode packed AUX field ") + fieldInfo.field->GetName()
+                  + " with codec '" + fieldInfo.codec.spec() + "'";
+            }
+         }
          /*
            string elem_tname, branch_tname;
            const type_info* ti = getAuxElementType( fieldInfo.tclass, typ, store.standalone(),
@@ -250,6 +266,19 @@ namespace RootAuxDynIO
    }
 
 
+   // Attributes are read only on first access (see RNTupleAuxDynStore::readData),
+   // so the ones with an initialized FieldInfo are those read
+   AuxDynReadStats RNTupleAuxDynReader::readStats() const
+   {
+      AuxDynReadStats stats;
+      for( const auto& info : m_fieldInfos ) {
+         if( info.second.status == FieldInfo::Initialized ) ++stats.touchedAttributes;
+         else if( info.second.field ) ++stats.untouchedAttributes;
+      }
+      return stats;
+   }
+
+
    void RNTupleAuxDynReader::addReaderToObject(void* object, size_t row, std::recursive_mutex* iomtx)
    {
       auto store_holder = reinterpret_cast<SG::IAuxStoreHolder*>((char*)object + m_storeHolderOffset);
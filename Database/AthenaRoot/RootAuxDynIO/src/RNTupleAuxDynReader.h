@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef RNTUPLEAUXDYNREADER_H
@@ -8,6 +8,7 @@
 #include "AthenaBaseComps/AthMessaging.h"
 #include "AthContainers/AuxStoreInternal.h" 
 #include "RootAuxDynIO/RootAuxDynIO.h" 
+#include "CxxUtils/ArrayCodec.h"
 
 #include <map>
 #include <string>
@@ -42,6 +43,8 @@ namespace RootAuxDynIO
          SG::auxid_t   auxid;
          std::string   attribName;
          std::unique_ptr<RFieldBase>  field;
+         // codec to undo after reading
+         CxxUtils::ArrayCodec  codec;
       };
 
 
@@ -63,6 +66,11 @@ namespace RootAuxDynIO
 
       virtual void resetBytesRead() override final;
 
+      /// attribute counts only, the size on disk of the fields is not collected
+      virtual AuxDynReadStats readStats() const override final;
+
+      virtual SG::auxid_t sizeAuxID() const override final;
+
       /// get field informatino for @c auxid
       const FieldInfo& getFieldInfo(const SG::auxid_t& auxid, const SG::AuxStoreInternal& store);
 
@@ -101,6 +109,10 @@ namespace RootAuxDynIO
       m_bytesRead = 0;
    }
 
+   inline SG::auxid_t RNTupleAuxDynReader::sizeAuxID() const {
+      return SG::null_auxid;
+   }
+
    inline const SG::auxid_set_t& RNTupleAuxDynReader::auxIDs() const {
       return m_auxids;
    }
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -59,6 +59,9 @@ bool RNTupleAuxDynStore::readData(SG::auxid_t auxid)
       }
       // read OK
       m_reader.addBytes(nbytes);
+      if( fieldInfo.codec.needsDecode() ) {
+         decodeData(auxid, fieldInfo.codec);
+      }
    }
    catch(const std::string& e_str) {
       ATHCONTAINERS_ERROR("RNTupleAuxDynStore::getData", e_str);
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "RNTupleAuxDynWriter.h"
@@ -66,6 +66,28 @@ namespace RootAuxDynIO
          const std::string field_name = RootAuxDynIO::auxFieldName( attr_name, base_name );
          void* attr_data ATLAS_THREAD_SAFE = const_cast<void*>( store->getIOData(id) );
 
+         auto [codec_it, is_new] = m_codecBuffers.try_emplace( field_name );
+         AuxCodecBuffer& codec = codec_it->second;
+         if( is_new ) {
+            const std::string spec = RootAuxDynIO::findAuxCodec( m_codecs, attr_name, base_name );
+            if( !spec.empty() and m_rowN > 0 ) {
+               // the rows written before the field was added read back as unencoded default values
+               ATH_MSG_WARNING("Codec '" << spec << "' can not be applied to " << field_name
+                               << " added after the first row - writing it unencoded");
+            } else if( !spec.empty() ) {
+               if( codec.init( id, *store->getIOType(id), spec ) ) {
+                  ATH_MSG_DEBUG("Using codec '" << spec << "' for " << field_name);
+               } else {
+                  ATH_MSG_WARNING("Codec '" << spec << "' can not be applied to " << field_name
+                                  << " of type " << attr_type << " - writing it unencoded");
+               }
+            }
+         }
+         if( !codec.empty() ) {
+            // write an encoded copy, leaving the data in the store unchanged
+            attr_data = codec.encode( attr_data );
+         }
+
          addAttribute( field_name, attr_type, attr_data );
       }
       return 0;  // MN: can get bytes written only when calling Fill() at commit
@@ -105,7 +127,7 @@ namespace RootAuxDynIO
                               + field_name + "new type: " + attr_type );
       }
       ATH_MSG_DEBUG("Adding new object column, name="<< field_name << " of type " << attr_type);
-      auto field = RFieldBase::Create(field_name, attr_type).Unwrap();
+      auto field = createField(field_name, attr_type);
       if( !m_model ) {
 #if ROOT_VERSION_CODE > ROOT_VERSION( 6, 29, 0 )
          // first write was already done, need to update the model
@@ -119,6 +141,20 @@ namespace RootAuxDynIO
          m_model->AddField( std::move(field) );
       }
       m_attrDataMap[ field_name ] = nullptr;
+      m_fieldTypes.emplace_back( field_name, attr_type );
+   }
+
+
+   std::unique_ptr<RFieldBase>
+   RNTupleAuxDynWriter::createField( const std::string& field_name, const std::string& attr_type )
+   {
+      auto field = RFieldBase::Create(field_name, attr_type).Unwrap();
+      auto codec_it = m_codecBuffers.find(field_name);
+      if( codec_it != m_codecBuffers.end() and !codec_it->second.empty() ) {
+         // the reader finds the codec in the field description
+         field->SetDescription( AUXCODEC_PREFIX + codec_it->second.codec().spec() );
+      }
+      return field;
    }
 
 
@@ -162,6 +198,12 @@ namespace RootAuxDynIO
       int attrN = 0;
       for( auto& attr: m_attrDataMap ) {
          ATH_MSG_VERBOSE("Setting data ptr for field# " << ++attrN << ": " << attr.first << "  data=" << std::hex << attr.second << std::dec );
+         auto codec_it = m_codecBuffers.find(attr.first);
+         if( !attr.second and codec_it != m_codecBuffers.end() and !codec_it->second.empty() ) {
+            // a default value would not decode as such
+            ATH_MSG_DEBUG("Writing encoded default object for field: " << attr.first );
+            attr.second = codec_it->second.encodeDefault();
+         }
          if( !attr.second ) {
             if( m_generatedValues.find(attr.first) == m_generatedValues.end() ) {
                ATH_MSG_DEBUG("Generating default object for field: " << attr.first );
@@ -194,6 +236,29 @@ namespace RootAuxDynIO
    }
 
 
+   void RNTupleAuxDynWriter::closeSegment() {
+#if ROOT_VERSION_CODE >= ROOT_VERSION( 6, 29, 0 )
+      // nothing written since the last segment
+      if( !m_ntupleWriter ) return;
+      ATH_MSG_DEBUG("Closing RNTuple segment " << m_ntupleName << " at row=" << m_rowN);
+      // the default values refer to the fields of the current model
+      m_generatedValues.clear();
+      // writes the last cluster and the footer
+      m_ntupleWriter.reset(); m_entry.reset();
+      // the rows of the next segment are counted from its start, as for the reset TTrees
+      m_rowN = 0;
+      // the next commit creates a new RNTuple in the file with the same fields
+      m_model = RNTupleModel::Create();
+      m_model->SetDescription( m_ntupleName );
+      for( const auto& [field_name, attr_type] : m_fieldTypes ) {
+         m_model->AddField( createField(field_name, attr_type) );
+      }
+#else
+      ATH_MSG_WARNING("closeSegment not implemented for this ROOT version");
+#endif
+   }
+
+
    void RNTupleAuxDynWriter::close() {
       // delete the generated default fields (RField should delete the default data objest)
 #if ROOT_VERSION_CODE >= ROOT_VERSION( 6, 29, 0 )
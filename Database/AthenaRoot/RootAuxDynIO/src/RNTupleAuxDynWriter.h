@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef RNTUPLEAUXDYNWRITER_H
@@ -7,6 +7,7 @@
 
 #include "AthenaBaseComps/AthMessaging.h"
 #include "RootAuxDynIO/RootAuxDynIO.h"
+#include "AuxCodecBuffer.h"
 
 #include "ROOT/RNTuple.hxx"
 #include "ROOT/RNTupleModel.hxx"
@@ -35,6 +36,13 @@ namespace RootAuxDynIO
 #endif
       // store data ptr for the first row, when only creating the model
       std::map<std::string, void*>        m_attrDataMap;
+      /// name and type of all fields, in order of creation, to recreate the model for a new segment
+      std::vector<std::pair<std::string, std::string> >  m_fieldTypes;
+
+      /// codecs for the dynamic attributes
+      AuxCodecMap_t                       m_codecs;
+      /// codec applied to each dynamic attribute field (empty if none)
+      std::map<std::string, AuxCodecBuffer>  m_codecBuffers;
 
       std::unique_ptr<RNTupleModel>       m_model;
       std::unique_ptr<REntry>             m_entry;
@@ -64,12 +72,18 @@ namespace RootAuxDynIO
       //  throws exceptions
       virtual int writeAuxAttributes( const std::string& base_branch, SG::IAuxStoreIO* store, size_t /*rows_written*/ ) override final;
 
+      /// set the codecs applied to dynamic attributes before writing
+      virtual void setAuxCodecs( const AuxCodecMap_t& codecs ) override final { m_codecs = codecs; }
+
       /// Add a new field to the RNTuple, collect the data pointer for the commit
       void addAttribute( const std::string& field_name, const std::string& attr_type, void* attr_data );
 
       /// Add a new field to the RNTuple
       virtual void addField( const std::string& field_name, const std::string& attr_type ) override;
 
+      /// Create a field, with the codec in the description if one is used
+      std::unique_ptr<RFieldBase> createField( const std::string& field_name, const std::string& attr_type );
+
       /// Supply data address for a given field
       virtual void addFieldValue( const std::string& field_name, void* attr_data ) override;
 
@@ -88,6 +102,9 @@ namespace RootAuxDynIO
       /// Keep track of how many APR containers are writing to this RNTuple
       virtual void increaseClientCount() override final { m_clients++; }
 
+      /// Finish the current RNTuple and start a new one with the same fields at the next commit
+      virtual void closeSegment() override;
+
       virtual void close() override;
       
       virtual ~RNTupleAuxDynWriter();
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "AthContainers/tools/error.h"
@@ -56,6 +56,31 @@ namespace RootAuxDynIO
    }
 
 
+   std::string
+   findAuxCodec(const AuxCodecMap_t& codecs, const std::string& attr_name, const std::string& baseName)
+   {
+      // Branch and field names may be prefixed by the type name, and field names
+      // have non-alphanumeric characters replaced, so compare sanitized name suffixes
+      auto sanitize = [](std::string name) {
+         for( char& c : name )  if( !std::isalnum(c) ) c = '_';
+         return name;
+      };
+      const std::string base = sanitize(baseName);
+      for( const auto& [key, spec] : codecs ) {
+         size_t dotpos = key.rfind('.');
+         if( dotpos == std::string::npos or key.compare(dotpos+1, std::string::npos, attr_name) != 0 )
+            continue;
+         const std::string cont = sanitize( key.substr(0, dotpos+1) );
+         if( base == cont or ( base.size() > cont.size()
+                               and base.compare(base.size()-cont.size(), cont.size(), cont) == 0
+                               and base[base.size()-cont.size()-1] == '_' ) ) {
+            return spec;
+         }
+      }
+      return "";
+   }
+
+
    std::string
    auxBranchName(const std::string& attr_name, const std::string& baseBranchName)
    {
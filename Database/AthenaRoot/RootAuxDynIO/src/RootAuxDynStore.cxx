@@ -1,8 +1,10 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "AthContainers/exceptions.h"
+#include "AthContainers/AuxTypeRegistry.h"
+#include "CxxUtils/ArrayCodec.h"
 
 #include "RootAuxDynStore.h"
 #include "RootAuxDynIO/RootAuxDynIO.h"
@@ -12,6 +14,7 @@ RootAuxDynStore::RootAuxDynStore(RootAuxDynIO::IRootAuxDynReader& reader,
                                  long long entry, bool standalone, std::recursive_mutex* iomtx)
   : SG::AuxStoreInternal( standalone ),
     m_entry(entry),
+    m_sizeAuxID(reader.sizeAuxID()),
     m_iomutex(iomtx)
 {
    for( auto id : reader.auxIDs() ) {
@@ -20,6 +23,25 @@ RootAuxDynStore::RootAuxDynStore(RootAuxDynIO::IRootAuxDynReader& reader,
    lock();
 }
 
+
+void RootAuxDynStore::decodeData(SG::auxid_t auxid, const CxxUtils::ArrayCodec& codec)
+{
+  const SG::AuxTypeRegistry& r = SG::AuxTypeRegistry::instance();
+  void* data = SG::AuxStoreInternal::getIODataInternal (auxid, true);
+  bool ok = false;
+  if (standalone()) {
+    ok = codec.decode (*r.getType(auxid), data, 1);
+  }
+  else {
+    // non-owning view of the std::vector that was read
+    auto vec = r.makeVectorFromData (auxid, data, false, false);
+    ok = codec.decode (*r.getType(auxid), vec->toPtr(), vec->size());
+  }
+  if (!ok) {
+    throw std::string("Codec '") + codec.spec() + "' can not decode attribute " + r.getName(auxid);
+  }
+}
+
       
 const void* RootAuxDynStore::getData(SG::auxid_t auxid) const
 {
@@ -102,7 +124,8 @@ bool RootAuxDynStore::isDecoration (SG::auxid_t auxid) const
 
 /**
  * @brief Return the number of elements in the store.
- * NOTE: this method will attempt to read data if size unknown (0)
+ * NOTE: this method will attempt to read data if size unknown (0),
+ * starting with the attribute the reader finds cheapest.
  * May return 0 for a store with no aux data.
  */
 size_t RootAuxDynStore::size() const
@@ -112,6 +135,9 @@ size_t RootAuxDynStore::size() const
     return s;
   }
 
+  if( m_sizeAuxID != SG::null_auxid && getData( m_sizeAuxID ) != nullptr ) {
+    return SG::AuxStoreInternal::size();
+  }
   for( SG::auxid_t id : getAuxIDs() ) {
     if( getData( id ) != nullptr ) {
       return SG::AuxStoreInternal::size();
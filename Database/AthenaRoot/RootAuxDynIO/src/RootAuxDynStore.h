@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ROOTAUXDYNSTORE_H
@@ -11,6 +11,7 @@
 #include <mutex>
 
 namespace RootAuxDynIO { class IRootAuxDynReader; }
+namespace CxxUtils { class ArrayCodec; }
 
 class RootAuxDynStore : public SG::AuxStoreInternal
 {
@@ -56,10 +57,17 @@ public:
 protected:
   /// read data from ROOT and store it in m_vecs. Returns False on error
   virtual bool readData(SG::auxid_t auxid) = 0;
+
+  /// undo the codec applied when writing, after the data for auxid was read
+  //  throws std::string
+  void decodeData(SG::auxid_t auxid, const CxxUtils::ArrayCodec& codec);
      
 protected:
   long long          m_entry;
 
+  /// attribute read first when the store size is needed (see IRootAuxDynReader::sizeAuxID)
+  SG::auxid_t        m_sizeAuxID;
+
   /// Mutex used to synchronize modifications to the cache vector.
   typedef AthContainers_detail::mutex mutex_t;
   typedef AthContainers_detail::lock_guard<mutex_t> guard_t;
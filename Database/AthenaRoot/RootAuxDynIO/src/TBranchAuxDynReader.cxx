@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "AthContainersInterfaces/IAuxStoreHolder.h"
@@ -21,6 +21,10 @@
 #include "TVirtualCollectionProxy.h"
 #include "TROOT.h"
 #include "TDictAttributeMap.h"
+#include "TList.h"
+
+#include <set>
+#include <stdexcept>
 
 using std::string;
 
@@ -185,6 +189,7 @@ void TBranchAuxDynReader::init(bool standalone)
 {
    if( m_initialized )  return;
    
+   Long64_t sizeBranchBytes = 0;
    for( const auto& attr2branch: m_branchMap ) {
       const string& attr = attr2branch.first;
       TBranch*      branch  = attr2branch.second;
@@ -198,6 +203,10 @@ void TBranchAuxDynReader::init(bool standalone)
       // May still be null if we don't have a dictionary for the branch.
       if (auxid != SG::null_auxid) {
          m_auxids.insert(auxid);
+         if( m_sizeAuxID == SG::null_auxid || branch->GetZipBytes() < sizeBranchBytes ) {
+            m_sizeAuxID = auxid;
+            sizeBranchBytes = branch->GetZipBytes();
+         }
       } else {
          errorcheck::ReportMessage msg (MSG::WARNING, ERRORCHECK_ARGS, "TBranchAuxDynReader::init");
          msg << "Could not find auxid for " << branch->GetName()
@@ -294,12 +303,51 @@ TBranchAuxDynReader::getBranchInfo(const SG::auxid_t& auxid, const SG::AuxStoreI
             }
          }
       }       
+
+      // codec applied when writing, recorded by TBranchAuxDynWriter
+      TList* userInfo = m_tree->GetUserInfo();
+      if( TObject* codec = (userInfo? userInfo->FindObject( brInfo.branch->GetName() ) : nullptr) ) {
+         try {
+            brInfo.codec = CxxUtils::ArrayCodec( codec->GetTitle() );
+         } catch( const std::invalid_argument& e ) {
+            brInfo.status = BranchInfo::TypeError;
+            throw string("Error reading codec for AUX branch ") + brInfo.branch->GetName() + ": " + e.what();
+         }
+         if( brInfo.needsSE or brInfo.isPackedContainer ) {
+            brInfo.status = BranchInfo::TypeError;
+            throw string("Can not decode AUX branch ") + brInfo.branch->GetName()
+               + " with codec '" + brInfo.codec.spec() + "' and a different type in memory";
+         }
+      }
       brInfo.status = BranchInfo::Initialized;
    }
    return brInfo;
 }
 
 
+// Attributes are read only on first access (see TBranchAuxDynStore::readData),
+// so the ones with an initialized BranchInfo are those read
+RootAuxDynIO::AuxDynReadStats TBranchAuxDynReader::readStats() const
+{
+   RootAuxDynIO::AuxDynReadStats stats;
+   std::set<const TBranch*> touched;
+   for( const auto& info : m_branchInfos ) {
+      if( info.second.status == BranchInfo::Initialized ) touched.insert( info.second.branch );
+   }
+   for( const auto& attr2branch : m_branchMap ) {
+      const size_t bytes = attr2branch.second->GetZipBytes();
+      if( touched.count( attr2branch.second ) ) {
+         ++stats.touchedAttributes;
+         stats.touchedBytes += bytes;
+      } else {
+         ++stats.untouchedAttributes;
+         stats.untouchedBytes += bytes;
+      }
+   }
+   return stats;
+}
+
+
 void TBranchAuxDynReader::addReaderToObject(void* object, size_t ttree_row, std::recursive_mutex* iomtx)
 {
    if( m_storeHolderOffset >= 0 ) {
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef TBRANCHAUXDYNREADER_H
@@ -7,6 +7,7 @@
 
 #include "AthContainers/AuxStoreInternal.h" 
 #include "RootAuxDynIO/RootAuxDynIO.h" 
+#include "CxxUtils/ArrayCodec.h"
 
 #include <map>
 #include <string>
@@ -36,6 +37,9 @@ public :
       bool          isPackedContainer = false;
       enum Status   status = NotInitialized;
 
+      // codec to undo after reading
+      CxxUtils::ArrayCodec codec;
+
       SG::auxid_t   auxid;
       std::string   attribName;
 
@@ -54,6 +58,10 @@ public :
 
    virtual void resetBytesRead() override final; 
 
+   virtual RootAuxDynIO::AuxDynReadStats readStats() const override final;
+
+   virtual SG::auxid_t sizeAuxID() const override final;
+
    virtual const SG::auxid_set_t& auxIDs() const override final;
 
    BranchInfo& getBranchInfo(const SG::auxid_t& auxid, const SG::AuxStoreInternal& store);
@@ -63,6 +71,8 @@ public :
 protected:
    // auxids that could be found in registry for attribute names from the file
    SG::auxid_set_t                       m_auxids;
+   // attribute with the smallest branch, read to get the store size
+   SG::auxid_t                           m_sizeAuxID = SG::null_auxid;
   
    std::string                           m_baseBranchName;
    // counter for bytes read
@@ -94,6 +104,10 @@ inline void TBranchAuxDynReader::resetBytesRead() {
    m_bytesRead = 0;
 }
 
+inline SG::auxid_t TBranchAuxDynReader::sizeAuxID() const {
+   return m_sizeAuxID;
+}
+
 inline const SG::auxid_set_t& TBranchAuxDynReader::auxIDs() const {
     return m_auxids;
 }
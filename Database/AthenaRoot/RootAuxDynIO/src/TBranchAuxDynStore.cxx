@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -53,6 +53,9 @@ bool TBranchAuxDynStore::readData(SG::auxid_t auxid)
          throw std::string("Error reading branch ") + brInfo.branch->GetName();
       // read OK
       m_reader.addBytes(nbytes);
+      if( brInfo.codec.needsDecode() ) {
+         decodeData(auxid, brInfo.codec);
+      }
       TTree::TClusterIterator clusterIterator = brInfo.branch->GetTree()->GetClusterIterator(m_entry);
       clusterIterator.Next();
       if (m_entry == clusterIterator.GetStartEntry() && brInfo.branch->GetTree()->GetMaxVirtualSize() != 0) {
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "TBranchAuxDynWriter.h"
@@ -11,6 +11,8 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TClass.h"
+#include "TList.h"
+#include "TNamed.h"
 
 
 namespace RootAuxDynIO
@@ -32,6 +34,15 @@ namespace RootAuxDynIO
       return nullptr;
    }
 
+   void      AuxInfo::setDefaultAddr()   {
+      if( codec.empty() ) {
+         setDummyAddr();
+         return;
+      }
+      object = codec.encodeDefault();
+      branch->SetAddress( objectAddr() );
+   }
+
    AuxInfo::~AuxInfo() {
       if( buffer && tclass ) {
          tclass->Destructor(buffer);
@@ -122,6 +133,20 @@ namespace RootAuxDynIO
    }
 
 
+   void TBranchAuxDynWriter::setupCodec( AuxInfo& info, const std::string& base_branchname ) {
+      const std::string spec = findAuxCodec( m_codecs, info.name, base_branchname );
+      if( spec.empty() ) return;
+      if( !info.codec.init( info.auxid, *info.typeinfo, spec ) ) {
+         ATH_MSG_WARNING("Codec '" << spec << "' can not be applied to " << info.branch_name
+                         << " of type " << info.type_name << " - writing it unencoded");
+         return;
+      }
+      // the reader finds the codec by the branch name
+      m_ttree->GetUserInfo()->Add( new TNamed( info.branch_name.c_str(), spec.c_str() ) );
+      ATH_MSG_DEBUG("Using codec '" << spec << "' for " << info.branch_name);
+   }
+
+
    /// handle writing of dynamic xAOD attributes of an object - called from RootTreeContainer::writeObject()
    //  throws exceptions
    int TBranchAuxDynWriter::writeAuxAttributes( const std::string& base_branchname,
@@ -140,6 +165,7 @@ namespace RootAuxDynIO
          AuxInfo& attrInfo = m_auxInfoMap[id];
          if( !attrInfo.branch ) {
             // new attribute info, fill it
+            attrInfo.auxid = id;
             attrInfo.typeinfo = store->getIOType(id);
             attrInfo.type_name = SG::normalizedTypeinfoName( *attrInfo.typeinfo );
             attrInfo.name = SG::AuxTypeRegistry::instance().getName(id);
@@ -157,6 +183,7 @@ namespace RootAuxDynIO
             */
             ATH_MSG_DEBUG("Creating branch for new dynamic attribute, Id=" << id << ": type=" << attrInfo.type_name << ",  branch=" << attrInfo.branch_name );
             createAuxBranch( attrInfo );
+            setupCodec( attrInfo, base_branchname );
             // backfill here
             if( backfill_nrows ) {
                // if this is not the first row, catch up with the rows written already to other branches
@@ -164,7 +191,7 @@ namespace RootAuxDynIO
                // As of root 6.22, calling SetAddress with nullptr may not work as expected if the address had
                // previously been set to something non-null.
                // So we need to create the temp object ourselves.
-               attrInfo.setDummyAddr();
+               attrInfo.setDefaultAddr();
                for( size_t r=0; r<backfill_nrows; ++r ) {
                   bytes_written += attrInfo.branch->BackFill();
                   ATH_MSG_VERBOSE("BACKFilled branch:" << m_ttree->GetName() << "::" << attrInfo.branch->GetName() <<
@@ -174,6 +201,10 @@ namespace RootAuxDynIO
             }
          }
          void *obj ATLAS_THREAD_SAFE = const_cast<void*>( store->getIOData(id) );
+         if( !attrInfo.codec.empty() ) {
+            // write an encoded copy, leaving the data in the store unchanged
+            obj = attrInfo.codec.encode( obj );
+         }
          attrInfo.object = obj;
          attrInfo.branch->SetAddress( attrInfo.objectAddr() );
          attrInfo.written = true;
@@ -184,7 +215,7 @@ namespace RootAuxDynIO
          // cout << "MN: AuxInfo loop:  branch name=" << attrInfo.branch_name  << "  branch addr=" << attrInfo.branch<< endl;
          // if an attribute was not written create a default object for it
          if( !attrInfo.written ) {
-            attrInfo.setDummyAddr();
+            attrInfo.setDefaultAddr();
             ATH_MSG_DEBUG("Default object added to branch: " << attrInfo.branch_name);
             // cout << "Default object added to branch: " << attrInfo.branch_name << " Tree size=" << m_ttree->GetEntries() << "  branch size:" << attrInfo.branch->GetEntries() << endl;
          }
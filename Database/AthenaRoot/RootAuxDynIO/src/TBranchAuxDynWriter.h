@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef TBRANCHAUXDYNWRITER_H
@@ -8,6 +8,7 @@
 #include "AthenaBaseComps/AthMessaging.h"
 #include "AthContainers/AuxStoreInternal.h"
 #include "RootAuxDynIO/RootAuxDynIO.h"
+#include "AuxCodecBuffer.h"
 
 // Forward declarations
 class TFile;
@@ -19,6 +20,7 @@ namespace RootAuxDynIO
 {
    
    struct AuxInfo {
+      SG::auxid_t          auxid           = SG::null_auxid;
       std::string          name;
       std::string          type_name;
       const std::type_info*typeinfo        = nullptr;
@@ -31,6 +33,9 @@ namespace RootAuxDynIO
       bool                 written         = false;
       size_t               rows_written    = 0;
 
+      // codec applied before writing (if configured)
+      AuxCodecBuffer       codec;
+
       // Dummy object instance; used when there was no request to write
       // this branch but we need to write it anyway (for example,
       // a dynamic variable that wasn't written on this event).
@@ -40,6 +45,10 @@ namespace RootAuxDynIO
 
       void*     setDummyAddr();
 
+      // set the branch address to write a default object in a row without data
+      // (the encoded default if there is a codec)
+      void      setDefaultAddr();
+
       // get the right pointer to use with  branch.setAddress() (different for objects and basic types)
       void*     objectAddr() { return is_basic_type? object : &object; }
 
@@ -56,11 +65,17 @@ namespace RootAuxDynIO
       /// set Filling mode (true/false) for branch containers
       virtual void        setBranchFillMode(bool mode) override final { m_branchFillMode = mode; }
 
+      /// set the codecs applied to dynamic attributes before writing
+      virtual void        setAuxCodecs(const AuxCodecMap_t& codecs) override final { m_codecs = codecs; }
+
       //  throws exceptions
       void createAuxBranch( AuxInfo& info );
 
       void setBranchOffsetTabLen(TBranch* b, int offsettab_len);
 
+      /// set up the codec configured for a new attribute and record it in the TTree UserInfo
+      void setupCodec( AuxInfo& info, const std::string& base_branchname );
+
       /// handle writing of dynamic xAOD attributes of an object
       /// called from RootTreeContainer::writeObject()
       //  throws exceptions
@@ -81,6 +96,9 @@ namespace RootAuxDynIO
       bool                 m_branchFillMode   = false;
       bool                 m_needsFill        = false;
 
+      /// codecs for the dynamic attributes
+      AuxCodecMap_t        m_codecs;
+
       /// cached aux branches data by auxid
       std::map<SG::auxid_t, AuxInfo>   m_auxInfoMap;
    };
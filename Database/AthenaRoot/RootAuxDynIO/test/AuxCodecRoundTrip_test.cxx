@@ -0,0 +1,155 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file RootAuxDynIO/test/AuxCodecRoundTrip_test.cxx
+ * @date Oct, 2026
+ * @brief Write dynamic attributes with a codec through the TBranch writer,
+ *        read them back and decode them with the codec recorded in the tree.
+ */
+
+
+#undef NDEBUG
+#include "RootAuxDynIO/RootAuxDynIO.h"
+#include "AthContainers/AuxStoreInternal.h"
+#include "AthContainers/AuxTypeRegistry.h"
+#include "CxxUtils/ArrayCodec.h"
+
+#include "TList.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+// step of fixed:16 over [-5, 5]
+constexpr float tolerance = 2e-4;
+const std::string fixedSpec = "fixed:16:-5:5";
+
+SG::auxid_t otherID()
+{
+  return SG::AuxTypeRegistry::instance().getAuxID<float> ("codecTestOther");
+}
+
+/// Write one row with @c store, as RootTreeContainer does
+void writeRow (TTree& tree, RootAuxDynIO::IRootAuxDynWriter& writer,
+               const std::string& base, SG::AuxStoreInternal& store)
+{
+  writer.writeAuxAttributes (base, &store, tree.GetEntries());
+  tree.Fill();
+}
+
+/// The codec recorded for a branch by the writer
+CxxUtils::ArrayCodec branchCodec (TTree& tree, const std::string& branch)
+{
+  TObject* codec = tree.GetUserInfo()->FindObject (branch.c_str());
+  assert (codec);
+  return CxxUtils::ArrayCodec (codec->GetTitle());
+}
+
+} // anonymous namespace
+
+
+// Standalone object: the attribute is added after the first rows
+// (backfilled) and missing in one row.
+void test1()
+{
+  std::cout << "test1\n";
+
+  const SG::auxid_t id = SG::AuxTypeRegistry::instance().getAuxID<float> ("codecTestScalar");
+  const std::string base = "ScalarAux.";
+  const std::string branch = RootAuxDynIO::auxBranchName ("codecTestScalar", base);
+
+  TTree tree ("Scalar", "Scalar");
+  tree.SetDirectory (nullptr);
+  std::unique_ptr<RootAuxDynIO::IRootAuxDynWriter> writer =
+    RootAuxDynIO::getBranchAuxDynWriter (&tree, 8192, 1, 0, false);
+  writer->setAuxCodecs ({{"ScalarAux.codecTestScalar", fixedSpec}});
+
+  // no value: attribute not in the store
+  const std::vector<std::optional<float> > values = {{}, {}, 2.5, {}, -1.25};
+  for (const std::optional<float>& value : values) {
+    SG::AuxStoreInternal store (true);
+    *static_cast<float*> (store.getData (otherID(), 1, 1)) = 1;
+    if (value) *static_cast<float*> (store.getData (id, 1, 1)) = *value;
+    writeRow (tree, *writer, base, store);
+  }
+  assert (tree.GetEntries() == static_cast<Long64_t> (values.size()));
+
+  const CxxUtils::ArrayCodec codec = branchCodec (tree, branch);
+  assert (codec.spec() == fixedSpec);
+  float read = 0;
+  tree.SetBranchAddress (branch.c_str(), &read);
+  for (size_t row = 0; row < values.size(); ++row) {
+    assert (tree.GetEntry (row) > 0);
+    codec.decode (typeid(float), &read, 1);
+    // missing values are read as zero, not as the bottom of the range
+    assert (std::abs (read - values[row].value_or (0)) < tolerance);
+  }
+  tree.ResetBranchAddresses();
+}
+
+
+// Container: vectors are written encoded, and missing ones are empty.
+void test2()
+{
+  std::cout << "test2\n";
+
+  const SG::auxid_t id = SG::AuxTypeRegistry::instance().getAuxID<float> ("codecTestVector");
+  const std::string base = "VectorAux.";
+  const std::string branch = RootAuxDynIO::auxBranchName ("codecTestVector", base);
+  const std::string spec = fixedSpec + ",shuffle";
+
+  TTree tree ("Vector", "Vector");
+  tree.SetDirectory (nullptr);
+  std::unique_ptr<RootAuxDynIO::IRootAuxDynWriter> writer =
+    RootAuxDynIO::getBranchAuxDynWriter (&tree, 8192, 1, 0, false);
+  writer->setAuxCodecs ({{"VectorAux.codecTestVector", spec}});
+
+  // empty: attribute not in the store
+  const std::vector<std::vector<float> > values = {{}, {1, -2, 3.5, 7}, {}, {-0.5}};
+  for (const std::vector<float>& value : values) {
+    const size_t n = std::max (value.size(), size_t(1));
+    SG::AuxStoreInternal store;
+    store.resize (n);
+    std::fill_n (static_cast<float*> (store.getData (otherID(), n, n)), n, 1);
+    if (!value.empty()) {
+      std::copy (value.begin(), value.end(), static_cast<float*> (store.getData (id, n, n)));
+    }
+    writeRow (tree, *writer, base, store);
+  }
+
+  const CxxUtils::ArrayCodec codec = branchCodec (tree, branch);
+  assert (codec.spec() == spec);
+  std::vector<float>* read = nullptr;
+  tree.SetBranchAddress (branch.c_str(), &read);
+  for (size_t row = 0; row < values.size(); ++row) {
+    assert (tree.GetEntry (row) > 0);
+    assert (read->size() == values[row].size());
+    codec.decode (typeid(float), read->data(), read->size());
+    for (size_t i = 0; i < read->size(); ++i) {
+      // out of range values are clamped
+      const float expected = std::clamp (values[row][i], -5.f, 5.f);
+      assert (std::abs ((*read)[i] - expected) < tolerance);
+    }
+  }
+  tree.ResetBranchAddresses();
+  delete read;
+}
+
+
+int main()
+{
+  std::cout << "RootAuxDynIO/AuxCodecRoundTrip_test\n";
+  test1();
+  test2();
+  return 0;
+}
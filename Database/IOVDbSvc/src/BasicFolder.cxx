@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 #include "BasicFolder.h"
 #include <iostream>
@@ -69,6 +69,12 @@ static const std::vector<coral::AttributeList> invalidVectorPayload{};
       m_channels.push_back(channelId);
       m_vectorPayload[channelId]=payload;
     }
+
+    void 
+    BasicFolder::addChannelPayload(const cool::ChannelId & channelId, std::vector<coral::AttributeList> && payload){ 
+      m_channels.push_back(channelId);
+      m_vectorPayload[channelId]=std::move(payload);
+    }
   
     //
     coral::AttributeList 
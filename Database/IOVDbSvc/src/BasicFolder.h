@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 // @file BasicFolder.h
 // Header for FolderTypes utilities
@@ -31,6 +31,7 @@ class BasicFolder{
   //add vector payload
   void addChannelPayload(const cool::ChannelId & channelId, const std::string & name, const std::vector<coral::AttributeList> & payload);
   void addChannelPayload(const cool::ChannelId & channelId, const std::vector<coral::AttributeList> & payload);
+  void addChannelPayload(const cool::ChannelId & channelId, std::vector<coral::AttributeList> && payload);
   //
   coral::AttributeList getPayload(const cool::ChannelId & channelId);
   coral::AttributeList getPayload(const std::string & channelName);
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 // @file CrestFunctions.cxx
 // Implementation for CrestFunctions utilities
@@ -16,6 +16,19 @@
 #include <algorithm>
 #include <map>
 
+namespace{
+  const std::string fileScheme{"file://"};
+
+  //client for a CREST server, or for the file system CREST stand-in if the path is "file://<directory>"
+  Crest::CrestClient
+  crestClientFor(const std::string & crest_path){
+    if (crest_path.compare(0, fileScheme.size(), fileScheme)==0){
+      return Crest::CrestClient(false, crest_path.substr(fileScheme.size()));
+    }
+    return Crest::CrestClient(crest_path);
+  }
+}
+
 namespace IOVDbNamespace{
 
   CrestFunctions::CrestFunctions(const std::string & crest_path){
@@ -94,7 +107,7 @@ namespace IOVDbNamespace{
     std::string reply{R"delim([{"insertionTime":"2022-05-26T12:10:58+0000","payloadHash":"99331506eefbe6783a8d5d5bc8b9a44828a325adfcaac32f62af212e9642db71","since":0,"tagName":"LARIdentifierFebRodMap-RUN2-000"}])delim"};
     if (not testing){
       //...CrestApi returns Iovs as a json object
-      auto myCrestClient = Crest::CrestClient(getURLBase());
+      auto myCrestClient = crestClientFor(getURLBase());
       try{
         reply = myCrestClient.findAllIovs(tag).dump();
       } catch (std::exception & e){
@@ -112,7 +125,7 @@ namespace IOVDbNamespace{
     std::string reply{R"delim([{"insertionTime":"2022-05-26T12:10:58+0000","payloadHash":"99331506eefbe6783a8d5d5bc8b9a44828a325adfcaac32f62af212e9642db71","since":0,"tagName":"LARIdentifierFebRodMap-RUN2-000"}])delim"};
     if (not testing){
       //...CrestApi returns Iovs as a json object
-      auto myCrestClient = Crest::CrestClient(getURLBase());
+      auto myCrestClient = crestClientFor(getURLBase());
       try{
         reply = myCrestClient.findAllIovs(tag).dump();
       } catch (std::exception & e){
@@ -130,7 +143,7 @@ namespace IOVDbNamespace{
     if (not testing){
       //CrestApi method:
       try{
-        auto   myCrestClient = Crest::CrestClient(getURLBase());
+        auto   myCrestClient = crestClientFor(getURLBase());
         reply = myCrestClient.getPayloadAsString(hash);
       } catch (std::exception & e){
         std::cout<<__FILE__<<":"<<__LINE__<< ": "<<e.what()<<" while trying to find the payload"<<std::endl;
@@ -221,7 +234,7 @@ namespace IOVDbNamespace{
   CrestFunctions::folderDescriptionForTag(const std::string & tag, const bool testing){
     std::string jsonReply{R"delim({"format":"TagMetaSetDto","resources":[{"tagName":"LARAlign-RUN2-UPD4-03","description":"{\"dbname\":\"CONDBR2\",\"nodeFullpath\":\"/LAR/Align\",\"schemaName\":\"COOLONL_LAR\"}","chansize":1,"colsize":1,"tagInfo":"{\"channel_list\":[{\"0\":\"\"}],\"node_description\":\"<timeStamp>run-lumi</timeStamp><addrHeader><address_header service_type=\\\"256\\\" clid=\\\"1238547719\\\" /></addrHeader><typeName>CondAttrListCollection</typeName><updateMode>UPD1</updateMode>\",\"payload_spec\":\"PoolRef:String4k\"}","insertionTime":"2022-05-26T12:10:38+0000"}],"size":1,"datatype":"tagmetas","format":null,"page":null,"filter":null})delim"};
     if (not testing){
-      auto myCrestClient = Crest::CrestClient(getURLBase());
+      auto myCrestClient = crestClientFor(getURLBase());
       jsonReply= myCrestClient.getTagMetaInfo(tag).dump();
     }
     return extractDescriptionFromJson(jsonReply);
@@ -231,7 +244,7 @@ namespace IOVDbNamespace{
   CrestFunctions::payloadSpecificationForTag(const std::string & specTag, const bool testing){
     std::string jsonReply{R"delim({"folder_payloadspec": "PoolRef: String4k"})delim"};
     if (not testing){
-      auto myCrestClient = Crest::CrestClient(getURLBase());
+      auto myCrestClient = crestClientFor(getURLBase());
       jsonReply= myCrestClient.getTagMetaInfo(specTag).dump();
     }
     return extractSpecificationFromJson(jsonReply);
@@ -241,7 +254,7 @@ namespace IOVDbNamespace{
   CrestFunctions::channelListForTag(const std::string & tag, const bool testing){
        std::string reply{R"delim([{"chansize":8,"colsize":5,"description":"{\"dbname\":\"CONDBR2\",\"nodeFullpath\":\"/LAR/BadChannelsOfl/BadChannels\",\"schemaName\":\"COOLOFL_LAR\"}","insertionTime":"2022-05-26T16:40:32+0000","tagInfo":"{\"channel_list\":[{\"0\":\"\"},{\"1\":\"\"},{\"2\":\"\"},{\"3\":\"\"},{\"4\":\"\"},{\"5\":\"\"},{\"6\":\"\"},{\"7\":\"\"}],\"node_description\":\"<timeStamp>run-lumi</timeStamp><addrHeader><address_header service_type=\\\"71\\\" clid=\\\"1238547719\\\" /></addrHeader><typeName>CondAttrListCollection</typeName>\",\"payload_spec\":\"ChannelSize:UInt32,StatusWordSize:UInt32,Endianness:UInt32,Version:UInt32,Blob:Blob64k\"}","tagName":"LARBadChannelsOflBadChannels-RUN2-UPD4-21"}])delim"};
     if (not testing){
-     auto myCrestClient = Crest::CrestClient(getURLBase());
+     auto myCrestClient = crestClientFor(getURLBase());
      reply= myCrestClient.getTagMetaInfo(tag).dump();
     }
     return extractChannelListFromJson(reply);
@@ -252,7 +265,7 @@ namespace IOVDbNamespace{
     std::string result{};
     if (not forceTag.empty()) return forceTag;
     if (testing) return "LARAlign-RUN2-UPD4-03";
-    auto crestClient = Crest::CrestClient(getURLBase());
+    auto crestClient = crestClientFor(getURLBase());
     auto j = crestClient.findGlobalTagMap(globalTagName);
     for (const auto &i:j){
       if (i["label"] == folderName){
@@ -272,7 +285,7 @@ namespace IOVDbNamespace{
   CrestFunctions::getGlobalTagMap(const std::string& globaltag){
     std::map<std::string, std::string> tagmap;
     try{
-      auto crestClient = Crest::CrestClient(getURLBase());
+      auto crestClient = crestClientFor(getURLBase());
       nlohmann::json j = crestClient.findGlobalTagMap(globaltag);
       int n = j.size();
       for (int i = 0; i < n; i++ ){
@@ -291,7 +304,7 @@ namespace IOVDbNamespace{
 
   nlohmann::json CrestFunctions::getTagInfo(const std::string & tag){
     try{
-      auto crestClient = Crest::CrestClient(getURLBase());
+      auto crestClient = crestClientFor(getURLBase());
       nlohmann::json meta_info = crestClient.getTagMetaInfo(tag)[0];
 
       if (meta_info.contains("tagInfo")){
@@ -306,7 +319,7 @@ namespace IOVDbNamespace{
 
   nlohmann::json CrestFunctions::getTagProperties(const std::string & tag){
     try{
-      auto crestClient = Crest::CrestClient(getURLBase());
+      auto crestClient = crestClientFor(getURLBase());
       return crestClient.findTag(tag)[0];
 
     } catch (std::exception & e){
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -30,6 +30,7 @@ namespace IOVDbNamespace{
 
     public:
 
+    //crest_path is the server URL, or "file://<directory>" to read a CREST file system dump instead
     CrestFunctions(const std::string & crest_path);
 
     const std::string & getURLBase();
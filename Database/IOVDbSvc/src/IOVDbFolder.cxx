@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 // IOVDbFolder.cxx - helper class for IOVDbSvc to manage folder & data cache
@@ -55,6 +55,7 @@
 #include "BasicFolder.h"
 
 #include "CrestFunctions.h"
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
 #include <fstream>
@@ -74,7 +75,7 @@ IOVDbFolder::IOVDbFolder(IOVDbConn* conn,
                          IClassIDSvc* clidsvc, IIOVDbMetaDataTool* metadatatool,
                          const bool checklock, const bool outputToFile,
                          const std::string & source, const bool crestToFile,
-                         const std::string & crestServer):
+                         const std::string & crestServer, const std::string & payloadCacheDir):
   AthMessaging("IOVDbFolder"),
   p_clidSvc(clidsvc),
   p_metaDataTool(metadatatool),
@@ -85,7 +86,8 @@ IOVDbFolder::IOVDbFolder(IOVDbConn* conn,
   m_outputToFile{outputToFile},
   m_crestToFile{crestToFile},
   m_source{source},
-  m_crestServer{crestServer}
+  m_crestServer{crestServer},
+  m_payloadCache{payloadCacheDir}
 {
   // set message same message level as our parent (IOVDbSvc)
   setLevel(msg.level());
@@ -232,6 +234,10 @@ IOVDbFolder::loadCache(const cool::ValidityKey vkey,
   TStopwatch cachetimer;
   const auto & [cachestart, cachestop] = m_iovs.getCacheBounds();
   BasicFolder basicFolder;
+  // local payload cache: key of this load (empty if not cacheable) and snapshot found
+  std::string payloadCacheKey;
+  PayloadCache::Snapshot payloadSnapshot;
+  bool fromPayloadCache{false};
   if (m_source == "CREST"){
     //const std::string  jsonFolderName=sanitiseCrestTag(m_foldername);
 
@@ -315,42 +321,67 @@ IOVDbFolder::loadCache(const cool::ValidityKey vkey,
     }
 
 
-   std::string reply = indIOV==-1 ? std::string{} : cfunctions.getPayloadForHash(iovHashVect[indIOV].second);
-   if(crestPayloadType.compare("crest-json-multi-iov")==0){
-        try{
-          nlohmann::json multiPayload = nlohmann::json::parse(reply);
-          nlohmann::json jsIovs=multiPayload["obj"];
-          iov2IndexVect.clear();
-          iov2IndexVect.reserve(jsIovs.size());
-          hashInd=0;
-          for(const auto& jsIov : jsIovs.items()) {
-            iov2IndexVect.emplace_back(std::stoull(jsIov.key()),hashInd++);
+    // the payload for a hash never changes, look for it in the local cache first
+    const bool multiIov = (crestPayloadType=="crest-json-multi-iov");
+    // key of the multi-IOV payload, its internal IOVs are cached under this key followed by their since
+    std::string multiIovCacheKey;
+    bool multiIovSincesCached{false};
+    if (indIOV>=0 and m_payloadCache.enabled() and not m_crestToFile){
+      payloadCacheKey="CREST|"+m_crestServer+"|"+m_foldername+"|"+completeTag+"|"+iovHashVect[indIOV].second+"|"+crestPayloadType;
+      if (multiIov){
+        multiIovCacheKey=payloadCacheKey;
+        payloadCacheKey.clear();
+        // the sinces of the internal IOVs are stored once per payload, to select the one holding vkey
+        PayloadCache::Snapshot sinces;
+        multiIovSincesCached=m_payloadCache.read(multiIovCacheKey+"|sinces",sinces);
+        if (multiIovSincesCached){
+          const auto selected=std::find_if(sinces.objects.rbegin(),sinces.objects.rend(),
+                                           [vkey](const PayloadCache::Object & obj){return obj.since<=vkey;});
+          if (selected!=sinces.objects.rend()){
+            payloadCacheKey=multiIovCacheKey+"|"+std::to_string(selected->since);
+            iovHashVect[indIOV].first.first=selected->since;
           }
+        }
+      }
+      fromPayloadCache=not payloadCacheKey.empty() and m_payloadCache.read(payloadCacheKey,payloadSnapshot);
+      // only the payload is taken from the cache: the same hash can be used by several IOVs,
+      // and the end of the last IOV changes when IOVs are appended to the tag
+      if (fromPayloadCache){
+        for (auto & obj:payloadSnapshot.objects){
+          // the start of an IOV inside a multi-IOV payload comes from the payload itself
+          if (not multiIov) obj.since=iovHashVect[indIOV].first.first;
+          obj.until=iovHashVect[indIOV].first.second;
+        }
+      }
+    }
 
-          std::sort(iov2IndexVect.begin(),iov2IndexVect.end(),
-              [](const IOV2Index& a, const IOV2Index& b)
-              {
-                return a.first < b.first;
-              });
-          if(vkey < iov2IndexVect[0].first) {
+   std::string reply = (indIOV==-1 or fromPayloadCache) ? std::string{} : cfunctions.getPayloadForHash(iovHashVect[indIOV].second);
+   // path to the payload object in the document
+   std::vector<std::string> payloadPath{"data"};
+   if(not fromPayloadCache and multiIov){
+        try{
+          // only the keys are read here, the selected IOV is decoded by Json2Cool
+          const auto sinces = Json2Cool::multiIovSinces(reply);
+          if(sinces.empty() or vkey < sinces[0]) {
              ATH_MSG_FATAL("Load cache failed for " << m_foldername << ". No valid IOV retrieved from the payload");
              return false;
           }
-
-          uint64_t iov = 0;
-          for(const auto& iovhash : iov2IndexVect) {
-            if(vkey >= iovhash.first) {
-              iov=iovhash.first;
-              continue;
-            }
-            else {
-              break;
+          const uint64_t iov = *(std::upper_bound(sinces.begin(),sinces.end(),vkey)-1);
+          iovHashVect[indIOV].first.first=iov;
+          payloadPath={"obj",std::to_string(iov)};
+          if (not multiIovCacheKey.empty()){
+            if (not multiIovSincesCached){
+              PayloadCache::Snapshot sinceSnapshot;
+              sinceSnapshot.objects.reserve(sinces.size());
+              for (const auto since:sinces){
+                PayloadCache::Object obj;
+                obj.since=since;
+                sinceSnapshot.objects.push_back(obj);
+              }
+              m_payloadCache.write(multiIovCacheKey+"|sinces",sinceSnapshot);
             }
+            payloadCacheKey=multiIovCacheKey+"|"+std::to_string(iov);
           }
-          iovHashVect[indIOV].first.first=iov;
-          nlohmann::json payload={};
-          payload["data"]=jsIovs[std::to_string(iov)];
-          reply=payload.dump();
         } catch (std::exception & e){
           ATH_MSG_FATAL("Failed of parce multi iovs struct of internal iovs from payload for DCS type: " << e.what());
         }
@@ -402,14 +433,13 @@ IOVDbFolder::loadCache(const cool::ValidityKey vkey,
     }
 
     const std::string& specString = cfunctions.getTagInfoElement(m_tag_info,"payload_spec");
-    if (specString.empty()){
+    if (specString.empty() and not fromPayloadCache){
       ATH_MSG_FATAL("Reading payload spec from "<<m_foldername<<" failed.");
       return false;
     }
     //basic folder now contains the info
     if(!reply.empty()) { //this also takes care of the case if indIOV<0, since reply is empty in this case
-      std::istringstream ss(reply);
-      Json2Cool inputJson(ss, basicFolder, specString, &(iovHashVect[indIOV].first));
+      Json2Cool inputJson(reply, basicFolder, specString, &(iovHashVect[indIOV].first), payloadPath);
       if (basicFolder.empty()){
         ATH_MSG_FATAL("Reading channel data from "<<m_foldername<<" failed.");
         return false;
@@ -453,7 +483,9 @@ IOVDbFolder::loadCache(const cool::ValidityKey vkey,
   const auto & [since, until] = m_iovs.getCacheBounds();
   ATH_MSG_DEBUG( "IOVDbFolder:loadCache limits set to ["  << since << "," << until << "]" );
   bool vectorPayload{};
-  if (m_source=="CREST"){
+  if (fromPayloadCache){
+    vectorPayload = payloadSnapshot.vectorPayload;
+  } else if (m_source=="CREST"){
     vectorPayload = basicFolder.isVectorPayload();
   } else {
     vectorPayload = (m_foldertype ==CoraCool) or (m_foldertype == CoolVector);
@@ -511,7 +543,20 @@ IOVDbFolder::loadCache(const cool::ValidityKey vkey,
           if (!resolveTag(folder,globalTag)) return false;
         
         }
-        if (m_foldertype==CoraCool) {
+        // a resolved multiversion tag and the query range identify the payload in the local cache,
+        // provided the tag is locked: IOVs can still be added to or changed in an unlocked tag (e.g. UPD1, UPD4)
+        if (m_payloadCache.enabled() and m_multiversion and not m_tag.empty() and not m_outputToFile and
+            IOVDbNamespace::checkTagLock(folder,m_tag).value_or(false)) {
+          auto [since,until] = m_iovs.getCacheBounds();
+          payloadCacheKey="COOL|"+m_conn->name()+"|"+m_foldername+"|"+m_tag+"|"+std::to_string(m_foldertype)+"|"+
+            std::to_string(since)+"|"+std::to_string(until);
+          for (const auto & [first,last]:m_chanrange) payloadCacheKey+="|"+std::to_string(first)+":"+std::to_string(last);
+          fromPayloadCache=m_payloadCache.read(payloadCacheKey,payloadSnapshot);
+        }
+        if (fromPayloadCache) {
+          fillCacheFromSnapshot(payloadSnapshot);
+          retrievedone=true;
+        } else if (m_foldertype==CoraCool) {
           // CoraCool retrieve
           CoraCoolDatabasePtr ccDbPtr=m_conn->getCoraCoolDb();
           CoraCoolFolderPtr ccfolder=ccDbPtr->getFolder(m_foldername);
@@ -614,6 +659,8 @@ IOVDbFolder::loadCache(const cool::ValidityKey vkey,
     //this is code using CREST objects now
     ATH_MSG_DEBUG( "loadCache: Expecting to see " << nChannelsExpected << " channels" );
     if (!resolveTag(nullptr,globalTag)) return false;
+    // basicFolder is left empty when the payload was found in the local cache
+    if (fromPayloadCache) fillCacheFromSnapshot(payloadSnapshot);
     const auto & channelNumbers=basicFolder.channelIds();
     ATH_MSG_DEBUG( "ChannelIds is " << channelNumbers.size() << " long" );
     unsigned int iadd{};
@@ -653,6 +700,7 @@ IOVDbFolder::loadCache(const cool::ValidityKey vkey,
       "," << until << "]" );
     return false;
   }
+  if (not payloadCacheKey.empty() and not fromPayloadCache) writePayloadCache(payloadCacheKey, vectorPayload);
   // check if cache can be stretched according to extent of IOVs crossing
   // boundaries - this requires all channels to have been seen
   const auto & [nChannelsLo, nChannelsHi] = m_iovs.numberOfIovsOnBoundaries();
@@ -995,6 +1043,10 @@ void IOVDbFolder::summary() {
 	    m_ncacheread << " objs/chan/bytes " << m_nobjread << "/" <<
 	    m_nchan << "/" << m_nbytesread << " (( " << std::fixed << std::setw(8)
 	    << std::setprecision(2) << m_readtime << " ))s" );
+  if (m_npayloadcacheread>0) {
+    ATH_MSG_INFO( "Folder " << m_foldername << " took " << m_npayloadcacheread << "/" << m_ndbread <<
+      " cache loads from the local payload cache" );
+  }
   // print WARNING if data for this folder was never read from Storegate
   if (m_ncacheread==0 && m_ndbread>0) {
     ATH_MSG_WARNING( "Folder " << m_foldername << " is requested but no data retrieved" );
@@ -1350,6 +1402,53 @@ IOVDbFolder::addIOVtoCache(cool::ValidityKey since,cool::ValidityKey until) {
   m_iovs.addIov(since, until);
 }
 
+void
+IOVDbFolder::fillCacheFromSnapshot(const PayloadCache::Snapshot & snapshot) {
+  // fill the cache from a snapshot of the local payload cache, as a database retrieve would
+  for (const auto & obj:snapshot.objects){
+    addIOVtoCache(obj.since,obj.until);
+    m_cachechan.push_back(obj.channel);
+    const unsigned int istart=m_cacheattr.size();
+    for (unsigned int i=obj.begin; i!=obj.end; ++i){
+      const coral::AttributeList& atrlist=snapshot.attributes[i];
+      if (m_cachespec==nullptr) setSharedSpec(atrlist);
+      m_cacheattr.emplace_back(*m_cachespec,true);
+      m_cacheattr.back().fastCopyData(atrlist);
+    }
+    if (snapshot.vectorPayload) {
+      m_cacheccstart.push_back(istart);
+      m_cacheccend.push_back(m_cacheattr.size());
+    }
+  }
+  m_nobjread+=snapshot.objects.size();
+  ++m_npayloadcacheread;
+  ATH_MSG_DEBUG( "Retrieved " << snapshot.objects.size() << " objects for " << m_foldername << " from the local payload cache" );
+}
+
+void
+IOVDbFolder::writePayloadCache(const std::string & key, const bool vectorPayload) {
+  // store the freshly loaded cache content in the local payload cache
+  PayloadCache::Snapshot snapshot;
+  snapshot.vectorPayload=vectorPayload;
+  const auto & iovs=m_iovs.vectorStore();
+  snapshot.objects.reserve(iovs.size());
+  for (unsigned int i=0; i!=iovs.size(); ++i){
+    PayloadCache::Object obj;
+    obj.since=iovs[i].first;
+    obj.until=iovs[i].second;
+    obj.channel=m_cachechan[i];
+    obj.begin=vectorPayload ? m_cacheccstart[i] : i;
+    obj.end=vectorPayload ? m_cacheccend[i] : i+1;
+    snapshot.objects.push_back(obj);
+  }
+  snapshot.attributes=m_cacheattr;
+  if (m_payloadCache.write(key,snapshot)) {
+    ATH_MSG_DEBUG( "Stored " << snapshot.objects.size() << " objects for " << m_foldername << " in " << m_payloadCache.fileName(key) );
+  } else {
+    ATH_MSG_DEBUG( "Could not store the payload of " << m_foldername << " in the local payload cache" );
+  }
+}
+
 void 
 IOVDbFolder::printCache(){
     const auto & [since,until] = m_iovs.getCacheBounds(); 
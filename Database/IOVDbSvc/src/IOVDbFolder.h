@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 // IOVDbFolder.h
@@ -27,6 +27,7 @@
 #include <algorithm>
 #include "FolderTypes.h"
 #include "IovStore.h"
+#include "PayloadCache.h"
 
 #include <map> 
 #include "nlohmann/json.hpp"
@@ -46,7 +47,7 @@ public:
               IClassIDSvc* clidsvc, IIOVDbMetaDataTool* metadatatool,
               const bool checklock, const bool outputToFile=false,
               const std::string & source="COOL_DATABASE", const bool crestToFile=false,
-              const std::string & crestServer="");
+              const std::string & crestServer="", const std::string & payloadCacheDir="");
   ~IOVDbFolder();
   
 
@@ -151,6 +152,11 @@ private:
   
   // add this IOV to cache, including channel counting if over edge of cache
   void addIOVtoCache(cool::ValidityKey since, cool::ValidityKey until);
+
+  // fill the cache from a snapshot read from the local payload cache
+  void fillCacheFromSnapshot(const IOVDbNamespace::PayloadCache::Snapshot & snapshot);
+  // store the current cache content in the local payload cache
+  void writePayloadCache(const std::string & key, const bool vectorPayload);
   
   //override intrinsic (member variable) options from the from a parsed folder description
   bool overrideOptionsFromParsedDescription(const IOVDbParser & parsedDescription);
@@ -270,6 +276,7 @@ private:
   unsigned int m_nobjread{0};         // number of objects read from DB
   unsigned long long m_nbytesread{0}; // number of bytes read from DB
   float m_readtime{0};                // time spent reading data from COOL (in loadcache)
+  unsigned int m_npayloadcacheread{0}; // number of cache loads taken from the local payload cache
 
   // channel number and names (latter only filled for 'named' folders)
   unsigned int m_nchan{0};
@@ -295,6 +302,7 @@ private:
   std::map<std::string, std::string> m_cresttagmap; // pairs: COOL folder - CREST tag name
   std::string m_crest_tag = "";
   nlohmann::json m_tag_info = nullptr;
+  IOVDbNamespace::PayloadCache m_payloadCache; // local cache of decoded payloads
 };
 
 inline const std::string& IOVDbFolder::folderName() const {return m_foldername;}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 // IOVDbSvc.cxx
@@ -28,6 +28,7 @@
 #include "IOVDbSvc.h"
 
 #include <algorithm>
+#include <filesystem>
 #include <list>
 #include <utility>
 
@@ -211,6 +212,16 @@ StatusCode IOVDbSvc::initialize() {
       m_par_cacheRun.value() << " runs" );
   if (m_par_cacheTime.value() > 0)
     ATH_MSG_INFO( "Timestamp data will be cached in groups of " << m_par_cacheTime.value() << " seconds" );
+  if (!m_par_payloadCacheDir.value().empty()) {
+    std::error_code ec;
+    std::filesystem::create_directories(m_par_payloadCacheDir.value(), ec);
+    if (ec) {
+      ATH_MSG_WARNING( "Cannot create payload cache directory " << m_par_payloadCacheDir.value() << ": " << ec.message() << " - payload cache disabled" );
+      m_par_payloadCacheDir.setValue("");
+    } else {
+      ATH_MSG_INFO( "Decoded folder payloads will be cached in " << m_par_payloadCacheDir.value() );
+    }
+  }
   if (m_par_cacheAlign > 0) 
     ATH_MSG_INFO( "Cache alignment will be done in " << m_par_cacheAlign.value() << " slices" );
   if (m_par_onlineMode) 
@@ -1046,7 +1057,8 @@ StatusCode IOVDbSvc::setupFolders() {
     // create the new folder, but only if a folder for this SG key has not
     // already been requested
     IOVDbFolder* folder=new IOVDbFolder(conn,folderdata,msg(),&(*m_h_clidSvc), &(*m_h_metaDataTool),
-                                        m_par_checklock, m_outputToFile.value(), m_par_source, m_crestToFile.value(), m_par_crestServer);
+                                        m_par_checklock, m_outputToFile.value(), m_par_source, m_crestToFile.value(), m_par_crestServer,
+                                        m_par_payloadCacheDir.value());
     const std::string& key=folder->key();
     if (m_foldermap.find(key)==m_foldermap.end()) {  //This check is too weak. For POOL-based folders, the SG key is in the folder description (not known at this point).
       m_foldermap[key]=folder;
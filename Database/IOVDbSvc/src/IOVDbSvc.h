@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -228,12 +228,14 @@ private:
   // Source of data as a string; default is "COOL_DATABASE"
   StringProperty m_par_source{this,"Source","COOL_DATABASE","source of data as a string (default COOL_DATABASE)"};
   // CREST Server URL with host number; default is "http://crest-undertow-api.web.cern.ch"
-  StringProperty m_par_crestServer{this,"crestServer","http://crest-undertow-api.web.cern.ch","CREST URL with the port number as a string (default http://crest-undertow-api.web.cern.ch)"};
+  StringProperty m_par_crestServer{this,"crestServer","http://crest-undertow-api.web.cern.ch","CREST URL with the port number as a string, or file://<directory> for a local CREST dump (default http://crest-undertow-api.web.cern.ch)"};
   // Format of data; default is empty string (default for a given source)
   StringProperty m_par_format{this,"Format",{},"Format of data; default is empty string (default for a given source)"};
   // Can output to file for debugging purposes
   BooleanProperty m_outputToFile{this,"OutputToFile",false,"output to file for debugging purposes"};
   BooleanProperty m_crestToFile{this,"CrestToFile",false,"output to file crest data for debugging purposes"};
+  // Local cache of decoded folder payloads, shared by the jobs running on a node
+  StringProperty m_par_payloadCacheDir{this,"PayloadCacheDir","","directory of the local cache of decoded folder payloads (default: no cache)"};
   // internal parameters  
   // handles to other services and tools
   ServiceHandle<IIOVSvc>         m_h_IOVSvc{this,"IOVSvc","IOVSvc"};
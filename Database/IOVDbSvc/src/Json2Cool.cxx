@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "Json2Cool.h"
@@ -12,8 +12,11 @@
 #include "CxxUtils/checker_macros.h"
 #include "boost/regex.hpp"
 #include "Base64Codec.h"
+#include <algorithm>
+#include <memory>
 #include <stdexcept>
 #include <iostream>
+#include <utility>
 
 using json = nlohmann::json;
 using namespace cool;
@@ -46,129 +49,31 @@ const std::map<std::string, cool::StorageType::TypeId> typeCorrespondance={
     };
 
 
-} // anonymous namespace
-  
-  
-namespace IOVDbNamespace{
-
-
-  Json2Cool::Json2Cool(std::istream & stream, BasicFolder & b, const std::string & specString, const IovStore::Iov_t* iov):m_basicFolder(b){
-  init(stream, specString, iov);
-  }
-  
+  //set attribute i of the record from its JSON value
   void
-  Json2Cool::init(std::istream & s, const std::string & specString, const IovStore::Iov_t* iov){
-    if (not s.good() or s.eof()){
-      const std::string msg("Json2Cool constructor; Input is invalid and could not be opened.");
-      throw std::runtime_error(msg);
-    } else {
-      json j;
-      try{
-        s>>j; //read into json
-      }catch (const std::exception& e) {
-        std::cout<<"ERROR AT LINE "<<__LINE__<<" of "<<__FILE__<<std::endl;
-        std::cout<<e.what()<<std::endl; //typically a parsing error
-      }
-      m_sharedSpec = parsePayloadSpec(specString);
-      const auto & payload=j["data"];//payload is an object in any case, of form {"0":["datastring"]}
-      //keep these lines for reference: iov handling is not yet implemented, but should be
-      //const auto & iovFromFile=j["iov"];//iov is a two-element array
-      //const std::pair<cool::ValidityKey, cool::ValidityKey> iov(iovFromFile[0], iovFromFile[1]);
-      if(iov) {
-	m_basicFolder.setIov(*iov);
-      }
-      else {
-	m_basicFolder.setIov(IovStore::Iov_t(0, cool::ValidityKeyMax));
-      }
-      if (m_basicFolder.isVectorPayload()){
-        for (json::const_iterator k=payload.begin();k!=payload.end();++k){ //k are {"0":}
-          const json& f=k.value(); //channel id
-          const std::string& ks=k.key();
-          const long long key=std::stoll(ks);
-          std::vector<coral::AttributeList> tempVector;//can optimise this by pre constructing it and using 'clear'
-          for (json::const_iterator i=f.begin();i!=f.end();++i){
-            const json& arrayElem=i.value();
-            auto r=createAttributeList(m_sharedSpec,arrayElem);
-            const auto & attList=r.attributeList();
-            tempVector.push_back(attList);
-          }
-          m_basicFolder.addChannelPayload(key, tempVector);
-          //add payload with channelId here
-        }
-      } else {
-        for (json::const_iterator i=payload.begin();i!=payload.end();++i){
-          const json& f=i.value();
-          const std::string& ks=i.key();
-          const long long key=std::stoll(ks);
-          auto r=createAttributeList(m_sharedSpec,f);
-          const auto & attList=r.attributeList();
-          m_basicFolder.addChannelPayload(key, attList);
-        }
-      }
-    }
-  }
-  
-  //parsing something like
-  // "folder_payloadspec": "crate: UChar, slot: UChar, ROB: Int32, SRCid: Int32, BCIDOffset: Int16, slave0: Int32, slave1: Int32, slave2: Int32, slave3: Int32"
-  cool::RecordSpecification *
-  Json2Cool::parsePayloadSpec(const std::string & stringSpecification){
-    if (stringSpecification.empty()) return nullptr;
-    std::string input(stringSpecification);
-    auto *spec = new cool::RecordSpecification();
-    
-    std::string regex=R"delim(([^\s,:]*):\s?([^\s,]*),?)delim";
-    boost::regex expression(regex);
-    boost::smatch what;
-    
-    bool match=boost::regex_search(input, what, expression);
-    while (match){
-      std::string n(what[1]);
-      std::string t(what[2]);
-      //todo: need to catch error if type not found, also
-      spec->extend(n, typeCorrespondance.find(t)->second);
-      input = what.suffix();
-      match=boost::regex_search(input, what, expression);
-      
-    }
-    return spec;
-  }
-  
-  cool::Record 
-  Json2Cool::createAttributeList(cool::RecordSpecification * pSpec, const nlohmann::json & j){
-    cool::Record a(*pSpec);
-    unsigned int s=a.size();
-    
-    json::const_iterator it = j.begin();
-    for (unsigned int i(0);i!=s;++i){
-      auto & f=a[i];
-      if (it == j.end()){
-        continue;
+  setAttribute(cool::Record & a, unsigned int i, const json & thisVal){
+    try{
+      // cool::Record does not provide non-const access to AttributeList.
+      // But this is safe because we are filling a local instance.
+      auto & att ATLAS_THREAD_SAFE = const_cast<coral::Attribute&>(a.attributeList()[i]);
+      if (thisVal.is_null()){
+        att.setNull();
+        return;
       }
-      const auto  thisVal = it.value();
-      ++it;
-      
-      try{
-        // cool::Record does not provide non-const access to AttributeList.
-        // But this is safe because we are filling a local instance.
-        auto & att ATLAS_THREAD_SAFE = const_cast<coral::Attribute&>(a.attributeList()[i]);
-        if (thisVal.is_null()){
-          att.setNull();
-          continue;
-        }
-	cool::StorageType::TypeId typespec = f.storageType().id();
-        std::string strVal = to_string(thisVal);
-        if(strVal.size()>2&& strVal[0]=='"'&& strVal[strVal.size()-1]=='"')
-          strVal=strVal.substr(1,strVal.size()-2);
+	cool::StorageType::TypeId typespec = a[i].storageType().id();
+      std::string strVal = to_string(thisVal);
+      if(strVal.size()>2&& strVal[0]=='"'&& strVal[strVal.size()-1]=='"')
+        strVal=strVal.substr(1,strVal.size()-2);
 
-        if((strVal.compare("NULL")==0||strVal.compare("null")==0)&&
+      if((strVal.compare("NULL")==0||strVal.compare("null")==0)&&
 	  (typespec==StorageType::Bool || typespec==StorageType::Int16 || typespec==StorageType::UInt16
-          || typespec==StorageType::Int32 || typespec==StorageType::UInt32
-          || typespec==StorageType::Int64 || typespec==StorageType::UInt63
-          || typespec==StorageType::Float || typespec==StorageType::Double)){
-          att.setNull();
-          continue;
-        }
-        switch (typespec) {
+        || typespec==StorageType::Int32 || typespec==StorageType::UInt32
+        || typespec==StorageType::Int64 || typespec==StorageType::UInt63
+        || typespec==StorageType::Float || typespec==StorageType::Double)){
+        att.setNull();
+        return;
+      }
+      switch (typespec) {
 	case StorageType::Bool:
 	  {
 	    const bool newVal=(strVal == "true");
@@ -264,11 +169,265 @@ namespace IOVDbNamespace{
 	    break;
 	  }
 	}
-      } 
-      catch (json::exception& e){
-        std::cerr << e.what() << std::endl;
+    } 
+    catch (json::exception& e){
+      std::cerr << e.what() << std::endl;
 	throw std::runtime_error(e.what());
+    }
+  }
+
+  /**
+   * SAX handler filling the attribute lists of the payload object found at the end of 'path',
+   * one value at a time. Only the values are materialised as (scalar) json objects, so that the
+   * conversion is the same as for a parsed tree.
+   * Depths count the open containers: the payload object is at depth path.size()+1, its channels
+   * one level below and, for vector payloads, each attribute list one more level below.
+   */
+  class PayloadHandler : public json::json_sax_t{
+  public:
+    typedef std::vector<std::pair<cool::ChannelId, coral::AttributeList>> Payloads_t;
+    typedef std::vector<std::pair<cool::ChannelId, std::vector<coral::AttributeList>>> VectorPayloads_t;
+
+    PayloadHandler(cool::RecordSpecification * pSpec, const bool vectorPayload, const std::vector<std::string> & path):
+      m_pSpec(pSpec), m_vectorPayload(vectorPayload), m_path(path),
+      m_payloadDepth(path.size()+1), m_attributeDepth(path.size()+(vectorPayload ? 3 : 2)){
+      //nop
+    }
+
+    bool null() override { return value(json());}
+    bool boolean(bool val) override { return value(json(val));}
+    bool number_integer(number_integer_t val) override { return value(json(val));}
+    bool number_unsigned(number_unsigned_t val) override { return value(json(val));}
+    bool number_float(number_float_t val, const string_t &) override { return value(json(val));}
+    bool string(string_t & val) override { return value(json(std::move(val)));}
+    bool binary(binary_t &) override { return value(json());}
+    bool start_object(std::size_t) override { return start();}
+    bool start_array(std::size_t) override { return start();}
+    bool end_object() override { return end();}
+    bool end_array() override { return end();}
+
+    bool key(string_t & val) override {
+      m_pending = (m_matched+1==m_depth) and (m_matched<m_path.size()) and (val==m_path[m_matched]);
+      if (inPayload() and m_depth==m_payloadDepth) m_channel=std::stoll(val);
+      return true;
+    }
+
+    bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception & e) override {
+      m_error=e.what();
+      return false;
+    }
+
+    const std::string & error() const { return m_error;}
+    Payloads_t & payloads() { return m_payloads;}
+    VectorPayloads_t & vectorPayloads() { return m_vectorPayloads;}
+
+  private:
+    bool inPayload() const { return m_matched==m_path.size();}
+
+    void newRecord(){
+      m_record=std::make_unique<cool::Record>(*m_pSpec);
+      m_index=0;
+    }
+
+    bool value(const json & val){
+      m_pending=false;
+      if (inPayload() and m_depth==m_attributeDepth and m_record){
+        if (m_index<m_record->size()) setAttribute(*m_record, m_index, val);
+        ++m_index;
       }
+      return true;
+    }
+
+    bool start(){
+      ++m_depth;
+      if (m_pending){
+        //entering the next object on the path to the payload
+        m_pending=false;
+        ++m_matched;
+        return true;
+      }
+      if (not inPayload()) return true;
+      if (m_depth==m_payloadDepth+1){
+        //a channel
+        m_vector.clear();
+        if (not m_vectorPayload) newRecord();
+      } else if (m_vectorPayload and m_depth==m_payloadDepth+2){
+        //an attribute list of a vector payload
+        newRecord();
+      } else if (m_depth==m_attributeDepth+1){
+        //structured value in place of an attribute: not supported, skipped
+        ++m_index;
+      }
+      return true;
+    }
+
+    bool end(){
+      if (inPayload()){
+        if (m_depth==m_payloadDepth+1){
+          //end of a channel
+          if (m_vectorPayload){
+            m_vectorPayloads.emplace_back(m_channel, std::move(m_vector));
+            m_vector.clear();
+          } else if (m_record){
+            m_payloads.emplace_back(m_channel, m_record->attributeList());
+          }
+          m_record.reset();
+        } else if (m_vectorPayload and m_depth==m_payloadDepth+2 and m_record){
+          m_vector.push_back(m_record->attributeList());
+          m_record.reset();
+        }
+      }
+      //leaving an object on the path to the payload
+      if (m_matched>0 and m_matched+1>=m_depth) m_matched=m_depth-2;
+      --m_depth;
+      return true;
+    }
+
+    cool::RecordSpecification * m_pSpec;
+    const bool m_vectorPayload;
+    const std::vector<std::string> & m_path;
+    const std::size_t m_payloadDepth;
+    const std::size_t m_attributeDepth;
+    std::size_t m_depth{};
+    std::size_t m_matched{};
+    bool m_pending{};
+    cool::ChannelId m_channel{};
+    std::unique_ptr<cool::Record> m_record;
+    unsigned int m_index{};
+    std::vector<coral::AttributeList> m_vector;
+    Payloads_t m_payloads;
+    VectorPayloads_t m_vectorPayloads;
+    std::string m_error;
+  };
+
+  /// SAX handler collecting the keys of the "obj" object at top level
+  class MultiIovHandler : public json::json_sax_t{
+  public:
+    bool null() override { return true;}
+    bool boolean(bool) override { return true;}
+    bool number_integer(number_integer_t) override { return true;}
+    bool number_unsigned(number_unsigned_t) override { return true;}
+    bool number_float(number_float_t, const string_t &) override { return true;}
+    bool string(string_t &) override { return true;}
+    bool binary(binary_t &) override { return true;}
+    bool start_object(std::size_t) override { ++m_depth; return true;}
+    bool start_array(std::size_t) override { ++m_depth; return true;}
+    bool end_object() override { return end();}
+    bool end_array() override { return end();}
+    bool key(string_t & val) override {
+      if (m_depth==1) m_inObj = (val=="obj");
+      else if (m_depth==2 and m_inObj) m_sinces.push_back(std::stoull(val));
+      return true;
+    }
+    bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception & e) override {
+      throw std::runtime_error(e.what());
+    }
+    std::vector<cool::ValidityKey> & sinces() { return m_sinces;}
+  private:
+    bool end(){
+      if (--m_depth==1) m_inObj=false;
+      return true;
+    }
+    std::size_t m_depth{};
+    bool m_inObj{};
+    std::vector<cool::ValidityKey> m_sinces;
+  };
+} // anonymous namespace
+  
+  
+namespace IOVDbNamespace{
+
+
+  Json2Cool::Json2Cool(std::istream & stream, BasicFolder & b, const std::string & specString, const IovStore::Iov_t* iov):m_basicFolder(b){
+    if (not stream.good() or stream.eof()){
+      const std::string msg("Json2Cool constructor; Input is invalid and could not be opened.");
+      throw std::runtime_error(msg);
+    }
+    init(stream, specString, iov, {"data"});
+  }
+
+  Json2Cool::Json2Cool(std::string_view payload, BasicFolder & b, const std::string & specString, const IovStore::Iov_t* iov,
+                       const std::vector<std::string> & payloadPath):m_basicFolder(b){
+    if (payload.empty()){
+      const std::string msg("Json2Cool constructor; Input is empty.");
+      throw std::runtime_error(msg);
+    }
+    init(payload, specString, iov, payloadPath);
+  }
+
+  template<class InputType>
+  void
+  Json2Cool::init(InputType && input, const std::string & specString, const IovStore::Iov_t* iov, const std::vector<std::string> & payloadPath){
+    m_sharedSpec = parsePayloadSpec(specString);
+    if(iov) {
+      m_basicFolder.setIov(*iov);
+    }
+    else {
+      m_basicFolder.setIov(IovStore::Iov_t(0, cool::ValidityKeyMax));
+    }
+    //payload is an object in any case, of form {"0":["datastring"]}
+    PayloadHandler handler(m_sharedSpec, m_basicFolder.isVectorPayload(), payloadPath);
+    if (not json::sax_parse(std::forward<InputType>(input), &handler)){
+      std::cout<<"ERROR AT LINE "<<__LINE__<<" of "<<__FILE__<<std::endl;
+      std::cout<<handler.error()<<std::endl; //typically a parsing error
+      return;
+    }
+    for (auto & [channel, attList]:handler.payloads()){
+      m_basicFolder.addChannelPayload(channel, attList);
+    }
+    for (auto & [channel, attLists]:handler.vectorPayloads()){
+      m_basicFolder.addChannelPayload(channel, std::move(attLists));
+    }
+  }
+
+  std::vector<cool::ValidityKey>
+  Json2Cool::multiIovSinces(std::string_view payload){
+    MultiIovHandler handler;
+    json::sax_parse(payload, &handler);
+    auto & sinces=handler.sinces();
+    std::sort(sinces.begin(), sinces.end());
+    return std::move(sinces);
+  }
+  
+  //parsing something like
+  // "folder_payloadspec": "crate: UChar, slot: UChar, ROB: Int32, SRCid: Int32, BCIDOffset: Int16, slave0: Int32, slave1: Int32, slave2: Int32, slave3: Int32"
+  cool::RecordSpecification *
+  Json2Cool::parsePayloadSpec(const std::string & stringSpecification){
+    if (stringSpecification.empty()) return nullptr;
+    std::string input(stringSpecification);
+    auto *spec = new cool::RecordSpecification();
+    
+    std::string regex=R"delim(([^\s,:]*):\s?([^\s,]*),?)delim";
+    boost::regex expression(regex);
+    boost::smatch what;
+    
+    bool match=boost::regex_search(input, what, expression);
+    while (match){
+      std::string n(what[1]);
+      std::string t(what[2]);
+      //todo: need to catch error if type not found, also
+      spec->extend(n, typeCorrespondance.find(t)->second);
+      input = what.suffix();
+      match=boost::regex_search(input, what, expression);
+      
+    }
+    return spec;
+  }
+  
+  cool::Record 
+  Json2Cool::createAttributeList(cool::RecordSpecification * pSpec, const nlohmann::json & j){
+    cool::Record a(*pSpec);
+    unsigned int s=a.size();
+    
+    json::const_iterator it = j.begin();
+    for (unsigned int i(0);i!=s;++i){
+      if (it == j.end()){
+        continue;
+      }
+      const auto  thisVal = it.value();
+      ++it;
+      
+      setAttribute(a, i, thisVal);
     }
     return a;
   }
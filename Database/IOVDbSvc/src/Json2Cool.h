@@ -1,13 +1,15 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 #ifndef IOVDBSVC_JSON2COOL_H
 #define IOVDBSVC_JSON2COOL_H
 
 #include "CoolKernel/StorageType.h"
 #include <string>
+#include <string_view>
 #include <istream>
 #include <map>
+#include <vector>
 #include "nlohmann/json.hpp"
 #include "BasicFolder.h"
 #include "IovStore.h"
@@ -23,14 +25,24 @@ namespace IOVDbNamespace {
    * @class Json2Cool
    * @brief Produces cool objects from their JSON representation, storing them in a 'BasicFolder'
    *
+   * The document is read with a SAX parser: the attribute lists are filled as the values are
+   * parsed, without building the JSON tree of the whole payload.
+   * The payload object ({"<channel>":[values...]} or {"<channel>":[[values...],...]} for vector
+   * payloads) is found by following payloadPath from the top level object; everything else is skipped.
    */
 
   class Json2Cool {
   public:
     
     Json2Cool(std::istream & stream, BasicFolder & b, const std::string &specString, const IovStore::Iov_t* iov = nullptr);
+    Json2Cool(std::string_view payload, BasicFolder & b, const std::string &specString, const IovStore::Iov_t* iov = nullptr,
+              const std::vector<std::string> & payloadPath = {"data"});
     ~Json2Cool() = default;
     
+    ///sorted 'since' of the IOVs in a crest-json-multi-iov payload, {"obj":{"<since>":{payload object},...}}
+    static std::vector<cool::ValidityKey>
+    multiIovSinces(std::string_view payload);
+    
     static cool::Record 
     createAttributeList(cool::RecordSpecification * pSpec, const nlohmann::json & j);
     
@@ -38,7 +50,8 @@ namespace IOVDbNamespace {
     parsePayloadSpec(const std::string & stringSpecification);
     
   private:
-    void init(std::istream & stream, const std::string & specString, const IovStore::Iov_t* iov);
+    template<class InputType>
+    void init(InputType && input, const std::string & specString, const IovStore::Iov_t* iov, const std::vector<std::string> & payloadPath);
     cool::RecordSpecification * m_sharedSpec = nullptr;
     BasicFolder &m_basicFolder;
     
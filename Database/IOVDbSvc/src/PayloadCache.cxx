@@ -0,0 +1,288 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "PayloadCache.h"
+
+#include "CoralBase/Attribute.h"
+#include "CoralBase/AttributeListSpecification.h"
+#include "CoralBase/AttributeSpecification.h"
+#include "CoralBase/Blob.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <typeinfo>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+  const char fileMagic[8]={'I','O','V','D','B','P','C','\0'};
+  constexpr uint32_t formatVersion{1};
+  const std::string fileSuffix{".iovpc"};
+
+  //FNV-1a, stable between jobs and platforms
+  uint64_t
+  keyHash(const std::string & key){
+    uint64_t h{14695981039346656037ULL};
+    for (unsigned char c:key){
+      h^=c;
+      h*=1099511628211ULL;
+    }
+    return h;
+  }
+
+  template<class T>
+  struct TypeTag{ using type=T;};
+
+  //call f with the tag of the numeric type matching t, return false if there is none
+  template<class F>
+  bool
+  forNumericType(const std::type_info & t, F && f){
+    if (t==typeid(bool)) f(TypeTag<bool>{});
+    else if (t==typeid(char)) f(TypeTag<char>{});
+    else if (t==typeid(unsigned char)) f(TypeTag<unsigned char>{});
+    else if (t==typeid(short)) f(TypeTag<short>{});
+    else if (t==typeid(unsigned short)) f(TypeTag<unsigned short>{});
+    else if (t==typeid(int)) f(TypeTag<int>{});
+    else if (t==typeid(unsigned int)) f(TypeTag<unsigned int>{});
+    else if (t==typeid(long)) f(TypeTag<long>{});
+    else if (t==typeid(unsigned long)) f(TypeTag<unsigned long>{});
+    else if (t==typeid(long long)) f(TypeTag<long long>{});
+    else if (t==typeid(unsigned long long)) f(TypeTag<unsigned long long>{});
+    else if (t==typeid(float)) f(TypeTag<float>{});
+    else if (t==typeid(double)) f(TypeTag<double>{});
+    else return false;
+    return true;
+  }
+
+  class Writer{
+  public:
+    template<class T>
+    void put(const T & v){ m_buffer.append(reinterpret_cast<const char*>(&v), sizeof(T));}
+    void putBytes(const void * p, uint32_t n){
+      put(n);
+      m_buffer.append(static_cast<const char*>(p), n);
+    }
+    void putString(const std::string & s){ putBytes(s.data(), s.size());}
+    const std::string & buffer() const { return m_buffer;}
+  private:
+    std::string m_buffer;
+  };
+
+  class Reader{
+  public:
+    Reader(const char * p, size_t n):m_p(p),m_end(p+n){}
+    bool ok() const { return m_ok;}
+    bool atEnd() const { return m_p==m_end;}
+    //check that the next bytes are those given
+    bool expect(const char * p, size_t n){
+      if (not take(n)) return false;
+      return std::memcmp(m_p-n, p, n)==0;
+    }
+    template<class T>
+    T get(){
+      T v{};
+      if (not take(sizeof(T))) return v;
+      std::memcpy(&v, m_p-sizeof(T), sizeof(T));
+      return v;
+    }
+    //returns pointer to the n bytes following the length word
+    const char * getBytes(uint32_t & n){
+      n=get<uint32_t>();
+      if (not take(n)) return nullptr;
+      return m_p-n;
+    }
+    std::string getString(){
+      uint32_t n{};
+      const char * p=getBytes(n);
+      return p ? std::string(p,n) : std::string();
+    }
+  private:
+    bool take(size_t n){
+      if (not m_ok or static_cast<size_t>(m_end-m_p)<n){
+        m_ok=false;
+        return false;
+      }
+      m_p+=n;
+      return true;
+    }
+    const char * m_p;
+    const char * m_end;
+    bool m_ok{true};
+  };
+
+  bool
+  putAttribute(Writer & w, const coral::Attribute & a){
+    const std::type_info & t=a.specification().type();
+    w.put<uint8_t>(a.isNull());
+    if (a.isNull()) return true;
+    if (t==typeid(std::string)){
+      w.putString(a.data<std::string>());
+      return true;
+    }
+    if (t==typeid(coral::Blob)){
+      const coral::Blob & b=a.data<coral::Blob>();
+      w.putBytes(b.startingAddress(), static_cast<uint32_t>(b.size()));
+      return true;
+    }
+    return forNumericType(t, [&](auto tag){ w.put(a.data<typename decltype(tag)::type>()); });
+  }
+
+  bool
+  getAttribute(Reader & r, coral::Attribute & a){
+    const std::type_info & t=a.specification().type();
+    if (r.get<uint8_t>()){
+      a.setNull();
+      return r.ok();
+    }
+    if (t==typeid(std::string)){
+      a.setValue(r.getString());
+      return r.ok();
+    }
+    if (t==typeid(coral::Blob)){
+      uint32_t n{};
+      const char * p=r.getBytes(n);
+      if (not p) return false;
+      coral::Blob b(n);
+      if (n) std::memcpy(b.startingAddress(), p, n);
+      a.setValue(b);
+      return true;
+    }
+    return forNumericType(t, [&](auto tag){ a.setValue(r.get<typename decltype(tag)::type>()); }) and r.ok();
+  }
+}
+
+namespace IOVDbNamespace{
+  PayloadCache::PayloadCache(const std::string & directory):m_directory(directory){
+    //nop
+  }
+
+  std::string
+  PayloadCache::fileName(const std::string & key) const{
+    char hash[17];
+    std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(keyHash(key)));
+    return m_directory+"/"+hash+fileSuffix;
+  }
+
+  bool
+  PayloadCache::write(const std::string & key, const Snapshot & snapshot) const{
+    if (not enabled()) return false;
+    Writer w;
+    w.put(fileMagic);
+    w.put(formatVersion);
+    w.putString(key);
+    w.put<uint8_t>(snapshot.vectorPayload);
+    //specification, from the first attribute list
+    if (snapshot.attributes.empty()){
+      w.put<uint32_t>(0);
+    } else {
+      const coral::AttributeList & first=snapshot.attributes.front();
+      w.put<uint32_t>(first.size());
+      for (const auto & attribute:first){
+        const coral::AttributeSpecification & spec=attribute.specification();
+        w.putString(spec.name());
+        w.putString(spec.typeName());
+      }
+    }
+    w.put<uint64_t>(snapshot.objects.size());
+    for (const auto & obj:snapshot.objects){
+      w.put<uint64_t>(obj.since);
+      w.put<uint64_t>(obj.until);
+      w.put<uint32_t>(obj.channel);
+      w.put<uint32_t>(obj.begin);
+      w.put<uint32_t>(obj.end);
+    }
+    w.put<uint64_t>(snapshot.attributes.size());
+    for (const auto & atrlist:snapshot.attributes){
+      for (const auto & attribute:atrlist){
+        if (not putAttribute(w, attribute)) return false;
+      }
+    }
+    //write under a unique name, then move into place
+    const std::string target=fileName(key);
+    const std::string temporary=target+"."+std::to_string(::getpid())+".tmp";
+    {
+      std::ofstream out(temporary, std::ios::binary|std::ios::trunc);
+      out.write(w.buffer().data(), w.buffer().size());
+      if (not out.good()){
+        out.close();
+        std::remove(temporary.c_str());
+        return false;
+      }
+    }
+    if (std::rename(temporary.c_str(), target.c_str())!=0){
+      std::remove(temporary.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  bool
+  PayloadCache::read(const std::string & key, Snapshot & snapshot) const{
+    if (not enabled()) return false;
+    const int fd=::open(fileName(key).c_str(), O_RDONLY);
+    if (fd<0) return false;
+    struct stat st;
+    if (::fstat(fd, &st)!=0 or st.st_size<=0){
+      ::close(fd);
+      return false;
+    }
+    const size_t size=st.st_size;
+    void * base=::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base==MAP_FAILED) return false;
+
+    Snapshot result;
+    Reader r(static_cast<const char*>(base), size);
+    bool good=false;
+    if (r.expect(fileMagic, sizeof(fileMagic)) and r.get<uint32_t>()==formatVersion and r.getString()==key){
+      result.vectorPayload=r.get<uint8_t>();
+      auto *pSpec=new coral::AttributeListSpecification;
+      const uint32_t nspec=r.get<uint32_t>();
+      try{
+        for (uint32_t i=0; i<nspec and r.ok(); ++i){
+          const std::string name=r.getString();
+          const std::string typeName=r.getString();
+          pSpec->extend(name, typeName);
+        }
+        const uint64_t nobj=r.get<uint64_t>();
+        for (uint64_t i=0; i<nobj and r.ok(); ++i){
+          Object obj;
+          obj.since=r.get<uint64_t>();
+          obj.until=r.get<uint64_t>();
+          obj.channel=r.get<uint32_t>();
+          obj.begin=r.get<uint32_t>();
+          obj.end=r.get<uint32_t>();
+          result.objects.push_back(obj);
+        }
+        const uint64_t nattr=r.get<uint64_t>();
+        good=r.ok();
+        if (good) result.attributes.reserve(nattr);
+        for (uint64_t i=0; i<nattr and good; ++i){
+          result.attributes.emplace_back(*pSpec, true);
+          for (auto & attribute:result.attributes.back()){
+            if (not getAttribute(r, attribute)){
+              good=false;
+              break;
+            }
+          }
+        }
+        for (const auto & obj:result.objects){
+          if (obj.begin>obj.end or obj.end>nattr) good=false;
+        }
+        good=good and r.atEnd();
+      } catch (const std::exception &){
+        //unknown type name in the specification
+        good=false;
+      }
+      pSpec->release();
+    }
+    ::munmap(base, size);
+    if (good) snapshot=std::move(result);
+    return good;
+  }
+}
@@ -0,0 +1,62 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef IOVDbSvc_PayloadCache_h
+#define IOVDbSvc_PayloadCache_h
+/**
+ * @file PayloadCache.h
+ * @brief helper class for IOVDbFolder keeping decoded folder payloads in a local binary file cache
+ **/
+#include "CoolKernel/ValidityKey.h"
+#include "CoolKernel/ChannelId.h"
+#include "CoralBase/AttributeList.h"
+#include <string>
+#include <utility> //pair
+#include <vector>
+
+namespace IOVDbNamespace{
+  /**
+   * @brief On-disk cache of the decoded payloads of a folder cache load
+   *
+   * Each load is stored in its own file in the cache directory, named after a hash of the
+   * key (folder, tag, query range...), which is also stored in the file and checked on reading.
+   * The file is a flat binary image of the attribute lists: it is mapped and decoded in one pass,
+   * without any COOL query or JSON/Base64 parsing.
+   * Files are written to a temporary name and renamed, so that concurrent jobs on one node
+   * never see a partial file. A missing, stale or corrupt file is simply a cache miss.
+   **/
+  class PayloadCache{
+  public:
+    ///One cached object: its IOV, channel and range of attribute lists in the snapshot
+    struct Object{
+      cool::ValidityKey since{};
+      cool::ValidityKey until{};
+      cool::ChannelId channel{};
+      unsigned int begin{};
+      unsigned int end{};
+    };
+    ///Decoded content of a cache load
+    struct Snapshot{
+      bool vectorPayload{false};
+      std::vector<Object> objects;
+      ///all attribute lists, sharing one specification
+      std::vector<coral::AttributeList> attributes;
+    };
+
+    ///Constructor; an empty directory disables the cache
+    PayloadCache(const std::string & directory="");
+    ///is the cache in use?
+    bool enabled() const { return not m_directory.empty();}
+    ///Read the snapshot stored for key, return false if there is none or it can not be used
+    bool read(const std::string & key, Snapshot & snapshot) const;
+    ///Store the snapshot for key, return false if it could not be written (e.g. unsupported attribute type)
+    bool write(const std::string & key, const Snapshot & snapshot) const;
+    ///File used for the given key
+    std::string fileName(const std::string & key) const;
+  private:
+    std::string m_directory;
+  };
+}
+
+#endif
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 /*
  */
@@ -36,6 +36,7 @@
 #include <istream>
 #include <string>
 #include <sstream>
+#include <vector>
 
 using namespace std::string_literals;
 using namespace IOVDbNamespace;
@@ -104,6 +105,34 @@ BOOST_AUTO_TEST_SUITE(Json2CoolTest)
     //
     BOOST_CHECK(reference == record);
   }
+  BOOST_AUTO_TEST_CASE(streamedVectorPayload){
+    const std::string vectorJson=R"foo({"iov":[0,10],"data":{"3":[[1,"a"],[2,null,"ignored"]],"1":[[4]]},"tail":{"data":{"5":[[6,"x"]]}}})foo";
+    BasicFolder b;
+    b.setVectorPayloadFlag(true);
+    BOOST_CHECK_NO_THROW(Json2Cool j(vectorJson, b, "ROB: Int32, AName: String255"));
+    //channels in document order, "data" below the top level is not the payload
+    BOOST_CHECK(b.channelIds() == std::vector<cool::ChannelId>({3,1}));
+    const auto lists=b.getVectorPayload(3);
+    BOOST_CHECK(lists.size() == 2);
+    BOOST_CHECK(lists[0][0].data<int>() == 1);
+    BOOST_CHECK(lists[0][1].data<std::string>() == "a");
+    BOOST_CHECK(lists[1][0].data<int>() == 2);
+    BOOST_CHECK(lists[1][1].isNull());
+    BOOST_CHECK(b.getVectorPayload(1).size() == 1);
+  }
+  BOOST_AUTO_TEST_CASE(multiIovPayload){
+    const std::string multiJson=R"foo({"obj":{"20":{"0":[2]},"10":{"0":[1]},"30":{"0":[3]}}})foo";
+    BOOST_CHECK(Json2Cool::multiIovSinces(multiJson) == std::vector<cool::ValidityKey>({10,20,30}));
+    BasicFolder b;
+    BOOST_CHECK_NO_THROW(Json2Cool j(multiJson, b, "ROB: Int32", nullptr, {"obj","20"}));
+    BOOST_CHECK(b.channelIds() == std::vector<cool::ChannelId>({0}));
+    BOOST_CHECK(b.getPayload(0)[0].data<int>() == 2);
+  }
+  BOOST_AUTO_TEST_CASE(invalidDocumentLeavesFolderEmpty){
+    BasicFolder b;
+    BOOST_CHECK_NO_THROW(Json2Cool j(std::string(R"foo({"data":{"0":[1],"1":[)foo"), b, "ROB: Int32"));
+    BOOST_CHECK(b.empty());
+  }
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,125 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file IOVDbSvc/test/PayloadCache_test.cxx
+ * @date Oct, 2026
+ * @brief Some tests for PayloadCache class in the Boost framework
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_MODULE TEST_IOVDBSVC
+
+
+#include <boost/test/unit_test.hpp>
+//
+#include "CoralBase/AttributeList.h"
+#include "CoralBase/AttributeListSpecification.h"
+#include "CoralBase/Attribute.h"
+#include "CoralBase/Blob.h"
+
+#include "../src/PayloadCache.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+using namespace IOVDbNamespace;
+
+struct CacheDirFixture{
+  CacheDirFixture():directory(std::filesystem::temp_directory_path().string()+"/PayloadCache_test."+std::to_string(::getpid())){
+    std::filesystem::create_directories(directory);
+  }
+  ~CacheDirFixture(){
+    std::filesystem::remove_all(directory);
+  }
+  std::string directory;
+};
+
+namespace{
+  PayloadCache::Snapshot
+  makeSnapshot(){
+    auto *pSpec=new coral::AttributeListSpecification;
+    pSpec->extend<int>("myInt");
+    pSpec->extend<double>("myDouble");
+    pSpec->extend<std::string>("PoolRef");
+    pSpec->extend<coral::Blob>("myBlob");
+    PayloadCache::Snapshot s;
+    s.vectorPayload=true;
+    for (int i=0;i!=3;++i){
+      s.attributes.emplace_back(*pSpec, true);
+      s.attributes.back()[0].setValue(i);
+      s.attributes.back()[1].setValue(0.5*i);
+      s.attributes.back()[2].setValue(std::string("hello")+std::to_string(i));
+      coral::Blob b(i);
+      s.attributes.back()[3].setValue(b);
+    }
+    s.attributes[1][1].setNull();
+    pSpec->release();
+    s.objects.push_back({0,10,5,0,2});
+    s.objects.push_back({10,cool::ValidityKeyMax,7,2,3});
+    return s;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(PayloadCacheTest)
+  BOOST_AUTO_TEST_CASE(disabledByDefault){
+    PayloadCache c;
+    BOOST_CHECK(c.enabled() == false);
+    PayloadCache::Snapshot s;
+    BOOST_CHECK(c.write("key", makeSnapshot()) == false);
+    BOOST_CHECK(c.read("key", s) == false);
+  }
+  BOOST_FIXTURE_TEST_CASE(roundTrip, CacheDirFixture){
+    PayloadCache c(directory);
+    BOOST_CHECK(c.enabled());
+    const auto original=makeSnapshot();
+    PayloadCache::Snapshot s;
+    BOOST_CHECK(c.read("key", s) == false);
+    BOOST_CHECK(c.write("key", original));
+    BOOST_CHECK(c.read("key", s));
+    BOOST_CHECK(s.vectorPayload);
+    BOOST_CHECK(s.objects.size() == 2);
+    BOOST_CHECK(s.objects[1].until == cool::ValidityKeyMax);
+    BOOST_CHECK(s.objects[1].channel == 7);
+    BOOST_CHECK(s.objects[1].begin == 2);
+    BOOST_CHECK(s.attributes.size() == 3);
+    for (unsigned int i=0;i!=3;++i){
+      BOOST_CHECK(s.attributes[i] == original.attributes[i]);
+    }
+    BOOST_CHECK(s.attributes[1][1].isNull());
+  }
+  BOOST_FIXTURE_TEST_CASE(objectsOnly, CacheDirFixture){
+    //the sinces of a multi-IOV payload are stored without attributes
+    PayloadCache c(directory);
+    PayloadCache::Snapshot original;
+    original.objects.push_back({100,0,0,0,0});
+    original.objects.push_back({200,0,0,0,0});
+    BOOST_CHECK(c.write("key|sinces", original));
+    PayloadCache::Snapshot s;
+    BOOST_CHECK(c.read("key|sinces", s));
+    BOOST_CHECK(s.objects.size() == 2);
+    BOOST_CHECK(s.objects[1].since == 200);
+    BOOST_CHECK(s.attributes.empty());
+  }
+  BOOST_FIXTURE_TEST_CASE(keyIsChecked, CacheDirFixture){
+    PayloadCache c(directory);
+    BOOST_CHECK(c.write("key", makeSnapshot()));
+    //another key written to the same file is not returned for the first
+    std::filesystem::rename(c.fileName("key"), c.fileName("other"));
+    PayloadCache::Snapshot s;
+    BOOST_CHECK(c.read("other", s) == false);
+  }
+  BOOST_FIXTURE_TEST_CASE(corruptFileIsMiss, CacheDirFixture){
+    PayloadCache c(directory);
+    BOOST_CHECK(c.write("key", makeSnapshot()));
+    const auto size=std::filesystem::file_size(c.fileName("key"));
+    std::filesystem::resize_file(c.fileName("key"), size-3);
+    PayloadCache::Snapshot s;
+    BOOST_CHECK(c.read("key", s) == false);
+    std::ofstream(c.fileName("key"), std::ios::trunc) << "garbage";
+    BOOST_CHECK(c.read("key", s) == false);
+  }
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "ByteStreamEventStorageInputSvc.h"
@@ -44,6 +44,8 @@ ByteStreamEventStorageInputSvc::ByteStreamEventStorageInputSvc(
   , m_evtInFile(0)
   , m_evtFileOffset(0)
   , m_fileGUID("")
+  , m_mappedFile()
+  , m_mappedPosition(0)
   , m_storeGate    ("StoreGateSvc", name)
   , m_inputMetadata("StoreGateSvc/InputMetaDataStore", name)
   , m_robProvider  ("ROBDataProviderSvc", name)
@@ -52,6 +54,8 @@ ByteStreamEventStorageInputSvc::ByteStreamEventStorageInputSvc(
   , m_wait         (this, "WaitSecs",              0., "Seconds to wait if input is in wait state")
   , m_valEvent     (this, "ValidateEvent",       true, "switch on check_tree when reading events")
   , m_eventInfoKey (this, "EventInfoKey", "EventInfo", "Key of EventInfo in metadata store")
+  , m_useMmap      (this, "UseMmap",            false, "Read uncompressed local files in place from a memory mapping")
+  , m_mmapReadAhead(this, "MmapReadAheadMB",       64, "Size of the read-ahead window of the memory mapping in MB")
 {
   assert(pSvcLocator != nullptr);
 
@@ -141,7 +145,12 @@ ByteStreamEventStorageInputSvc::previousEvent()
     //get current event position (cast to long long until native tdaq implementation)
     m_evtInFile--;
     m_evtFileOffset = m_evtOffsets.at(m_evtInFile);
-    DRError ecode = m_reader->getData(eventSize, &(cache->data), m_evtOffsets.at(m_evtInFile - 1));
+    DRError ecode = DROK;
+    if (m_mappedFile) {
+      getMappedData(cache, eventSize, m_evtOffsets.at(m_evtInFile - 1));
+    } else {
+      ecode = m_reader->getData(eventSize, &(cache->data), m_evtOffsets.at(m_evtInFile - 1));
+    }
 
     if (DRWAIT == ecode && m_wait > 0) {
       do {
@@ -212,14 +221,26 @@ ByteStreamEventStorageInputSvc::nextEvent() {
     if (m_evtInFile+1 > m_evtOffsets.size()) {
       //get current event position (cast to long long until native tdaq implementation)
       ATH_MSG_DEBUG("nextEvent _above_ high water mark");
-      m_evtFileOffset = static_cast<long long>(m_reader->getPosition());
-      m_evtOffsets.push_back(m_evtFileOffset);
-      ecode = m_reader->getData(eventSize, &(cache->data));
+      if (m_mappedFile) {
+        m_evtFileOffset = m_mappedPosition;
+        m_evtOffsets.push_back(m_evtFileOffset);
+        m_mappedPosition = getMappedData(cache, eventSize, m_evtFileOffset);
+        ecode = DROK;
+      } else {
+        m_evtFileOffset = static_cast<long long>(m_reader->getPosition());
+        m_evtOffsets.push_back(m_evtFileOffset);
+        ecode = m_reader->getData(eventSize, &(cache->data));
+      }
     } else {
       // Load from previous offset
       ATH_MSG_DEBUG("nextEvent below high water mark");
       m_evtFileOffset = m_evtOffsets.at(m_evtInFile - 1);
-      ecode = m_reader->getData(eventSize, &(cache->data), m_evtFileOffset);
+      if (m_mappedFile) {
+        getMappedData(cache, eventSize, m_evtFileOffset);
+        ecode = DROK;
+      } else {
+        ecode = m_reader->getData(eventSize, &(cache->data), m_evtFileOffset);
+      }
     }
 
     if (DRWAIT == ecode && m_wait > 0) {
@@ -351,12 +372,14 @@ ByteStreamEventStorageInputSvc::buildFragment(
           DataType* newFragment  = new DataType[newEventSize];
           eformat::old::convert(fragment, newFragment, newEventSize);
 
-          // delete old fragment
-          delete [] fragment; fragment = nullptr;
+          // delete old fragment, unless it is in the mapped file
+          if (!cache->mappedData) delete [] fragment;
+          fragment = nullptr;
 
           // set new pointer
           fragment = newFragment;
           cache->data = reinterpret_cast< char* >(fragment);
+          cache->mappedData = false;
         }
       } catch (const eformat::Issue& ex) {
         // bad event
@@ -464,9 +487,16 @@ ByteStreamEventStorageInputSvc::EventCache::releaseEvent()
   }
 
   if (data) {
-    delete [] data;
+    if (!mappedData) delete [] data;
     data = nullptr;
   }
+  mappedData = false;
+
+  // allow the pages behind the events still in use to be dropped
+  if (mappedFile) {
+    mappedFile->release(eventOffset);
+    mappedFile.reset();
+  }
 }
 
 
@@ -494,6 +524,8 @@ ByteStreamEventStorageInputSvc::closeBlockIterator(bool clearMetadata)
         << m_evtOffsets.size()-1);
   }
 
+  // events still held by a slot keep their own reference to the mapping
+  m_mappedFile.reset();
   m_reader.reset();
 }
 
@@ -555,6 +587,17 @@ ByteStreamEventStorageInputSvc::getBlockIterator(const std::string& fileName)
   ATH_MSG_INFO("Picked valid file: " << m_reader->fileName());
   // initialize offsets and counters
   m_evtOffsets.push_back(static_cast<long long>(m_reader->getPosition()));
+
+  // read uncompressed local files in place, the DataReader is still used for the metadata
+  if (m_useMmap && !m_sequential && m_wait <= 0 && m_reader->compression() == EventStorage::NONE) {
+    m_mappedFile = ByteStreamMappedFile::open(fileName, m_mmapReadAhead.value() * 1024UL * 1024UL);
+    if (m_mappedFile) {
+      m_mappedPosition = m_evtOffsets.back();
+      ATH_MSG_DEBUG("Reading events in place from memory-mapped file " << fileName);
+    } else {
+      ATH_MSG_INFO("Unable to map " << fileName << ", reading events through the DataReader");
+    }
+  }
   return std::make_pair(m_reader->eventsInFile(), m_reader->GUID());
 }
 
@@ -571,12 +614,38 @@ ByteStreamEventStorageInputSvc::readerReady()
     return false;
   }
 
+  if (m_mappedFile) {
+    // the DataReader does not move when reading from the mapping
+    return m_evtInFile + 1 < m_evtOffsets.size() || m_mappedFile->hasEvent(m_mappedPosition);
+  }
+
   bool moreEvent = m_reader->good();
 
   return (!eofFlag) && moreEvent;
 }
 
 
+/******************************************************************************/
+long long int
+ByteStreamEventStorageInputSvc::getMappedData(EventCache* cache, uint32_t& eventSize, long long int offset)
+{
+  long long int nextOffset = -1;
+  const char* data = m_mappedFile->event(offset, eventSize, nextOffset);
+  if (data == nullptr) {
+    ATH_MSG_ERROR("No event found at offset " << offset << " of the mapped file");
+    throw ByteStreamExceptions::readError();
+  }
+
+  // The RawEvent is built directly on the read-only mapped pages
+  m_mappedFile->acquire(offset);
+  cache->data        = const_cast<char*>(data);
+  cache->mappedData  = true;
+  cache->mappedFile  = m_mappedFile;
+  cache->eventOffset = offset;
+  return nextOffset;
+}
+
+
 /******************************************************************************/
 bool
 ByteStreamEventStorageInputSvc::ROBFragmentCheck(const RawEvent* re) const
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef BYTESTREAMEVENTSTORAGEINPUTSVC_H
@@ -16,6 +16,7 @@
 #include "ByteStreamCnvSvcBase/IROBDataProviderSvc.h"
 #include "ByteStreamData/RawEvent.h"
 #include "AthenaKernel/SlotSpecificObj.h"
+#include "ByteStreamMappedFile.h"
 
 // FrameWork includes
 #include "GaudiKernel/ServiceHandle.h"
@@ -77,6 +78,8 @@ private: // data
     char*                     data        = nullptr; //!< take ownership of RawEvent content
     unsigned int              eventStatus = 0;       //!< check_tree() status of the current event
     long long int             eventOffset = 0;       //!< event offset within a file, can be -1
+    bool                      mappedData  = false;   //!< data points into mappedFile, not owned
+    std::shared_ptr<ByteStreamMappedFile> mappedFile; //!< keeps the mapping alive while the event is used
     void                      releaseEvent();        //!< deletes fragments and raw event
     virtual                   ~EventCache();         //!< calls releaseEvent
   };
@@ -91,6 +94,9 @@ private: // data
   // Event back navigation info
   std::string        m_fileGUID;      //!< current file GUID
 
+  std::shared_ptr<ByteStreamMappedFile> m_mappedFile; //!< mapping of the current file, in UseMmap mode
+  long long int      m_mappedPosition;  //!< offset of the next record in the mapped file
+
 
 
 private: // properties
@@ -103,12 +109,15 @@ private: // properties
   Gaudi::Property<float>                     m_wait;
   Gaudi::Property<bool>                      m_valEvent;
   Gaudi::Property<std::string>               m_eventInfoKey;
+  Gaudi::Property<bool>                      m_useMmap;       //!< read uncompressed files in place
+  Gaudi::Property<unsigned int>              m_mmapReadAhead; //!< read-ahead window in MB
 
 
 private: // internal helper functions
   StatusCode loadMetadata    ();
   void       buildFragment   (EventCache* cache, uint32_t eventSize, bool validate) const;
   bool       readerReady     ();
+  long long int getMappedData(EventCache* cache, uint32_t& eventSize, long long int offset);
   bool       ROBFragmentCheck(const RawEvent*) const;
   unsigned   validateEvent   (const RawEvent* const rawEvent) const;
   void       setEvent        (const EventContext& context, void* data, unsigned int eventStatus);
@@ -0,0 +1,150 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "ByteStreamMappedFile.h"
+
+#include "eformat/HeaderMarker.h"
+#include "EventStorage/EventStorageRecords.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+  /// Header marker of ROS fragments, also accepted as events
+  constexpr uint32_t rosMarker = 0xcc1234cc;
+
+  std::size_t pageFloor(std::size_t offset) {
+    static const std::size_t pageSize = ::sysconf(_SC_PAGESIZE);
+    return offset - offset % pageSize;
+  }
+}
+
+
+/******************************************************************************/
+std::shared_ptr<ByteStreamMappedFile>
+ByteStreamMappedFile::open(const std::string& fileName, std::size_t readAhead)
+{
+  const int fd = ::open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) return nullptr;
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+    ::close(fd);
+    return nullptr;
+  }
+  const std::size_t size = st.st_size;
+  void* base = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping keeps its own reference to the file
+  ::close(fd);
+  if (base == MAP_FAILED) return nullptr;
+  ::madvise(base, size, MADV_SEQUENTIAL);
+  return std::shared_ptr<ByteStreamMappedFile>(
+      new ByteStreamMappedFile(static_cast<const char*>(base), size, readAhead));
+}
+
+
+/******************************************************************************/
+ByteStreamMappedFile::ByteStreamMappedFile(const char* base, std::size_t size, std::size_t readAhead)
+  : m_base(base)
+  , m_size(size)
+  , m_readAhead(readAhead)
+{}
+
+
+/******************************************************************************/
+ByteStreamMappedFile::~ByteStreamMappedFile()
+{
+  ::munmap(const_cast<char*>(m_base), m_size);
+}
+
+
+/******************************************************************************/
+const char*
+ByteStreamMappedFile::locate(long long int offset, uint32_t& eventSize, long long int& nextOffset) const
+{
+  if (offset < 0 || static_cast<std::size_t>(offset) >= m_size) return nullptr;
+
+  // Each event is preceded by an EventStorage data separator record, giving the
+  // record size in words and the size in bytes of the event written after it
+  EventStorage::data_separator_record separator;
+  if (offset + sizeof(separator) > m_size) return nullptr;
+  std::memcpy(&separator, m_base + offset, sizeof(separator));
+  if (separator.marker != EVENT_RECORD_MARKER) return nullptr;
+  if (separator.record_size < sizeof(separator) / sizeof(uint32_t)) return nullptr;
+
+  const std::size_t begin = offset + static_cast<std::size_t>(separator.record_size) * sizeof(uint32_t);
+  const std::size_t end = begin + separator.data_block_size;
+  if (separator.data_block_size < 2 * sizeof(uint32_t) || end > m_size) return nullptr;
+
+  // the block must be a complete fragment: header marker, then its total size in words
+  uint32_t header[2];
+  std::memcpy(header, m_base + begin, sizeof(header));
+  if (header[0] != eformat::FULL_EVENT && header[0] != rosMarker) return nullptr;
+  if (static_cast<std::size_t>(header[1]) * sizeof(uint32_t) != separator.data_block_size) return nullptr;
+
+  eventSize = separator.data_block_size;
+  nextOffset = end;
+  return m_base + begin;
+}
+
+
+/******************************************************************************/
+bool
+ByteStreamMappedFile::hasEvent(long long int offset) const
+{
+  uint32_t eventSize = 0;
+  long long int nextOffset = 0;
+  return locate(offset, eventSize, nextOffset) != nullptr;
+}
+
+
+/******************************************************************************/
+const char*
+ByteStreamMappedFile::event(long long int offset, uint32_t& eventSize, long long int& nextOffset)
+{
+  const char* data = locate(offset, eventSize, nextOffset);
+  if (data == nullptr) return nullptr;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const std::size_t end = nextOffset;
+  m_readPosition = end;
+  if (m_readAhead > 0 && end < m_size) {
+    const std::size_t ahead = pageFloor(end);
+    ::madvise(const_cast<char*>(m_base + ahead), std::min(m_readAhead, m_size - ahead), MADV_WILLNEED);
+  }
+  return data;
+}
+
+
+/******************************************************************************/
+void
+ByteStreamMappedFile::acquire(long long int offset)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_inUse.insert(offset);
+}
+
+
+/******************************************************************************/
+void
+ByteStreamMappedFile::release(long long int offset)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_inUse.find(offset);
+  if (it != m_inUse.end()) m_inUse.erase(it);
+
+  // nothing before the oldest event still held, or before the read position, is needed any more
+  std::size_t needed = m_readPosition;
+  if (!m_inUse.empty()) {
+    needed = std::min(needed, static_cast<std::size_t>(*m_inUse.begin()));
+  }
+  needed = pageFloor(needed);
+  if (needed > m_released) {
+    ::madvise(const_cast<char*>(m_base + m_released), needed - m_released, MADV_DONTNEED);
+    m_released = needed;
+  }
+}
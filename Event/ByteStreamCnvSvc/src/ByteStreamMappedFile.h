@@ -0,0 +1,76 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef BYTESTREAMCNVSVC_BYTESTREAMMAPPEDFILE_H
+#define BYTESTREAMCNVSVC_BYTESTREAMMAPPEDFILE_H
+
+/** @file ByteStreamMappedFile.h
+ *  @brief This file contains the class definition for the ByteStreamMappedFile class.
+ **/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+
+/** @class ByteStreamMappedFile
+ *  @brief Read-only memory mapping of an uncompressed ByteStream input file.
+ *
+ *  Events are used in place, the RawEvent pointing directly into the mapping.
+ *  The pages ahead of the read position are requested with madvise, and the pages
+ *  behind all the events still held by an event slot are released.
+ *  The file is unmapped when the last event using it is released.
+ **/
+class ByteStreamMappedFile
+{
+public:
+  /// Map @c fileName, returns nullptr if the file can not be mapped
+  /// @param readAhead [IN] number of bytes to request ahead of the read position
+  static std::shared_ptr<ByteStreamMappedFile> open(const std::string& fileName, std::size_t readAhead);
+
+  ~ByteStreamMappedFile();
+
+  ByteStreamMappedFile(const ByteStreamMappedFile&) = delete;
+  ByteStreamMappedFile& operator=(const ByteStreamMappedFile&) = delete;
+
+  /// Size of the mapped file in bytes
+  std::size_t size() const { return m_size; }
+
+  /// Locate the event record starting at @c offset
+  /// @param offset     [IN]  file offset of the record, as given by the EventStorage DataReader
+  /// @param eventSize  [OUT] size of the event fragment in bytes
+  /// @param nextOffset [OUT] file offset of the next record
+  /// @return pointer to the event fragment, nullptr if there is no event at @c offset
+  const char* event(long long int offset, uint32_t& eventSize, long long int& nextOffset);
+
+  /// Check whether there is a complete event record starting at @c offset
+  bool hasEvent(long long int offset) const;
+
+  /// Mark the event at @c offset as held by an event slot
+  void acquire(long long int offset);
+
+  /// Mark the event at @c offset as no longer held, release the pages no event needs any more
+  void release(long long int offset);
+
+private:
+  ByteStreamMappedFile(const char* base, std::size_t size, std::size_t readAhead);
+
+  const char* locate(long long int offset, uint32_t& eventSize, long long int& nextOffset) const;
+
+  const char*   m_base;
+  std::size_t   m_size;
+  std::size_t   m_readAhead;
+  /// position following the last event read
+  std::size_t   m_readPosition = 0;
+  /// pages below this offset have been released
+  std::size_t   m_released = 0;
+  /// offsets of the events held by event slots
+  std::multiset<long long int> m_inUse;
+  std::mutex    m_mutex;
+};
+
+#endif // BYTESTREAMCNVSVC_BYTESTREAMMAPPEDFILE_H
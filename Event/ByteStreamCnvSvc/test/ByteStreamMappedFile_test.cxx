@@ -0,0 +1,156 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/** Tests for ByteStreamMappedFile.
+ *
+ * A small file is written with the EventStorage layout: a start record,
+ * several events each preceded by its data separator record, and an end
+ * record.  The events are then located in the mapping.
+ *
+ * @date Oct, 2026
+ */
+
+#include "../src/ByteStreamMappedFile.h"
+
+#include "eformat/HeaderMarker.h"
+#include "EventStorage/EventStorageRecords.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+
+namespace {
+
+  /// Full event fragment of @c nWords words, the payload words derived from @c seed
+  std::vector<uint32_t> makeEvent(uint32_t nWords, uint32_t seed) {
+    std::vector<uint32_t> event(nWords);
+    event[0] = eformat::FULL_EVENT;
+    event[1] = nWords;
+    event[2] = 3;
+    for (uint32_t i = 3; i < nWords; ++i) event[i] = seed * 1000 + i;
+    return event;
+  }
+
+  /// Data separator record, with @c extraWords words following the standard record
+  std::vector<uint32_t> makeSeparator(uint32_t blockNumber, uint32_t blockSize, uint32_t extraWords = 0) {
+    EventStorage::data_separator_record record;
+    record.marker = EVENT_RECORD_MARKER;
+    record.record_size = sizeof(record) / sizeof(uint32_t) + extraWords;
+    record.data_block_number = blockNumber;
+    record.data_block_size = blockSize;
+    std::vector<uint32_t> words(record.record_size, 0);
+    std::memcpy(words.data(), &record, sizeof(record));
+    return words;
+  }
+
+  class ByteStreamMappedFileTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+      m_fileName = "ByteStreamMappedFile_test." + std::to_string(::getpid()) + ".data";
+
+      // file start record, not an event
+      std::vector<uint32_t> words = {0x1234aaaa, 4, 5, 0};
+      // up to several pages
+      const std::vector<uint32_t> sizes = {17, 40, 5000, 12};
+      for (std::size_t i = 0; i < sizes.size(); ++i) {
+        const std::vector<uint32_t> event = makeEvent(sizes[i], i + 1);
+        // the third event has a separator record longer than the standard one
+        const std::vector<uint32_t> separator = makeSeparator(i + 1, sizes[i] * sizeof(uint32_t), i == 2 ? 20 : 0);
+        m_offsets.push_back(words.size() * sizeof(uint32_t));
+        words.insert(words.end(), separator.begin(), separator.end());
+        words.insert(words.end(), event.begin(), event.end());
+        m_events.push_back(event);
+      }
+      m_endOffset = words.size() * sizeof(uint32_t);
+      // file end record
+      words.insert(words.end(), {0x1234dddd, 10, 0, 0, 4, 0, 4, 0, 1, 0});
+
+      std::ofstream out(m_fileName, std::ios::binary);
+      out.write(reinterpret_cast<const char*>(words.data()), words.size() * sizeof(uint32_t));
+    }
+
+    void TearDown() override {
+      std::remove(m_fileName.c_str());
+    }
+
+    std::string m_fileName;
+    std::vector<long long int> m_offsets;
+    std::vector<std::vector<uint32_t> > m_events;
+    long long int m_endOffset = 0;
+  };
+
+} // anonymous namespace
+
+
+TEST_F(ByteStreamMappedFileTest, readEvents) {
+  std::shared_ptr<ByteStreamMappedFile> file = ByteStreamMappedFile::open(m_fileName, 4096);
+  ASSERT_TRUE(file);
+
+  // read sequentially, each event giving the position of the next one
+  long long int offset = m_offsets.front();
+  for (std::size_t i = 0; i < m_events.size(); ++i) {
+    EXPECT_EQ(offset, m_offsets[i]);
+    ASSERT_TRUE(file->hasEvent(offset));
+    uint32_t eventSize = 0;
+    long long int nextOffset = -1;
+    const char* data = file->event(offset, eventSize, nextOffset);
+    ASSERT_NE(data, nullptr);
+    ASSERT_EQ(eventSize, m_events[i].size() * sizeof(uint32_t));
+    EXPECT_EQ(std::memcmp(data, m_events[i].data(), eventSize), 0);
+    file->acquire(offset);
+    if (i > 0) file->release(m_offsets[i - 1]);
+    offset = nextOffset;
+  }
+  file->release(m_offsets.back());
+
+  // no more events: the end record follows
+  EXPECT_EQ(offset, m_endOffset);
+  EXPECT_FALSE(file->hasEvent(offset));
+  uint32_t eventSize = 0;
+  long long int nextOffset = -1;
+  EXPECT_EQ(file->event(offset, eventSize, nextOffset), nullptr);
+}
+
+
+TEST_F(ByteStreamMappedFileTest, noEvent) {
+  std::shared_ptr<ByteStreamMappedFile> file = ByteStreamMappedFile::open(m_fileName, 0);
+  ASSERT_TRUE(file);
+
+  // the start record, the middle of a record, and positions outside the file
+  EXPECT_FALSE(file->hasEvent(0));
+  EXPECT_FALSE(file->hasEvent(m_offsets[1] + sizeof(uint32_t)));
+  EXPECT_FALSE(file->hasEvent(-1));
+  EXPECT_FALSE(file->hasEvent(file->size()));
+
+  // an event cut by the end of the file
+  file.reset();
+  {
+    std::ifstream in(m_fileName, std::ios::binary);
+    std::vector<char> content(m_offsets.back() + 6 * sizeof(uint32_t));
+    in.read(content.data(), content.size());
+    std::ofstream out(m_fileName, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), content.size());
+  }
+  std::shared_ptr<ByteStreamMappedFile> truncated = ByteStreamMappedFile::open(m_fileName, 0);
+  ASSERT_TRUE(truncated);
+  EXPECT_TRUE(truncated->hasEvent(m_offsets[2]));
+  EXPECT_FALSE(truncated->hasEvent(m_offsets.back()));
+}
+
+
+TEST_F(ByteStreamMappedFileTest, missingFile) {
+  EXPECT_FALSE(ByteStreamMappedFile::open(m_fileName + ".missing", 0));
+}
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef IROBDATAPROVIDERSVC_H
@@ -8,7 +8,9 @@
 #include "GaudiKernel/IInterface.h"
 #include "ByteStreamData/RawEvent.h"
 #include "GaudiKernel/EventContext.h"
+#include "eformat/SourceIdentifier.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -30,7 +32,7 @@ public:
 
    /// Retrieve interface ID
   //   static const InterfaceID& interfaceID() { return IID_IROBDataProviderSvc; }
-  DeclareInterfaceID(IROBDataProviderSvc, 1, 1);
+  DeclareInterfaceID(IROBDataProviderSvc, 1, 2);
 
    /// Add ROBFragments to cache for given ROB ids, ROB fragments may be retrieved with DataCollector
    virtual void addROBData(const std::vector<uint32_t>& robIds, const std::string_view callerName="UNKNOWN") = 0 ;
@@ -109,6 +111,41 @@ public:
     return 0;
   }
 
+  /// @brief Declare up front the ROBs needed by a set of RoIs and prefetch them with one request
+  /// The ROB id lists of the RoIs are merged and duplicates removed before a single call to addROBData,
+  /// so that online the ROBs shared by overlapping RoIs are reserved only once.
+  virtual void prefetchROBData(const EventContext& context, const std::vector<std::vector<uint32_t>>& robIdsPerRoI,
+                               const std::string_view callerName="UNKNOWN") {
+    std::vector<uint32_t> robIds;
+    for (const std::vector<uint32_t>& ids : robIdsPerRoI) robIds.insert(robIds.end(), ids.begin(), ids.end());
+    std::sort(robIds.begin(), robIds.end());
+    robIds.erase(std::unique(robIds.begin(), robIds.end()), robIds.end());
+    if (!robIds.empty()) addROBData(context, robIds, callerName);
+  }
+
+  /// @brief Retrieve the ROBFragments for given ROB ids in one request and hand them over per sub-detector
+  /// @c fn is called once for each sub-detector with all the found ROBs of this sub-detector, so that a
+  /// decoder can process them in a single pass instead of looking up and decoding the ROBs one by one.
+  /// Example: svc->getROBDataBySubDetector(ctx, ids, [&](eformat::SubDetector det, const VROBFRAG& robs){ decode(det, robs); })
+  virtual void getROBDataBySubDetector(const EventContext& context, const std::vector<uint32_t>& robIds,
+                                       const std::function< void(eformat::SubDetector, const VROBFRAG&)>& fn,
+                                       const std::string_view callerName="UNKNOWN") {
+    VROBFRAG robFragments;
+    getROBData(context, robIds, robFragments, callerName);
+    auto subDet = [](const ROBF* rob) {
+      return eformat::helper::SourceIdentifier(rob->source_id()).subdetector_id();
+    };
+    std::stable_sort(robFragments.begin(), robFragments.end(),
+                     [&subDet](const ROBF* a, const ROBF* b) { return subDet(a) < subDet(b); });
+    VROBFRAG group;
+    for (auto it = robFragments.begin(); it != robFragments.end(); ) {
+      const eformat::SubDetector det = subDet(*it);
+      group.clear();
+      for (; it != robFragments.end() && subDet(*it) == det; ++it) group.push_back(*it);
+      fn(det, group);
+    }
+  }
+
 };
 
 #endif
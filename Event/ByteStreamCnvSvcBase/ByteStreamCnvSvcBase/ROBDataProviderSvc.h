@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef BYTESTREAMCNVSVCBASE_ROBDATAPROVIDERSVC_H
@@ -84,6 +84,10 @@ public:
    virtual bool isEventComplete(const EventContext& /*context*/) const override { return true; }
    virtual int collectCompleteEventData(const EventContext& /*context*/, const std::string_view /*callerName*/ ) override {  return 0; }
 
+   /// Offline all ROBs are in the cache already: nothing is fetched
+   virtual void prefetchROBData(const EventContext& context, const std::vector<std::vector<uint32_t>>& robIdsPerRoI,
+                                const std::string_view callerName="UNKNOWN") override;
+
 protected:
    /// vector of ROBFragment class
    //typedef std::vector<ROBF*> VROBF;
@@ -114,6 +118,8 @@ protected:
    FilterSubDetMap       m_filterSubDetMap;
    /// method to filter ROBs with given Status code
    bool filterRobWithStatus(const ROBF* rob);
+   /// ROB id used as key of the ROB map, with the Run 1 L2/EF module ID masked off
+   uint32_t robIdForMap(uint32_t id);
 
    /// Filter out empty ROB fragments which are send by the ROS
    BooleanProperty m_filterEmptyROB;
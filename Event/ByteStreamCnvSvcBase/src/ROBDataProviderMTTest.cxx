@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 #include <algorithm>
 #include "Gaudi/Property.h"
@@ -96,6 +96,25 @@ StatusCode ROBDataProviderMTTest::execute( const EventContext& context ) const
 					    ATH_MSG_DEBUG( "rob in the cache " << rob->rob_source_id() ); } 
 					);
 
+  // the grouped retrieval should return the same ROBs as getROBData, each in the group of its sub-detector
+  std::vector<uint32_t> robIds;
+  for ( const auto& rob: robs ) robIds.push_back( rob.rob_source_id() );
+  std::vector<std::vector<uint32_t>> robIdsPerRoI{ robIds, robIds };
+  m_robDataProvider->prefetchROBData( context, robIdsPerRoI, name() );
+  size_t grouped = 0;
+  bool consistent = true;
+  m_robDataProvider->getROBDataBySubDetector( context, robIds,
+					      [&]( eformat::SubDetector det, const IROBDataProviderSvc::VROBFRAG& group ){
+						for ( const auto* rob: group ) {
+						  if ( eformat::helper::SourceIdentifier( rob->source_id() ).subdetector_id() != det ) consistent = false;
+						}
+						grouped += group.size(); },
+					      name() );
+  IROBDataProviderSvc::VROBFRAG all;
+  m_robDataProvider->getROBData( context, robIds, all, name() );
+  if ( !consistent || grouped != all.size() ) 
+    ATH_MSG_ERROR( "Grouped ROB retrieval returned " << grouped << " ROBs instead of " << all.size() );
+
   
 
   return StatusCode::SUCCESS;
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //===================================================================
@@ -158,19 +158,7 @@ void ROBDataProviderSvc::addROBData(const EventContext& context, const std::vect
    // if not issue error
    for (uint32_t id : robIds) {
       // mask off the module ID for L2 and EF result for Run 1 data
-      if ( (eformat::helper::SourceIdentifier(id).module_id() != 0) &&
-	   (eformat::helper::SourceIdentifier(id).subdetector_id() == eformat::TDAQ_LVL2) ) {
-	 id = eformat::helper::SourceIdentifier(eformat::helper::SourceIdentifier(id).subdetector_id(),0).code();
-	 // TB if it is inconsistent we should not continue like this?
-	 if ( !m_maskL2EFModuleID ) {
-	   ATH_MSG_ERROR("Inconsistent flag for masking L2/EF module IDs");
-	   m_maskL2EFModuleID=true;
-	 }
-      } else if ( (eformat::helper::SourceIdentifier(id).module_id() != 0) && 
-		  (eformat::helper::SourceIdentifier(id).subdetector_id() == eformat::TDAQ_EVENT_FILTER) &&
-		  ( m_maskL2EFModuleID ) ) {
-	 id = eformat::helper::SourceIdentifier(eformat::helper::SourceIdentifier(id).subdetector_id(),0).code();
-      }
+      id = robIdForMap(id);
       ROBMAP& robmap( cache->robmap );
       ROBMAP::iterator map_it = robmap.find(id) ;
       if (map_it != robmap.end()) {
@@ -184,6 +172,13 @@ void ROBDataProviderSvc::addROBData(const EventContext& context, const std::vect
   }
   return;
 }
+/** - in offline all ROBs of the event are already in the cache, there is nothing to fetch
+*/
+void ROBDataProviderSvc::prefetchROBData(const EventContext& /*context*/, const std::vector<std::vector<uint32_t>>& robIdsPerRoI,
+                                         const std::string_view callerName) {
+   ATH_MSG_DEBUG(" ---> Number of RoIs with ROB Ids to prefetch : " << robIdsPerRoI.size() << ", Caller Name = " << callerName);
+}
+
 /** - this is the online method to add the LVL1/LVL2 result
     - this version of ROBDataProviderSvc does not support it
     - this version is for offline use only
@@ -246,18 +241,7 @@ void ROBDataProviderSvc::setNextEvent( const EventContext& context, const RawEve
       std::unique_ptr<const ROBF> rob=std::make_unique<const ROBF>(robF[irob]);
       uint32_t id =  rob->source_id();
       // mask off the module ID for L2 and EF result for Run 1 data
-      if ( (eformat::helper::SourceIdentifier(id).module_id() != 0) &&
-	   (eformat::helper::SourceIdentifier(id).subdetector_id() == eformat::TDAQ_LVL2) ) {
-	 id = eformat::helper::SourceIdentifier(eformat::helper::SourceIdentifier(id).subdetector_id(),0).code();
-	 if (!m_maskL2EFModuleID) {
-	   ATH_MSG_ERROR("Inconsistent flag for masking L2/EF module IDs");
-	   m_maskL2EFModuleID=true;
-	 }
-      } else if ( (eformat::helper::SourceIdentifier(id).module_id() != 0) && 
-		  (eformat::helper::SourceIdentifier(id).subdetector_id() == eformat::TDAQ_EVENT_FILTER) &&
-		  (m_maskL2EFModuleID) ) {
-	 id = eformat::helper::SourceIdentifier(eformat::helper::SourceIdentifier(id).subdetector_id(),0).code();
-      }
+      id = robIdForMap(id);
       if (filterRobWithStatus(rob.get())) {
          if (rob->nstatus() > 0) {
             const uint32_t* it_status;
@@ -299,20 +283,10 @@ void ROBDataProviderSvc::getROBData(const EventContext& context, const std::vect
 				    const std::string_view callerName) {
   EventCache* cache = m_eventsCache.get( context );
 
+   v.reserve(v.size() + ids.size());
    for (uint32_t id : ids) {
       // mask off the module ID for L2 and EF result for Run 1 data
-      if ( (eformat::helper::SourceIdentifier(id).module_id() != 0) &&
-	   (eformat::helper::SourceIdentifier(id).subdetector_id() == eformat::TDAQ_LVL2) ) {
-	 id = eformat::helper::SourceIdentifier(eformat::helper::SourceIdentifier(id).subdetector_id(),0).code();
-	 if (!m_maskL2EFModuleID) {
-	   ATH_MSG_ERROR("Inconsistent flag for masking L2/EF module IDs");
-	   m_maskL2EFModuleID=true;
-	 }
-      } else if ( (eformat::helper::SourceIdentifier(id).module_id() != 0) && 
-		  (eformat::helper::SourceIdentifier(id).subdetector_id() == eformat::TDAQ_EVENT_FILTER) &&
-		  (m_maskL2EFModuleID) ) {
-	 id = eformat::helper::SourceIdentifier(eformat::helper::SourceIdentifier(id).subdetector_id(),0).code();
-      }
+      id = robIdForMap(id);
       ROBMAP::iterator map_it = cache->robmap.find(id);
       if (map_it != cache->robmap.end()) {
          v.push_back((*map_it).second.get());
@@ -377,6 +351,28 @@ void ROBDataProviderSvc::processCachedROBs(const EventContext& context,
 
 
 
+/** - mask off the module ID of the L2 and EF results for Run 1 data,
+      the source identifier is decoded only once per ROB id
+*/
+uint32_t ROBDataProviderSvc::robIdForMap(uint32_t id) {
+   const eformat::helper::SourceIdentifier sid(id);
+   if (sid.module_id() == 0) {
+      return(id);
+   }
+   if (sid.subdetector_id() == eformat::TDAQ_LVL2) {
+      if (!m_maskL2EFModuleID) {
+         ATH_MSG_ERROR("Inconsistent flag for masking L2/EF module IDs");
+         m_maskL2EFModuleID = true;
+      }
+      return(eformat::helper::SourceIdentifier(sid.subdetector_id(), 0).code());
+   }
+   if ((sid.subdetector_id() == eformat::TDAQ_EVENT_FILTER) && m_maskL2EFModuleID) {
+      return(eformat::helper::SourceIdentifier(sid.subdetector_id(), 0).code());
+   }
+   return(id);
+}
+
+
 /** - filter ROB with Sub Detector Id and Status Code
 */
 bool ROBDataProviderSvc::filterRobWithStatus(const ROBF* rob) {
@@ -0,0 +1,153 @@
+///////////////////////// -*- C++ -*- /////////////////////////////
+
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+// xAODP4VecHelpers.h
+// Header file for vectorized P4 helper functions
+///////////////////////////////////////////////////////////////////
+#ifndef FOURMOMUTILS_XAODP4VECHELPERS_H
+#define FOURMOMUTILS_XAODP4VECHELPERS_H
+
+/**
+   P4VecHelpers provides vectorized versions of the kinematic helpers of
+xAOD::P4Helpers, working on @c CxxUtils::vec types holding the kinematics
+of several objects, one per lane.  The inputs are typically tiles
+obtained from an @c SG::MultiConstAccessor.
+
+   To compare one object with many, broadcast its kinematics to a vector
+first with @c CxxUtils::vbroadcast.
+
+   The azimuthal angles given to these functions are expected to be within
+@f$ [-\pi,\pi] @f$, as they are for all xAOD objects.
+ */
+
+
+// STL includes
+#include <cmath>
+#include <cstddef>
+
+// CxxUtils includes
+#include "CxxUtils/vec.h"
+
+
+namespace xAOD
+{
+  namespace P4VecHelpers
+  {
+    /// Apply a scalar function to every lane of a vector
+    template< class VEC, class FUNC >
+    inline
+    VEC apply( const VEC& x, FUNC f )
+    {
+      VEC result = x;
+      for( std::size_t i = 0; i < CxxUtils::vec_size< VEC >(); ++i ) {
+        result[i] = f( x[i] );
+      }
+      return result;
+    }
+
+    /// delta Phi in range [-pi,pi], for phi values in range [-pi,pi]
+    template< class VEC >
+    inline
+    VEC deltaPhi( const VEC& phiA, const VEC& phiB )
+    {
+      using T = CxxUtils::vec_type_t< VEC >;
+      VEC pi, twoPi;
+      CxxUtils::vbroadcast( pi, static_cast< T >( M_PI ) );
+      CxxUtils::vbroadcast( twoPi, static_cast< T >( 2 * M_PI ) );
+      VEC dphi = phiA - phiB;
+      CxxUtils::vselect( dphi, dphi - twoPi, dphi, dphi > pi );
+      CxxUtils::vselect( dphi, dphi + twoPi, dphi, dphi < -pi );
+      return dphi;
+    }
+
+    /// @f$ \Delta{R}^2 @f$ from bare eta (or rapidity), phi
+    template< class VEC >
+    inline
+    VEC deltaR2( const VEC& etaA, const VEC& phiA,
+                 const VEC& etaB, const VEC& phiB )
+    {
+      const VEC deta = etaA - etaB;
+      const VEC dphi = deltaPhi( phiA, phiB );
+      return deta * deta + dphi * dphi;
+    }
+
+    /// @f$ \Delta{R} @f$ from bare eta (or rapidity), phi
+    template< class VEC >
+    inline
+    VEC deltaR( const VEC& etaA, const VEC& phiA,
+                const VEC& etaB, const VEC& phiB )
+    {
+      using T = CxxUtils::vec_type_t< VEC >;
+      return apply( deltaR2( etaA, phiA, etaB, phiB ),
+                    []( T x ) { return std::sqrt( x ); } );
+    }
+
+    /// Check which pairs are within a @f$ \Delta{R} @f$ cone
+    /// @param dR [in] cone size(s) to use for each lane
+    /// @return mask, true for the lanes where the objects overlap
+    template< class VEC >
+    inline
+    CxxUtils::vec_mask_type_t< VEC >
+    isInDeltaR( const VEC& etaA, const VEC& phiA,
+                const VEC& etaB, const VEC& phiB, const VEC& dR )
+    {
+      return deltaR2( etaA, phiA, etaB, phiB ) < dR * dR;
+    }
+
+    /// Size of a sliding @f$ \Delta{R} @f$ cone, as used for the overlap
+    /// removal of leptons and jets: @f$ \min(c + k/p_T, R_{max}) @f$
+    template< class VEC >
+    inline
+    VEC slidingDeltaR( const VEC& pt,
+                       CxxUtils::vec_type_t< VEC > c,
+                       CxxUtils::vec_type_t< VEC > k,
+                       CxxUtils::vec_type_t< VEC > rMax )
+    {
+      VEC vc, vk, vmax;
+      CxxUtils::vbroadcast( vc, c );
+      CxxUtils::vbroadcast( vk, k );
+      CxxUtils::vbroadcast( vmax, rMax );
+      VEC dR = vc + vk / pt;
+      CxxUtils::vmin( dR, dR, vmax );
+      return dR;
+    }
+
+    /// Invariant mass of pairs of objects given by pt, eta, phi, m
+    template< class VEC >
+    inline
+    VEC invariantMass( const VEC& ptA, const VEC& etaA,
+                       const VEC& phiA, const VEC& mA,
+                       const VEC& ptB, const VEC& etaB,
+                       const VEC& phiB, const VEC& mB )
+    {
+      using T = CxxUtils::vec_type_t< VEC >;
+      // Transverse and longitudinal momentum components:
+      const VEC pxA = ptA * apply( phiA, []( T x ) { return std::cos( x ); } );
+      const VEC pyA = ptA * apply( phiA, []( T x ) { return std::sin( x ); } );
+      const VEC pzA = ptA * apply( etaA, []( T x ) { return std::sinh( x ); } );
+      const VEC pxB = ptB * apply( phiB, []( T x ) { return std::cos( x ); } );
+      const VEC pyB = ptB * apply( phiB, []( T x ) { return std::sin( x ); } );
+      const VEC pzB = ptB * apply( etaB, []( T x ) { return std::sinh( x ); } );
+      // Energies:
+      auto laneSqrt = []( T x ) { return std::sqrt( x ); };
+      const VEC eA = apply( ptA * ptA + pzA * pzA + mA * mA, laneSqrt );
+      const VEC eB = apply( ptB * ptB + pzB * pzB + mB * mB, laneSqrt );
+      // Mass of the sum:
+      const VEC e = eA + eB;
+      const VEC px = pxA + pxB;
+      const VEC py = pyA + pyB;
+      const VEC pz = pzA + pzB;
+      VEC m2 = e * e - px * px - py * py - pz * pz;
+      VEC zero;
+      CxxUtils::vbroadcast( zero, static_cast< T >( 0 ) );
+      CxxUtils::vmax( m2, m2, zero );
+      return apply( m2, laneSqrt );
+    }
+
+  } // namespace P4VecHelpers
+} // namespace xAOD
+
+#endif // FOURMOMUTILS_XAODP4VECHELPERS_H
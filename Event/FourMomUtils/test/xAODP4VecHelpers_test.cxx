@@ -0,0 +1,157 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file FourMomUtils/test/xAODP4VecHelpers_test.cxx
+ * @date Oct, 2026
+ * @brief Compare the vectorized helpers of xAODP4VecHelpers.h with the
+ *        scalar xAOD::P4Helpers on random kinematics.
+ */
+
+
+#undef NDEBUG
+#include "FourMomUtils/xAODP4VecHelpers.h"
+#include "FourMomUtils/xAODP4Helpers.h"
+#include "TestTools/random.h"
+#include "TLorentzVector.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+
+namespace {
+
+
+constexpr int nTrials = 1000;
+
+
+/// Random kinematics for the lanes of two vectors of objects
+template <class VEC>
+struct Pairs
+{
+  VEC ptA, etaA, phiA, mA;
+  VEC ptB, etaB, phiB, mB;
+
+  explicit Pairs (uint32_t& seed)
+  {
+    for (size_t i = 0; i < CxxUtils::vec_size<VEC>(); i++) {
+      ptA[i] = Athena_test::randf_seed (seed, 500, 5);
+      etaA[i] = Athena_test::randf_seed (seed, 2.5, -2.5);
+      phiA[i] = Athena_test::randf_seed (seed, M_PI, -M_PI);
+      mA[i] = Athena_test::randf_seed (seed, 50, 0);
+      ptB[i] = Athena_test::randf_seed (seed, 500, 5);
+      etaB[i] = Athena_test::randf_seed (seed, 2.5, -2.5);
+      // Half of the pairs close to each other, for the overlap checks
+      phiB[i] = i % 2 ? Athena_test::randf_seed (seed, M_PI, -M_PI)
+                      : phiA[i] + Athena_test::randf_seed (seed, 0.5, -0.5);
+      phiB[i] = -std::remainder (-phiB[i], 2*M_PI);
+      if (i % 2 == 0) etaB[i] = etaA[i] + Athena_test::randf_seed (seed, 0.5, -0.5);
+      mB[i] = Athena_test::randf_seed (seed, 50, 0);
+    }
+  }
+};
+
+
+/// Difference of two angles, modulo 2pi
+double angleDiff (double a, double b)
+{
+  return std::abs (std::remainder (a - b, 2*M_PI));
+}
+
+
+template <class VEC>
+void testPairs (double tol)
+{
+  namespace V = xAOD::P4VecHelpers;
+  using T = CxxUtils::vec_type_t<VEC>;
+  constexpr size_t N = CxxUtils::vec_size<VEC>();
+
+  uint32_t seed = 1234;
+  for (int itrial = 0; itrial < nTrials; itrial++) {
+    const Pairs<VEC> p (seed);
+
+    const VEC dphi = V::deltaPhi (p.phiA, p.phiB);
+    const VEC dr2 = V::deltaR2 (p.etaA, p.phiA, p.etaB, p.phiB);
+    const VEC dr = V::deltaR (p.etaA, p.phiA, p.etaB, p.phiB);
+    VEC cone;
+    CxxUtils::vbroadcast (cone, static_cast<T> (0.4));
+    const auto inCone = V::isInDeltaR (p.etaA, p.phiA, p.etaB, p.phiB, cone);
+    const VEC mass = V::invariantMass (p.ptA, p.etaA, p.phiA, p.mA,
+                                       p.ptB, p.etaB, p.phiB, p.mB);
+
+    for (size_t i = 0; i < N; i++) {
+      const double refDphi = xAOD::P4Helpers::deltaPhi (p.phiA[i], p.phiB[i]);
+      const double refDr2 = xAOD::P4Helpers::deltaR2 (p.etaA[i], p.phiA[i], p.etaB[i], p.phiB[i]);
+      const double refDr = xAOD::P4Helpers::deltaR (p.etaA[i], p.phiA[i], p.etaB[i], p.phiB[i]);
+
+      assert (std::abs (dphi[i]) <= static_cast<T> (M_PI));
+      // Either end of the range for differences of pi
+      assert (angleDiff (dphi[i], refDphi) < tol);
+      assert (std::abs (dr2[i] - refDr2) < tol * std::max (1., refDr2));
+      assert (std::abs (dr[i] - refDr) < tol * std::max (1., refDr));
+
+      // Not checked right at the edge of the cone
+      if (std::abs (refDr2 - 0.4*0.4) > tol) {
+        assert (static_cast<bool> (inCone[i]) == (refDr2 < 0.4*0.4));
+      }
+
+      TLorentzVector a, b;
+      a.SetPtEtaPhiM (p.ptA[i], p.etaA[i], p.phiA[i], p.mA[i]);
+      b.SetPtEtaPhiM (p.ptB[i], p.etaB[i], p.phiB[i], p.mB[i]);
+      const TLorentzVector sum = a + b;
+      // m^2 = E^2 - p^2 loses precision relative to E^2
+      assert (std::abs (mass[i]*mass[i] - sum.M2()) < tol * sum.E()*sum.E());
+    }
+  }
+}
+
+
+template <class VEC>
+void testSliding (double tol)
+{
+  namespace V = xAOD::P4VecHelpers;
+  constexpr size_t N = CxxUtils::vec_size<VEC>();
+
+  uint32_t seed = 4321;
+  for (int itrial = 0; itrial < nTrials; itrial++) {
+    VEC pt;
+    for (size_t i = 0; i < N; i++) {
+      pt[i] = Athena_test::randf_seed (seed, 200, 5);
+    }
+    // Muon/jet sliding cone: 0.04 + 10 GeV/pt, at most 0.4
+    const VEC dR = V::slidingDeltaR (pt, 0.04, 10, 0.4);
+    for (size_t i = 0; i < N; i++) {
+      const double ref = std::min (0.04 + 10 / static_cast<double> (pt[i]), 0.4);
+      assert (std::abs (dR[i] - ref) < tol);
+    }
+  }
+}
+
+
+} // anonymous namespace
+
+
+void test1()
+{
+  std::cout << "test1\n";
+  testPairs<CxxUtils::vec<double, 2> > (1e-12);
+  testSliding<CxxUtils::vec<double, 2> > (1e-12);
+}
+
+
+void test2()
+{
+  std::cout << "test2\n";
+  testPairs<CxxUtils::vec<float, 4> > (1e-5);
+  testSliding<CxxUtils::vec<float, 4> > (1e-5);
+}
+
+
+int main()
+{
+  std::cout << "FourMomUtils/xAODP4VecHelpers_test\n";
+  test1();
+  test2();
+  return 0;
+}
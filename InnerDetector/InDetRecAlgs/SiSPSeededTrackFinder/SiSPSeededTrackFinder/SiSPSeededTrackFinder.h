@@ -1,7 +1,7 @@
 // -*- C++ -*-
 
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -34,11 +34,16 @@
 
 /// STL includes
 #include <atomic>
+#include <memory>
 #include <string>
+#include <vector>
 
 //class SpacePointContainer;
 namespace InDet {
 
+  class ExtendedSiTrackMakerEventData_xk;
+  struct PatternHoleSearchOutcome;
+
   /**
    * @class SiSPSeededTrackFinder
    * Class-algorithm for track finding in Pixels and SCT
@@ -100,6 +105,7 @@ namespace InDet {
     BooleanProperty m_useITkConvSeeded{this, "useITkConvSeeded", false, "ITk EM-seeded conversion reco"};
     BooleanProperty m_doFastTracking{this, "doFastTracking", false, "ITk fast tracking reco"};
     IntegerProperty m_maxNumberSeeds{this, "maxNumberSeeds", 3000000, "Max. number used seeds"};
+    IntegerProperty m_nSeedPartitions{this, "SeedPartitions", 0, "ITk only: number of phi sectors in which the seeds are processed in parallel, 0 or 1 for sequential processing"};
     IntegerProperty m_maxPIXsp{this, "maxNumberPIXsp", 150000, "Max. number pixels space points"};
     IntegerProperty m_maxSCTsp{this, "maxNumberSCTsp", 500000, "Max. number sct    space points"};
     IntegerProperty m_nfreeCut{this, "FreeClustersCut", 1, "Min number free clusters"};
@@ -229,6 +235,40 @@ namespace InDet {
 
     void magneticFieldInit();
 
+    /** \brief prepares the track maker event data of the phi sectors used for parallel track finding.
+    * @param [in] ctx event context
+    * @param [in] trig use the trigger setup of the track maker (newTrigEvent)
+    * @return one event data object per sector, none if the seeds are processed sequentially
+    **/
+    std::vector<std::unique_ptr<ExtendedSiTrackMakerEventData_xk>> newSeedPartitions(const EventContext& ctx, bool trig) const;
+
+    /** \brief track finding for all the seeds of the current seeding pass, in parallel phi sectors.
+    *
+    * The seeds are copied out of the seed maker and split by the phi of their middle space point.
+    * The seeds of each sector are processed in their original order as a TBB task, with the
+    * event data of the sector, so that the seed filter only sees the tracks of the same sector.
+    * Tracks found from seeds in different sectors are resolved later by the shared hits filter.
+    * The candidates are merged in the order of the sectors, which makes the result independent
+    * of the task scheduling and of the number of threads.
+    * @param [in] ctx event context
+    * @param [in,out] seedEventData seed maker event data, after find3Sp
+    * @param [in,out] trackEventData track maker event data of the sectors, from newSeedPartitions
+    * @param [in,out] counter event counters
+    * @param [in,out] qualitySortedTrackCandidates found track candidates, sorted by score
+    * @return true if the maximum number of seeds has been reached
+    **/
+    bool getTracksInPartitions(const EventContext& ctx,
+                               SiSpacePointsSeedMakerEventData& seedEventData,
+                               std::vector<std::unique_ptr<ExtendedSiTrackMakerEventData_xk>>& trackEventData,
+                               Counter_t& counter,
+                               std::multimap<double, Trk::Track*>& qualitySortedTrackCandidates) const;
+
+    /// looks for the pattern hole search outcome of a track in the event data of the track maker or of the sectors
+    bool findPatternHoleSearchOutcome(SiTrackMakerEventData_xk& trackEventData,
+                                      const std::vector<std::unique_ptr<ExtendedSiTrackMakerEventData_xk>>& partitionEventData,
+                                      Trk::Track* track,
+                                      PatternHoleSearchOutcome& outcome) const;
+
     bool passEtaDepCuts(const Trk::Track* track,
 			int nClusters,
 			int nFreeClusters,
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "SiSPSeededTrackFinder/SiSPSeededTrackFinder.h"
@@ -11,6 +11,13 @@
 #include "TrkRIO_OnTrack/RIO_OnTrack.h"
 #include "TrkTrackSummary/TrackSummary.h"
 
+#include "GaudiKernel/ThreadLocalContext.h"
+
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+#include <cmath>
 #include <set>
 
 namespace {
@@ -55,6 +62,19 @@ double trackQuality(const Trk::Track* Tr) {
 
   return quality;
 }
+
+/** \brief phi sector of a seed, used for the parallel track finding.
+ * @param [in] spacePoints space points of the seed, the middle one gives the phi
+ * @param [in] nSectors number of phi sectors
+ **/
+size_t phiSector(const std::vector<const Trk::SpacePoint*>& spacePoints, size_t nSectors) {
+  if (spacePoints.empty())
+    return 0;
+  const Amg::Vector3D& position = spacePoints[spacePoints.size() / 2]->globalPosition();
+  const double phi = std::atan2(position.y(), position.x());
+  const size_t sector = static_cast<size_t>((phi + M_PI) * (nSectors / (2. * M_PI)));
+  return std::min(sector, nSectors - 1);
+}
 }  // namespace
 
 ///////////////////////////////////////////////////////////////////
@@ -96,6 +116,11 @@ StatusCode InDet::SiSPSeededTrackFinder::initialize()
 
   ATH_CHECK( m_trackSummaryTool.retrieve( DisableTool{ m_trackSummaryTool.name().empty()} ));
 
+  if (m_nSeedPartitions > 1 and not m_ITKGeometry) {
+    ATH_MSG_WARNING("Parallel track finding in phi sectors is only available for ITk, seeds are processed sequentially");
+    m_nSeedPartitions = 0;
+  }
+
   if (m_useNewStrategy and m_beamSpotKey.key().empty()) {
     m_useNewStrategy = false;
     m_useZBoundaryFinding = false;
@@ -295,8 +320,10 @@ StatusCode InDet::SiSPSeededTrackFinder::newStrategy(const EventContext& ctx) co
   const bool PIX = true ;
   const bool SCT = true ;
   InDet::ExtendedSiTrackMakerEventData_xk trackEventData(m_prdToTrackMap);
-  /// set up the track maker 
-  m_trackmaker->newEvent(ctx, trackEventData, PIX, SCT);
+  /// track maker event data of the phi sectors, if the seeds are processed in parallel
+  std::vector<std::unique_ptr<InDet::ExtendedSiTrackMakerEventData_xk>> partitionEventData = newSeedPartitions(ctx, false);
+  /// set up the track maker, for the sequential processing
+  if (partitionEventData.empty()) m_trackmaker->newEvent(ctx, trackEventData, PIX, SCT);
 
   /// initialize empty histograms for the vertex estimate
   std::vector<int> numberHistogram(m_histsize, 0);
@@ -320,7 +347,10 @@ StatusCode InDet::SiSPSeededTrackFinder::newStrategy(const EventContext& ctx) co
   }
 
   /// Loop through all seeds from the first pass and attempt to form track candidates
-  while ((seed = m_seedsmaker->next(ctx, seedEventData))) {
+  if (not partitionEventData.empty()) {
+    ERR = getTracksInPartitions(ctx, seedEventData, partitionEventData, counter, qualitySortedTrackCandidates);
+  }
+  else while ((seed = m_seedsmaker->next(ctx, seedEventData))) {
 
     ++counter[kNSeeds];
     /// we only want to fill the Z histo with the first candidate for each seed. 
@@ -369,7 +399,10 @@ StatusCode InDet::SiSPSeededTrackFinder::newStrategy(const EventContext& ctx) co
   }
 
   /// Again, loop over the newly found seeds and attempt to form track candidates
-  while ((seed = m_seedsmaker->next(ctx, seedEventData))) {
+  if (not partitionEventData.empty()) {
+    if (getTracksInPartitions(ctx, seedEventData, partitionEventData, counter, qualitySortedTrackCandidates)) ERR = true;
+  }
+  else while ((seed = m_seedsmaker->next(ctx, seedEventData))) {
 
     ++counter[kNSeeds];
 
@@ -388,7 +421,10 @@ StatusCode InDet::SiSPSeededTrackFinder::newStrategy(const EventContext& ctx) co
     }
   }
 
-  m_trackmaker->endEvent(trackEventData);
+  if (partitionEventData.empty()) m_trackmaker->endEvent(trackEventData);
+  for (std::unique_ptr<InDet::ExtendedSiTrackMakerEventData_xk>& data: partitionEventData) {
+    m_trackmaker->endEvent(*data);
+  }
 
   /// Remove shared tracks with worse quality
   filterSharedTracks(qualitySortedTrackCandidates);
@@ -403,7 +439,7 @@ StatusCode InDet::SiSPSeededTrackFinder::newStrategy(const EventContext& ctx) co
                                                          false /* DO NOT suppress hole search*/);
        InDet::PatternHoleSearchOutcome theOutcome; 
        /// Check if we have a hole search result for this guy
-       if (m_writeHolesFromPattern && trackEventData.combinatorialData().findPatternHoleSearchOutcome(qualityAndTrack.second,theOutcome)){
+       if (m_writeHolesFromPattern && findPatternHoleSearchOutcome(trackEventData, partitionEventData, qualityAndTrack.second, theOutcome)){
          /// If yes: Write this information into the track summary. 
          qualityAndTrack.second->trackSummary()->update(Trk::numberOfPixelHoles, theOutcome.nPixelHoles); 
          qualityAndTrack.second->trackSummary()->update(Trk::numberOfSCTHoles, theOutcome.nSCTHoles); 
@@ -447,8 +483,10 @@ StatusCode InDet::SiSPSeededTrackFinder::itkFastTrackingStrategy(const EventCont
   const bool PIX = true ;
   const bool STRIP = true ;
   InDet::ExtendedSiTrackMakerEventData_xk trackEventData(m_prdToTrackMap);
-  /// set up the track maker
-  m_trackmaker->newTrigEvent(ctx, trackEventData, PIX, STRIP);
+  /// track maker event data of the phi sectors, if the seeds are processed in parallel
+  std::vector<std::unique_ptr<InDet::ExtendedSiTrackMakerEventData_xk>> partitionEventData = newSeedPartitions(ctx, true);
+  /// set up the track maker, for the sequential processing
+  if (partitionEventData.empty()) m_trackmaker->newTrigEvent(ctx, trackEventData, PIX, STRIP);
 
   SiSpacePointsSeedMakerEventData seedEventData;
 
@@ -484,7 +522,10 @@ StatusCode InDet::SiSPSeededTrackFinder::itkFastTrackingStrategy(const EventCont
   }
 
   /// Loop through all seeds from the first pass and attempt to form track candidates
-  while ((seed = m_seedsmaker->next(ctx, seedEventData))) {
+  if (not partitionEventData.empty()) {
+    ERR = getTracksInPartitions(ctx, seedEventData, partitionEventData, counter, qualitySortedTrackCandidates);
+  }
+  else while ((seed = m_seedsmaker->next(ctx, seedEventData))) {
 
     ++counter[kNSeeds];
 
@@ -506,7 +547,10 @@ StatusCode InDet::SiSPSeededTrackFinder::itkFastTrackingStrategy(const EventCont
     }
   }
 
-  m_trackmaker->endEvent(trackEventData);
+  if (partitionEventData.empty()) m_trackmaker->endEvent(trackEventData);
+  for (std::unique_ptr<InDet::ExtendedSiTrackMakerEventData_xk>& data: partitionEventData) {
+    m_trackmaker->endEvent(*data);
+  }
 
   /// Remove shared tracks with worse quality
   filterSharedTracksFast(qualitySortedTrackCandidates);
@@ -519,7 +563,7 @@ StatusCode InDet::SiSPSeededTrackFinder::itkFastTrackingStrategy(const EventCont
       m_trackSummaryTool->computeAndReplaceTrackSummary(*qualityAndTrack.second);
       InDet::PatternHoleSearchOutcome theOutcome;
       /// Check if we have a hole search result for this guy
-      if (m_writeHolesFromPattern && trackEventData.combinatorialData().findPatternHoleSearchOutcome(qualityAndTrack.second,theOutcome)){
+      if (m_writeHolesFromPattern && findPatternHoleSearchOutcome(trackEventData, partitionEventData, qualityAndTrack.second, theOutcome)){
         /// If yes: Write this information into the track summary.
         qualityAndTrack.second->trackSummary()->update(Trk::numberOfPixelHoles, theOutcome.nPixelHoles);
         qualityAndTrack.second->trackSummary()->update(Trk::numberOfSCTHoles, theOutcome.nSCTHoles);
@@ -696,6 +740,90 @@ StatusCode InDet::SiSPSeededTrackFinder::itkConvStrategy(const EventContext& ctx
 
 
 
+///////////////////////////////////////////////////////////////////
+// Track finding in parallel phi sectors
+///////////////////////////////////////////////////////////////////
+
+std::vector<std::unique_ptr<InDet::ExtendedSiTrackMakerEventData_xk>>
+InDet::SiSPSeededTrackFinder::newSeedPartitions(const EventContext& ctx, bool trig) const
+{
+  std::vector<std::unique_ptr<InDet::ExtendedSiTrackMakerEventData_xk>> partitionEventData;
+  /// the validation ntuple needs the seeds in their original order
+  if (m_nSeedPartitions <= 1 or m_seedsmaker->getWriteNtupleBoolProperty()) return partitionEventData;
+
+  const bool PIX = true ;
+  const bool STRIP = true ;
+  partitionEventData.reserve(m_nSeedPartitions);
+  for (int partition = 0; partition < m_nSeedPartitions; ++partition) {
+    partitionEventData.push_back(std::make_unique<InDet::ExtendedSiTrackMakerEventData_xk>(m_prdToTrackMap));
+    if (trig) m_trackmaker->newTrigEvent(ctx, *partitionEventData.back(), PIX, STRIP);
+    else      m_trackmaker->newEvent    (ctx, *partitionEventData.back(), PIX, STRIP);
+  }
+  return partitionEventData;
+}
+
+bool InDet::SiSPSeededTrackFinder::getTracksInPartitions(const EventContext& ctx,
+                                                         SiSpacePointsSeedMakerEventData& seedEventData,
+                                                         std::vector<std::unique_ptr<ExtendedSiTrackMakerEventData_xk>>& trackEventData,
+                                                         Counter_t& counter,
+                                                         std::multimap<double, Trk::Track*>& qualitySortedTrackCandidates) const
+{
+  const size_t nPartitions = trackEventData.size();
+
+  /// The space points of the seeds are copied, as the seed maker may reuse the seeds storage,
+  /// and split in phi sectors keeping their order
+  bool ERR = false;
+  std::vector<std::vector<std::vector<const Trk::SpacePoint*>>> seeds(nPartitions);
+  const InDet::SiSpacePointsSeed* seed = nullptr;
+  while ((seed = m_seedsmaker->next(ctx, seedEventData))) {
+    ++counter[kNSeeds];
+    const std::vector<const Trk::SpacePoint*>& spacePoints = seed->spacePoints();
+    seeds[phiSector(spacePoints, nPartitions)].push_back(spacePoints);
+    if (counter[kNSeeds] >= m_maxNumberSeeds) {
+      ERR = true;
+      ++m_problemsTotal;
+      break;
+    }
+  }
+
+  /// One task per sector. The tasks are isolated, so that a thread waiting for them
+  /// does not pick up work of other algorithms, and the tools called in them see
+  /// the context of this event
+  std::vector<std::vector<Trk::Track*>> tracks(nPartitions);
+  tbb::this_task_arena::isolate([&]() {
+    tbb::parallel_for(size_t(0), nPartitions, [&](size_t partition) {
+      const EventContext previousContext = Gaudi::Hive::currentContext();
+      Gaudi::Hive::setCurrentContext(ctx);
+      for (const std::vector<const Trk::SpacePoint*>& spacePoints: seeds[partition]) {
+        std::list<Trk::Track*> trackList = m_trackmaker->getTracks(ctx, *trackEventData[partition], spacePoints);
+        tracks[partition].insert(tracks[partition].end(), trackList.begin(), trackList.end());
+      }
+      Gaudi::Hive::setCurrentContext(previousContext);
+    });
+  });
+
+  /// Merge in the order of the sectors, candidates with equal scores stay in the same order in every job
+  for (const std::vector<Trk::Track*>& partitionTracks: tracks) {
+    for (Trk::Track* t: partitionTracks) {
+      qualitySortedTrackCandidates.insert(std::make_pair(-trackQuality(t), t));
+    }
+  }
+  return ERR;
+}
+
+bool InDet::SiSPSeededTrackFinder::findPatternHoleSearchOutcome(SiTrackMakerEventData_xk& trackEventData,
+                                                                const std::vector<std::unique_ptr<ExtendedSiTrackMakerEventData_xk>>& partitionEventData,
+                                                                Trk::Track* track,
+                                                                PatternHoleSearchOutcome& outcome) const
+{
+  /// the event data of the sequential processing is only used without phi sectors
+  if (partitionEventData.empty()) return trackEventData.combinatorialData().findPatternHoleSearchOutcome(track, outcome);
+  for (const std::unique_ptr<InDet::ExtendedSiTrackMakerEventData_xk>& data: partitionEventData) {
+    if (data->combinatorialData().findPatternHoleSearchOutcome(track, outcome)) return true;
+  }
+  return false;
+}
+
 ///////////////////////////////////////////////////////////////////
 // Finalize
 ///////////////////////////////////////////////////////////////////
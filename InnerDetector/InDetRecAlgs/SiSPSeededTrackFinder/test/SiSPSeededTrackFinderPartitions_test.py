@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+"""Test the parallel track finding in phi sectors of SiSPSeededTrackFinder
+
+Runs the ITk track reconstruction with the SeedPartitions property of the
+SiSPSeededTrackFinder algorithms and writes the found tracks to a text file,
+event by event.  The output with SeedPartitions > 1 must not depend on the
+number of threads: --compare checks that two such files are identical.
+
+The wall time of the job is printed; with --perfmon the time spent
+in each algorithm is also reported, to compare with SeedPartitions=0.
+
+Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+"""
+import sys
+import time
+from argparse import ArgumentParser
+
+from AthenaPython.PyAthenaComps import Alg, StatusCode
+
+
+class DumpTracks(Alg):
+    """Writes the tracks of a TrackCollection to a text file, sorted by event number"""
+    def __init__(self, name="DumpTracks", collection="SiSPSeededTracks", fileName=""):
+        Alg.__init__(self, name)
+        self.collection = collection
+        self.fileName = fileName
+        self.events = {}
+
+    def execute(self):
+        ei = self.evtStore.retrieve("xAOD::EventInfo", "EventInfo")
+        tracks = self.evtStore.retrieve("TrackCollection", self.collection)
+        lines = []
+        for track in tracks:
+            line = f"{track.measurementsOnTrack().size()} {track.fitQuality().chiSquared():.6g}"
+            perigee = track.perigeeParameters()
+            if perigee:
+                pos = perigee.position()
+                mom = perigee.momentum()
+                line += f" {pos.x():.6g} {pos.y():.6g} {pos.z():.6g} {mom.x():.6g} {mom.y():.6g} {mom.z():.6g}"
+            lines.append(line)
+        self.events[(ei.runNumber(), ei.eventNumber())] = lines
+        return StatusCode.Success
+
+    def finalize(self):
+        with open(self.fileName, "w") as f:
+            for (run, event), lines in sorted(self.events.items()):
+                f.write(f"run {run} event {event} tracks {len(lines)}\n")
+                f.write("".join(f"{line}\n" for line in lines))
+        return StatusCode.Success
+
+
+def compare(fileNames):
+    contents = []
+    for fileName in fileNames:
+        with open(fileName) as f:
+            contents.append(f.readlines())
+    nTracks = sum(not line.startswith("run ") for line in contents[0])
+    if nTracks == 0:
+        print(f"No tracks in {fileNames[0]}")
+        return 1
+    for fileName, content in zip(fileNames[1:], contents[1:]):
+        if content != contents[0]:
+            print(f"The tracks of {fileName} differ from the ones of {fileNames[0]}")
+            return 1
+    print(f"The {nTracks} tracks are identical in {' '.join(fileNames)}")
+    return 0
+
+
+parser = ArgumentParser(prog='SiSPSeededTrackFinderPartitions_test')
+parser.add_argument('--compare', nargs='+', default=[],
+                    help='Compare the track files written by previous jobs')
+parser.add_argument('-t', '--threads', default=1, type=int,
+                    help='The number of threads, for a single event in flight')
+parser.add_argument('-p', '--partitions', default=4, type=int,
+                    help='SeedPartitions of the SiSPSeededTrackFinder algorithms')
+parser.add_argument('-n', '--events', default=5, type=int,
+                    help='Number of events')
+parser.add_argument('-o', '--output', default='',
+                    help='Track file to write')
+parser.add_argument('--perfmon', default=False, action='store_true',
+                    help='Report the time spent in each algorithm')
+args = parser.parse_args()
+
+if args.compare:
+    sys.exit(compare(args.compare))
+
+from AthenaConfiguration.AllConfigFlags import initConfigFlags
+from AthenaConfiguration.TestDefaults import defaultTestFiles
+
+flags = initConfigFlags()
+flags.Detector.EnableCalo = False
+flags.Input.Files = defaultTestFiles.RDO_RUN4
+flags.Exec.MaxEvents = args.events
+# A single event in flight, so that the extra threads are only used by the sectors
+flags.Concurrency.NumThreads = args.threads
+flags.Concurrency.NumConcurrentEvents = 1 if args.threads > 0 else 0
+if args.perfmon:
+    flags.PerfMon.doFullMonMT = True
+flags.lock()
+
+from AthenaConfiguration.MainServicesConfig import MainServicesCfg
+acc = MainServicesCfg(flags)
+
+from AthenaPoolCnvSvc.PoolReadConfig import PoolReadCfg
+acc.merge(PoolReadCfg(flags))
+
+if flags.Input.isMC:
+    from xAODTruthCnv.xAODTruthCnvConfig import GEN_AOD2xAODCfg
+    acc.merge(GEN_AOD2xAODCfg(flags))
+
+from InDetConfig.ITkTrackRecoConfig import ITkTrackRecoCfg
+acc.merge(ITkTrackRecoCfg(flags))
+
+acc.foreach_component("*/InDet::SiSPSeededTrackFinder/*").SeedPartitions = args.partitions
+
+if args.perfmon:
+    from PerfMonComps.PerfMonCompsConfig import PerfMonMTSvcCfg
+    acc.merge(PerfMonMTSvcCfg(flags))
+
+output = args.output or f"SiSPSeededTracks_p{args.partitions}_t{args.threads}.txt"
+# After all the reconstruction algorithms
+acc.addEventAlgo(DumpTracks(fileName=output), sequenceName="AthEndSeq")
+
+start = time.perf_counter()
+sc = acc.run()
+print(f"Job of {args.events} events with SeedPartitions={args.partitions} "
+      f"and {args.threads} threads: {time.perf_counter() - start:.1f} s, including the initialisation")
+
+sys.exit(not sc.isSuccess())
@@ -1,7 +1,7 @@
 // -*- C++ -*-
 
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -174,6 +174,53 @@ namespace InDet {
     std::vector<std::vector<ITk::SiSpacePointForSeed*>> rfz_ITkSorted;
     std::vector<std::vector<ITk::SiSpacePointForSeed*>> rfzv_ITkSorted;
 
+    /**
+     * @name Structure-of-arrays copy of rfz_ITkSorted
+     * Used by ITk::SiSpacePointsSeedMaker, rebuilt after each filling of the phi-z bins.
+     * The space points of phi-z bin i are stored contiguously, in the order of
+     * rfz_ITkSorted[i], at the positions [rfz_ITkBegin[i], rfz_ITkBegin[i+1]) of the arrays.
+     */
+    //@{
+    std::vector<int> rfz_ITkBegin;
+    std::vector<ITk::SiSpacePointForSeed*> rfz_ITkSP;
+    std::vector<float> rfz_ITkX;
+    std::vector<float> rfz_ITkY;
+    std::vector<float> rfz_ITkZ;
+    std::vector<float> rfz_ITkR;
+    std::vector<float> rfz_ITkCovr;
+    std::vector<float> rfz_ITkCovz;
+    //@}
+
+    /**
+     * @name Link candidates of ITk::SiSpacePointsSeedMaker
+     * Results of the first compatibility cuts for the space points of one phi-z bin
+     * w.r.t. the central space point, indexed like the bin, before the accepted
+     * ones are copied into the tables for 3 space points seeds search.
+     * They are computed by blocks of ITkLinkBlockSize.
+     */
+    //@{
+    static constexpr int ITkLinkBlockSize = 16;
+    std::vector<int> ITkLinkPass;     ///< non-zero if the space point passes the cuts
+    std::vector<float> ITkLinkU;      ///< transformed U coordinate
+    std::vector<float> ITkLinkV;      ///< transformed V coordinate
+    std::vector<float> ITkLinkR2;     ///< inverse squared distance to the central space point in the transverse plane
+    std::vector<float> ITkLinkDXY;    ///< squared distance to the central space point in the transverse plane
+    std::vector<float> ITkLinkDZ;     ///< z distance to the central space point
+    std::vector<float> ITkLinkDZDR;   ///< dz/dr w.r.t. the central space point
+    //@}
+
+    /**
+     * @name Top links of ITk::SiSpacePointsSeedMaker in the order of their slope
+     * Copied from the tables above, for the 3 pixel space points compatibility computation
+     */
+    //@{
+    std::vector<float> ITkTopTz;
+    std::vector<float> ITkTopR;
+    std::vector<float> ITkTopEr;
+    std::vector<float> ITkTopU;
+    std::vector<float> ITkTopV;
+    //@}
+
     std::vector<InDet::SiSpacePointsSeed> seeds;
 
     /**
@@ -274,13 +321,18 @@ namespace InDet {
     /// This is a compromise to avoid a fixed array size while
     /// still minimising the number of re-allocations
     void resizeSPCont(size_t increment=50, ToolType type = ToolType::ATLxk){
-      size_t currSize = SP.size();
+      size_t currSize = type == ToolType::ITk ? ITkSP.size() : SP.size();
       size_t newSize = currSize + increment;
       if (type == ToolType::ITk) {
         ITkSP.resize(newSize, nullptr);
         X.resize(newSize, 0.);
         Y.resize(newSize, 0.);
         Tn.resize(newSize);
+        ITkTopTz.resize(newSize, 0.);
+        ITkTopR.resize(newSize, 0.);
+        ITkTopEr.resize(newSize, 0.);
+        ITkTopU.resize(newSize, 0.);
+        ITkTopV.resize(newSize, 0.);
       } else {
         SP.resize(newSize, nullptr);
       }
@@ -342,6 +394,7 @@ namespace InDet {
       rfz_map.resize(sizeRFZ, 0);
       if (type==ToolType::ITk) {
         rfz_ITkSorted.resize(sizeRFZ, {});
+        rfz_ITkBegin.resize(sizeRFZ+1, 0);
       } else {
         rfz_Sorted.resize(sizeRFZ, {});
       }
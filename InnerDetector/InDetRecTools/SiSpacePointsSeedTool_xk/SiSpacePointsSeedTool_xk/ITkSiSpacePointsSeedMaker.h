@@ -1,7 +1,7 @@
 // -*- C++ -*-
 
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -402,6 +402,8 @@ namespace ITk
     static void pixInform(const Trk::SpacePoint* sp, float* r) ;
     static void stripInform(EventData& data,const Trk::SpacePoint* sp, float* r) ;
     static void erase(EventData& data) ;
+    /// Copy the phi-z bins into the structure-of-arrays grid of the event data used by the seed search
+    static void buildSpacePointGrid(EventData& data) ;
     void production2Sp(EventData& data) const;
     void production3Sp(EventData& data) const;
 
@@ -418,41 +420,43 @@ namespace ITk
        * phi-Z bins, as is the bottom SP. 
        * 
        * All SP collections are expected to be internally sorted in the radial coordinate.
+       * The cells are given as ranges of indices in the structure-of-arrays
+       * space point grid of the event data (rfz_ITkBegin...).
        * 
        * @param[in,out] data: Event data
-       * @param[in,out] iter_bottomCands: collection of iterators over SP collections for up to 9 phi-z cells to consider for the bottom space-point search 
-       * @param[in,out] iter_endBottomCands: collection of end-iterators over the 
-       * SP collections  for up to 9 phi-z cells to consider for the bottom space-point search 
-       * @param[in,out] iter_topCands: collection of iterators over SP collections for up to 9 phi-z cells to consider for the top space-point search 
-       * @param[in,out] iter_endTopCands: collection of end-iterators over the 
-       * SP collections  for up to 9 phi-z cells to consider for the top space-point search 
-       * @param[in] numberBottomCells: Number of bottom cells to consider. Determines how many entries in iter_(end)bottomCands are expected to be valid. 
-       * @param[in] numberTopCells: Number of top cells to consider.Determines how many entries in iter_(end)topCands are expected to be valid. 
+       * @param[in,out] bottomCands: collection of first indices of the SP for up to 9 phi-z cells to consider for the bottom space-point search 
+       * @param[in,out] endBottomCands: collection of end indices of the 
+       * SP for up to 9 phi-z cells to consider for the bottom space-point search 
+       * @param[in,out] topCands: collection of first indices of the SP for up to 9 phi-z cells to consider for the top space-point search 
+       * @param[in,out] endTopCands: collection of end indices of the 
+       * SP for up to 9 phi-z cells to consider for the top space-point search 
+       * @param[in] numberBottomCells: Number of bottom cells to consider. Determines how many entries in (end)bottomCands are expected to be valid. 
+       * @param[in] numberTopCells: Number of top cells to consider.Determines how many entries in (end)topCands are expected to be valid. 
        * @param[out] nseed: Number of seeds found 
        **/ 
       void production3SpSSS
       (EventData& data,
-      std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & iter_bottomCands,
-      std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & iter_endBottomCands,
-      std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & iter_topCands,
-      std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & iter_endTopCands,
+      std::array<int, arraySizeNeighbourBins> & bottomCands,
+      std::array<int, arraySizeNeighbourBins> & endBottomCands,
+      std::array<int, arraySizeNeighbourBins> & topCands,
+      std::array<int, arraySizeNeighbourBins> & endTopCands,
       const int numberBottomCells, const int numberTopCells, int& nseed) const;
 
       void production3SpPPP
       (EventData& data,
-      std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & iter_bottomCands,
-      std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & iter_endBottomCands,
-      std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & iter_topCands,
-      std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & iter_endTopCands,
+      std::array<int, arraySizeNeighbourBins> & bottomCands,
+      std::array<int, arraySizeNeighbourBins> & endBottomCands,
+      std::array<int, arraySizeNeighbourBins> & topCands,
+      std::array<int, arraySizeNeighbourBins> & endTopCands,
       const int numberBottomCells, const int numberTopCells, int& nseed) const;
 
       /// as above, but for the trigger 
       void production3SpTrigger
       (EventData& /*data*/,
-       std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & /*rb*/,
-       std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & /*rbe*/,
-       std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & /*rt*/,
-       std::array<std::vector<SiSpacePointForSeed*>::iterator, arraySizeNeighbourBins> & /*rte*/,
+       std::array<int, arraySizeNeighbourBins> & /*rb*/,
+       std::array<int, arraySizeNeighbourBins> & /*rbe*/,
+       std::array<int, arraySizeNeighbourBins> & /*rt*/,
+       std::array<int, arraySizeNeighbourBins> & /*rte*/,
        const int /*numberBottomCells*/, const int /*numberTopCells*/, int& /*nseed*/) const;
 
     /** This creates all possible seeds with the passed central and bottom SP, using all top SP 
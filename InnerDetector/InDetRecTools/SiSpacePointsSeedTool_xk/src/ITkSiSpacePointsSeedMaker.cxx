@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+    Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
   */
 
 ///////////////////////////////////////////////////////////////////
@@ -13,6 +13,7 @@
 ///////////////////////////////////////////////////////////////////
 
 #include "SiSpacePointsSeedTool_xk/ITkSiSpacePointsSeedMaker.h"
+#include "ITkSiSpacePointsSeedMakerKernels.h"
 
 #include "InDetPrepRawData/SiCluster.h"
 
@@ -22,11 +23,14 @@
 #include "TrkParameters/TrackParameters.h"
 #include "CxxUtils/checker_macros.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <iomanip>
 #include <ostream>
 
+using namespace ITk::SeedMakerKernels;
+
 namespace ITk
 {
 
@@ -1340,6 +1344,48 @@ void SiSpacePointsSeedMaker::fillLists(EventData &data) const
     }
   }
 
+  buildSpacePointGrid(data);
+}
+
+///////////////////////////////////////////////////////////////////
+// Copy the phi-z bins into contiguous arrays
+///////////////////////////////////////////////////////////////////
+
+void SiSpacePointsSeedMaker::buildSpacePointGrid(EventData &data)
+{
+  data.rfz_ITkSP.clear();
+  data.rfz_ITkX.clear();
+  data.rfz_ITkY.clear();
+  data.rfz_ITkZ.clear();
+  data.rfz_ITkR.clear();
+  data.rfz_ITkCovr.clear();
+  data.rfz_ITkCovz.clear();
+
+  for (int twoDbin = 0; twoDbin != arraySizePhiZ; ++twoDbin)
+  {
+    data.rfz_ITkBegin[twoDbin] = data.rfz_ITkSP.size();
+    for (SiSpacePointForSeed *SP : data.rfz_ITkSorted[twoDbin])
+    {
+      data.rfz_ITkSP.push_back(SP);
+      data.rfz_ITkX.push_back(SP->x());
+      data.rfz_ITkY.push_back(SP->y());
+      data.rfz_ITkZ.push_back(SP->z());
+      data.rfz_ITkR.push_back(SP->radius());
+      data.rfz_ITkCovr.push_back(SP->covr());
+      data.rfz_ITkCovz.push_back(SP->covz());
+    }
+  }
+  data.rfz_ITkBegin[arraySizePhiZ] = data.rfz_ITkSP.size();
+
+  /// the link candidates are the space points of one bin
+  const size_t size = data.rfz_ITkSP.size();
+  data.ITkLinkPass.resize(size);
+  data.ITkLinkU.resize(size);
+  data.ITkLinkV.resize(size);
+  data.ITkLinkR2.resize(size);
+  data.ITkLinkDXY.resize(size);
+  data.ITkLinkDZ.resize(size);
+  data.ITkLinkDZDR.resize(size);
 }
 
 ///////////////////////////////////////////////////////////////////
@@ -1487,12 +1533,12 @@ void SiSpacePointsSeedMaker::production3Sp(EventData &data) const
   const float RTmax[11] = { 80., 200., 200., 200., 250., 250., 250., 200., 200., 200., 80.};
   const float RTmin[11] = { 40., 40., 70., 70., 70., 70., 70., 70., 70., 40., 40.};
 
-  /// prepare arrays to store the iterators over the SP containers for all
+  /// prepare arrays to store the ranges in the space point grid for all
   /// neighbouring cells we wish to consider in the seed formation
-  std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> iter_topCands;
-  std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> iter_endTopCands;
-  std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> iter_bottomCands;
-  std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> iter_endBottomCands;
+  std::array<int, arraySizeNeighbourBins> topCands;
+  std::array<int, arraySizeNeighbourBins> endTopCands;
+  std::array<int, arraySizeNeighbourBins> bottomCands;
+  std::array<int, arraySizeNeighbourBins> endBottomCands;
 
   int nPhiBins;
   std::array<int, arraySizePhiZ> nNeighbourCellsBottom{};
@@ -1566,9 +1612,9 @@ void SiSpacePointsSeedMaker::production3Sp(EventData &data) const
         /// only do something if this cell is populated
         if (!data.rfz_map[theNeighbourCell])
           continue;
-        /// plug the begin and end iterators to the SP in the cell into our array
-        iter_bottomCands[numberBottomCells] = data.rfz_ITkSorted[theNeighbourCell].begin();
-        iter_endBottomCands[numberBottomCells++] = data.rfz_ITkSorted[theNeighbourCell].end();
+        /// plug the range of the SP in the cell into our array
+        bottomCands[numberBottomCells] = data.rfz_ITkBegin[theNeighbourCell];
+        endBottomCands[numberBottomCells++] = data.rfz_ITkBegin[theNeighbourCell + 1];
       }
 
       /// walk through the cells in phi-z we wish to consider for the top SP search.
@@ -1582,21 +1628,21 @@ void SiSpacePointsSeedMaker::production3Sp(EventData &data) const
         /// only do something if this cell is populated
         if (!data.rfz_map[theNeighbourCell])
           continue;
-        /// plug the begin and end iterators to the SP in the cell into our array
-        iter_topCands[numberTopCells] = data.rfz_ITkSorted[theNeighbourCell].begin();
-        iter_endTopCands[numberTopCells++] = data.rfz_ITkSorted[theNeighbourCell].end();
+        /// plug the range of the SP in the cell into our array
+        topCands[numberTopCells] = data.rfz_ITkBegin[theNeighbourCell];
+        endTopCands[numberTopCells++] = data.rfz_ITkBegin[theNeighbourCell + 1];
       }
 
       /// now run the seed search for the current phi-z bin.
       if (!data.trigger)
       {
         if (isPixel)
-          production3SpPPP(data, iter_bottomCands, iter_endBottomCands, iter_topCands, iter_endTopCands, numberBottomCells, numberTopCells, nseed);
+          production3SpPPP(data, bottomCands, endBottomCands, topCands, endTopCands, numberBottomCells, numberTopCells, nseed);
         else
-          production3SpSSS(data, iter_bottomCands, iter_endBottomCands, iter_topCands, iter_endTopCands, numberBottomCells, numberTopCells, nseed);
+          production3SpSSS(data, bottomCands, endBottomCands, topCands, endTopCands, numberBottomCells, numberTopCells, nseed);
       }
       else
-        production3SpTrigger(data, iter_bottomCands, iter_endBottomCands, iter_topCands, iter_endTopCands, numberBottomCells, numberTopCells, nseed);
+        production3SpTrigger(data, bottomCands, endBottomCands, topCands, endTopCands, numberBottomCells, numberTopCells, nseed);
     }
 
     /** If we exceed the seed capacity, we stop here. 
@@ -1622,10 +1668,10 @@ void SiSpacePointsSeedMaker::production3Sp(EventData &data) const
 ///////////////////////////////////////////////////////////////////
 
 void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
-                                              std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &iter_bottomCands,
-                                              std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &iter_endBottomCands,
-                                              std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &iter_topCands,
-                                              std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &iter_endTopCands,
+                                              std::array<int, arraySizeNeighbourBins> &bottomCands,
+                                              std::array<int, arraySizeNeighbourBins> &endBottomCands,
+                                              std::array<int, arraySizeNeighbourBins> &topCands,
+                                              std::array<int, arraySizeNeighbourBins> &endTopCands,
                                               const int numberBottomCells, const int numberTopCells, int &nseed) const
 {
 
@@ -1635,8 +1681,11 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
      * to come from either the same or a range of neighbouring cells. 
      **/
 
-  /// iterator across the candidates for the central space point.
-  std::vector<SiSpacePointForSeed *>::iterator iter_centralSP = iter_bottomCands[0];
+  /// radii of the space points in the grid
+  const float *spR = data.rfz_ITkR.data();
+
+  /// index of the candidates for the central space point.
+  int centralSP = bottomCands[0];
 
   /** 
      * Next, we work out where we are within the ATLAS geometry.
@@ -1645,15 +1694,14 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
      **/
 
   /// find the first central SP candidate above the minimum radius.
-  for (; iter_centralSP != iter_endBottomCands[0]; ++iter_centralSP)
+  for (; centralSP != endBottomCands[0]; ++centralSP)
   {
-    if((*iter_centralSP)->radius() > data.RTmin) break;
+    if(spR[centralSP] > data.RTmin) break;
   }
 
   /// for the top candidates in the central phi-Z bin, we do not need to start at a smaller
   /// radius than the lowest-r valid central SP candidate
-  iter_topCands[0] = iter_centralSP;
-  ++iter_topCands[0];
+  topCands[0] = centralSP + 1;
 
   /// prepare cut values
   const float &ipt2K = data.ipt2K;
@@ -1668,18 +1716,59 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
   /// Extend it needed (should rarely be the case)
   size_t SPcapacity = data.ITkSP.size();
 
+  /// copy the links accepted by pixelLinks for the n space points from first in the grid
+  /// into the tables of the seed search, N being the running index in the tables
+  auto addLinks = [&](int first, int n, bool innerSlopeCut, float covr0, float covz0, size_t &N)
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      if (!data.ITkLinkPass[i])
+        continue;
+
+      const float r2 = data.ITkLinkR2[i];
+      const float dz = data.ITkLinkDZ[i];
+      const float dr = std::sqrt(r2);
+      const float tz = dz * dr;
+      /// this is effectively a segment-level eta cut - exclude too shallow seed segments
+      if (std::abs(tz) > dzdrmax)
+        continue;
+      if (innerSlopeCut && data.rfz_ITkR[first + i] < 50. && std::abs(tz) > 1.5)
+        continue;
+
+      /// add SP to the list
+      data.ITkSP[N] = data.rfz_ITkSP[first + i];
+      data.R[N] = dr;                    ///< inverse distance to central SP
+      data.U[N] = data.ITkLinkU[i];      ///< transformed U coordinate
+      data.V[N] = data.ITkLinkV[i];      ///< transformed V coordinate
+      data.Er[N] = ((covz0 + data.rfz_ITkCovz[first + i]) + (tz * tz) * (covr0 + data.rfz_ITkCovr[first + i])) * r2; ///<squared Error on 1/tan theta coming from the space-point position errors
+      data.ITkSP[N]->setDR(std::sqrt(data.ITkLinkDXY[i] + dz * dz));
+      data.ITkSP[N]->setDZDR(data.ITkLinkDZDR[i]);
+      data.Tn[N].Fl = tz;
+      data.Tn[N].In = N;
+
+      /// if we are exceeding the SP capacity of our data object,
+      /// make it resize its vectors. Will add 50 slots by default,
+      /// so rarely should happen more than once per event.
+      if (++N == SPcapacity)
+      {
+        data.resizeSPCont(50, EventData::ToolType::ITk);
+        SPcapacity = data.ITkSP.size();
+      }
+    }
+  };
+
   /// Loop through all central space point candidates
-  for (; iter_centralSP != iter_endBottomCands[0]; ++iter_centralSP)
+  for (; centralSP != endBottomCands[0]; ++centralSP)
   {
-    const float &R = (*iter_centralSP)->radius();
+    const float R = spR[centralSP];
 
     if(R > data.RTmax)
       break;
 
     /// global coordinates of the central SP
-    const float &X = (*iter_centralSP)->x();
-    const float &Y = (*iter_centralSP)->y();
-    const float &Z = (*iter_centralSP)->z();
+    const float X = data.rfz_ITkX[centralSP];
+    const float Y = data.rfz_ITkY[centralSP];
+    const float Z = data.rfz_ITkZ[centralSP];
 
     /// for the central SP, we veto locations on the last disk -
     /// there would be no "outer" hits to complete a seed.
@@ -1687,8 +1776,8 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
     if (!m_fastTracking && absZ > m_zmaxPPP)
       continue;
 
-    float covr0 = (*iter_centralSP)->covr();
-    float covz0 = (*iter_centralSP)->covz();
+    float covr0 = data.rfz_ITkCovr[centralSP];
+    float covz0 = data.rfz_ITkCovz[centralSP];
     float Ri = 1. / R;
     float ax = X * Ri;
     float ay = Y * Ri;
@@ -1697,6 +1786,8 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
     if (R > m_rmaxPPP)
       Ntm = 1;
 
+    const LinkFrame frame{X, Y, Z, R, ax, ay, VR, maxd0cut, ipt2K, zmax};
+
     /// initialise a counter for found bottom links
     /// This also serves as an index in the data.SP vector
     size_t Nt = 0;
@@ -1705,74 +1796,18 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
     /// Loop over all the cells where we expect to find such SP
     for (int cell = 0; cell < numberTopCells; ++cell)
     {
-      std::vector<SiSpacePointForSeed *>::iterator iter_otherSP = iter_topCands[cell], iter_otherSPend = iter_endTopCands[cell];
-      if (iter_otherSP == iter_otherSPend) continue;
+      int otherSP = topCands[cell];
+      const int otherSPend = endTopCands[cell];
+      if (otherSP == otherSPend) continue;
 
-      for(; iter_otherSP!=iter_otherSPend; ++iter_otherSP) {
-        if(( (*iter_otherSP)->radius()- R ) >= m_drminPPP) break;
+      for(; otherSP!=otherSPend; ++otherSP) {
+        if(( spR[otherSP]- R ) >= m_drminPPP) break;
       } 
-      iter_topCands[cell]=iter_otherSP; 
-
-      /// loop over each SP in each cell
-      for (; iter_otherSP != iter_endTopCands[cell]; ++iter_otherSP)
-      {
-        /// evaluate the radial distance,
-        float Rt = (*iter_otherSP)->radius();
-        float dR = Rt - R;
-
-        const float dz = (*iter_otherSP)->z() - Z;
-        const float dZdR = dz / dR;
-        /// Comparison with vertices Z coordinates
-        /// straight line extrapolation to r=0
-        const float z0 = Z - R * dZdR;
-        if (std::abs(z0) > zmax)
-          continue;
-
-        float dx = (*iter_otherSP)->x() - X;
-        float dy = (*iter_otherSP)->y() - Y;
-        float x = dx * ax + dy * ay;
-        float y = dy * ax - dx * ay;
-        float dxy = x * x + y * y;
-        float r2 = 1. / dxy;
-        float u = x * r2;
-        float v = y * r2;
+      topCands[cell]=otherSP; 
 
-        if (std::abs(R * y) > maxd0cut * x)
-        {
-          float V0;
-          y < 0. ? V0 = VR : V0 = -VR;
-          float A = (v - V0) / (u + 1. / R);
-          float B = V0 + A / R;
-          if ((B * B) > (ipt2K * (1. + A * A)))
-            continue;
-        }
-
-        const float dr = std::sqrt(r2);
-        const float tz = dz * dr;
-        /// this is effectively a segment-level eta cut - exclude too shallow seed segments
-        if (std::abs(tz) > dzdrmax)
-          continue;
-
-        /// add SP to the list
-        data.ITkSP[Nt] = (*iter_otherSP);
-        data.R[Nt] = dr;                                                                                        ///< inverse distance to central SP
-        data.U[Nt] = u;                                                                                         ///< transformed U coordinate
-        data.V[Nt] = v;                                                                                         ///< transformed V coordinate
-        data.Er[Nt] = ((covz0 + (*iter_otherSP)->covz()) + (tz * tz) * (covr0 + (*iter_otherSP)->covr())) * r2; ///<squared Error on 1/tan theta coming from the space-point position errors
-        data.ITkSP[Nt]->setDR(std::sqrt(dxy + dz * dz));
-        data.ITkSP[Nt]->setDZDR(dZdR);
-        data.Tn[Nt].Fl = tz;
-        data.Tn[Nt].In = Nt;
-
-        /// if we are exceeding the SP capacity of our data object,
-        /// make it resize its vectors. Will add 50 slots by default,
-        /// so rarely should happen more than once per event.
-        if (++Nt == SPcapacity)
-        {
-          data.resizeSPCont();
-          SPcapacity = data.ITkSP.size();
-        }
-      } ///< end of loop over SP within top candidate cell
+      /// evaluate the cuts for all SP in the cell, then keep those passing
+      pixelLinks(data, otherSP, otherSPend - otherSP, 1., frame);
+      addLinks(otherSP, otherSPend - otherSP, false, covr0, covz0, Nt);
     }   ///< end of loop over top candidate cells
 
     if (Nt < Ntm)
@@ -1788,80 +1823,22 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
     for (int cell = 0; cell < numberBottomCells; ++cell)
     {
 
-      std::vector<SiSpacePointForSeed*>::iterator iter_otherSP = iter_bottomCands[cell];
+      int otherSP = bottomCands[cell];
 
-      for(; iter_otherSP!=iter_endBottomCands[cell]; ++iter_otherSP) {
-        if( (R - (*iter_otherSP)->radius()) <= m_drmaxPPP) break;
+      for(; otherSP!=endBottomCands[cell]; ++otherSP) {
+        if( (R - spR[otherSP]) <= m_drmaxPPP) break;
       }
-      iter_bottomCands[cell]=iter_otherSP;
-
-      /// in each cell, loop over the space points
-      for (; iter_otherSP != iter_endBottomCands[cell]; ++iter_otherSP)
-      {
-        /// evaluate the radial distance between the central and bottom SP
-        const float &Rb = (*iter_otherSP)->radius();
-        float dR = R - Rb;
+      bottomCands[cell]=otherSP;
 
-        /// if the points are too close in r, abort (future ones will be even closer).
-        if (dR < m_drminPPP)
-          break;
-
-        const float dz = Z - (*iter_otherSP)->z();
-        const float dZdR = dz / dR;
-        /// Comparison with vertices Z coordinates
-        /// straight line extrapolation to r=0
-        const float z0 = Z - R * dZdR;
-        if (std::abs(z0) > zmax)
-          continue;
-
-        float dx = (*iter_otherSP)->x() - X;
-        float dy = (*iter_otherSP)->y() - Y;
-        float x = dx * ax + dy * ay;
-        float y = dy * ax - dx * ay;
-        float dxy = ( x * x + y * y );
-        float r2 = 1. / dxy;
-        float u = x * r2;
-        float v = y * r2;
-
-        if (std::abs(R * y) > -maxd0cut * x)
-        {
-          float V0;
-          y > 0. ? V0 = VR : V0 = -VR;
-          float A = (v - V0) / (u + 1. / R);
-          float B = V0 + A / R;
-          if ((B * B) > (ipt2K * (1. + A * A)))
-            continue;
-        }
-
-        const float dr = std::sqrt(r2);
-        const float tz = dz * dr;
-        /// this is effectively a segment-level eta cut - exclude too shallow seed segments
-        if (std::abs(tz) > dzdrmax)
-          continue;
-        if (m_fastTracking && (*iter_otherSP)->radius() < 50. && std::abs(tz) > 1.5)
-          continue;
-
-        /// add SP to the list
-        data.ITkSP[Nb] = (*iter_otherSP);
-        data.R[Nb] = dr;                                                                                        ///< inverse distance to central SP
-        data.U[Nb] = u;                                                                                         ///< transformed U coordinate
-        data.V[Nb] = v;                                                                                         ///< transformed V coordinate
-        data.Er[Nb] = ((covz0 + (*iter_otherSP)->covz()) + (tz * tz) * (covr0 + (*iter_otherSP)->covr())) * r2; ///<squared Error on 1/tan theta coming from the space-point position errors
-        data.ITkSP[Nb]->setDR(std::sqrt(dxy + dz * dz));
-        data.ITkSP[Nb]->setDZDR(dZdR);
-        data.Tn[Nb].Fl = tz;
-        data.Tn[Nb].In = Nb;
-
-        /// if we are exceeding the SP capacity of our data object,
-        /// make it resize its vectors. Will add 50 slots by default,
-        /// so rarely should happen more than once per event.
-        if (++Nb == SPcapacity)
-        {
-          data.resizeSPCont();
-          SPcapacity = data.ITkSP.size();
-        }
+      /// if the points are too close in r, stop (future ones will be even closer).
+      int otherSPend = otherSP;
+      for (; otherSPend != endBottomCands[cell]; ++otherSPend) {
+        if (R - spR[otherSPend] < m_drminPPP) break;
+      }
 
-      } ///< end of loop over SP in bottom candidate cell
+      /// evaluate the cuts for all SP in the range, then keep those passing
+      pixelLinks(data, otherSP, otherSPend - otherSP, -1., frame);
+      addLinks(otherSP, otherSPend - otherSP, m_fastTracking, covr0, covz0, Nb);
     }   ///< end of loop over bottom candidate cells
 
     /// if we found no bottom candidates (remember, Nb starts counting at Nt), abort
@@ -1871,11 +1848,25 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
     sort(data.Tn,0,Nt);
     sort(data.Tn,Nt,Nb-Nt);
 
+    /// copy the top links in slope order, so that their compatibility with
+    /// each bottom link is evaluated on contiguous arrays
+    for (size_t it = 0; it < Nt; ++it)
+    {
+      int t = data.Tn[it].In;
+      data.ITkTopTz[it] = data.Tn[it].Fl;
+      data.ITkTopR[it] = data.R[t];
+      data.ITkTopEr[it] = data.Er[t];
+      data.ITkTopU[it] = data.U[t];
+      data.ITkTopV[it] = data.V[t];
+    }
+
     data.nOneSeeds = 0;
     data.nOneSeedsQ = 0;
     data.ITkMapOneSeeds.clear();
     data.ITkMapOneSeedsQ.clear();
 
+    TripletBlock block;
+
     /// Three space points comparison
     /// first, loop over the bottom point candidates
     size_t it0 = 0;
@@ -1910,135 +1901,145 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
       if (data.nOneSeedsQ)
         ++Nc;
 
-      /// inner loop over the top point candidates
-      for (size_t it = it0; it < Nt; ++it)
-      {
-
-        int t = data.Tn[it].In; // index of top seed after sorting
-        float Tzt = data.Tn[it].Fl;
-
-        /// Apply a cut on the compatibility between the r-z slope of the two seed segments.
-        /// This is done by comparing the squared difference between slopes, and comparing
-        /// to the squared uncertainty in this difference - we keep a seed if the difference
-        /// is compatible within the assumed uncertainties.
-
-        /// average value of 1/tan(theta), approximate the slope at the location of the central space point
-        float meanOneOverTanThetaSquare = Tzb * Tzt; // SSS uses arithmetic average, PPP geometric average
-
-        /// squared error on the difference in tan(theta) due to space point position errors.
-        float sigmaSquaredSpacePointErrors = Erb + data.Er[t]                                    /// pre-computed individual squared errors on 1/tan(theta) for the two segments
-                                             + 2 * Rb2z * data.R[t]                              /// mixed term with z-uncertainty on central SP
-                                             + 2 * Rb2r * data.R[t] * meanOneOverTanThetaSquare; // mixed term with r-uncertainy on central SP
-
-        /// start out by subtracting from the squared difference in 1/tanTheta the space-point-related squared error
-        float remainingSquaredDelta = (Tzb - Tzt) * (Tzb - Tzt) - sigmaSquaredSpacePointErrors;
-
-        /// First, we test using a generous scattering term calculated assuming the minimum pt we expect
-        /// to reconstruct.
-        if (remainingSquaredDelta - sigmaSquaredScatteringMinPt > 0)
-        {
-          if (Tzb - Tzt < 0.)
-            break;
-          it0 = it + 1 ;
-          continue;
-        }
-
-        /**
-          * The following exploits the transformation u:=x/(x²+y²); v:=y/(x²+y²); 
-          * This is applied on the x,y coordinates in the frame described above, where the 
-          * origin is put in the central SP and the x axis defined to point directly away from the IP.
-          * 
-          * In this transformed u,v frame, what would be our circle in x-y space takes the form of  
-          * a linear function V = (-x0/y0) x U + 1/(2y0) =: A x U + B/2.
-          * Here, x0 and y0 describe the center point of the circle in the x-y frame. 
-          * As the origin of the x-y frame (the middle space point of our seed) is on the circle, 
-          * we have x0²+y0²=R² with circle radius R. 
-          * 
-          * For our seed, we can experimentally obtain A as the slope of the linear function, 
-          * delta V / delta U, 
-          * estimated using the delta U and delta V between the top and bottom space point. 
-          * 
-          * B is then obtained by inserting the obtained A into the 
-          * linear equation for the bottom SP, A x U + B/2 = V --> B = 2(V - A x U0 
-          * 
-          * With x0²+y0²=R², and x0=-A/B and y0=1/B, the radius of the circle is 
-          * then obtained as R²=(1+A²)/B². 
-          **/
-
-        float dU = data.U[t] - Ub;
-        if (dU == 0.)
-          continue;
-        float A = (data.V[t] - Vb) / dU;
-        float onePlusAsquare = 1. + A * A;
-        float B = Vb - A * Ub;
-        float BSquare = B * B;
+      const BottomLink bottomLink{Tzb, Erb, Rb2r, Rb2z, Ub, Vb, R};
 
-        /** With this radius (and pT) estimate, we can apply our pt cut.
-           * Reminder, ipt2K is 1 / (K x 0.9 x pt-cut)², where K translates pt into 2R. 
-           * So here we can apply the pt cut directly on the (2R)² estimate without
-           * the extra overhead of conversion / division.
-           * The second check is a refinement of the above Tz compatibility cut,
-           * replacing the sigmaSquaredScatteringMinPt scattering contribution which assumes the lowest pt 
-           * by one based on the actual estimated pt. 
-           * 
-           * The second term in this if-statement applies a second version of the 
-           * 1/tan(theta) compatibility, this time using a scattering term scaled by the actual measured
-           * pt. This refines the cut applied above, following the same logic ("delta² - sigma² ?<=0")
-           **/
-        if (BSquare > ipt2K * onePlusAsquare)
-          continue;
-        if (remainingSquaredDelta * onePlusAsquare > BSquare * sigmaSquaredScatteringPtDependent)
-        {
-          if (Tzb - Tzt < 0.)
-            break;
-          it0 = it;
-          continue;
-        }
-
-        /** This is an estimate of the transverse impact parameter.
-          * The reasoning is that, in the x-y frame with the central SP as origin and 
-          * the x axis pointing away from the IP, we have for the distance between
-          * the IP and the middle of the circle: 
-          * (x0 - r_central)²+y0² = (R + d0)², 
-          * with R being the circle radius and r_central 
-          * the radial location of the central SP, placing the IP at IP at (-r_central, 0). 
-          * 
-          * First simplify using R² =x0²+y0², then apply the approximation d0²/R² ~ 0. 
-          * 
-          * Finally, consider that locally close to the central SP, the circle is parallel to the x axis, 
-          * so A = 0 --> expand (2R)²=(1+A²)/B² around this point to obtain 
-          * d0 = r_central x (r_central x B - A). 
-          * Note that below, the variable R is the radial coordinate fo the central SP, 
-          * corresponding to r_central in the notation above. 
-          **/
-        float d0 = std::abs((A - B * R) * R);
+      /// inner loop over the top point candidates, by blocks
+      /// for which the compatibility with the bottom link is computed at once
+      bool endOfTops = false;
+      for (size_t first = it0; first < Nt && !endOfTops; first += tripletBlockSize)
+      {
+        const size_t n = std::min(tripletBlockSize, Nt - first);
+        pixelTriplets(data, first, n, bottomLink, block);
 
-        /// apply d0 cut to seed
-        if (d0 <= d0max)
+        for (size_t k = 0; k < n; ++k)
         {
-          /// evaluate distance the two closest-by SP in this seed candidate
-          float dr = data.R[b];
-          if (data.R[t] < data.R[b])
-            dr = data.R[t];
-          /// obtain a quality score - start from the d0 estimate, and add
-          /// a penalty term corresponding to how far the seed segments
-          /// deviate from a straight line in r-z
-          data.ITkSP[t]->setScorePenalty(std::abs((Tzb - Tzt) / (dr * sTzb2)));
-          data.ITkSP[t]->setParam(d0);
-
-          /// record one possible seed candidate, sort by the curvature
-          data.ITkCmSp.emplace_back(B / std::sqrt(onePlusAsquare), data.ITkSP[t]);
-          /// store the transverse IP, will later be used as a quality estimator
-          if (data.ITkCmSp.size() == 500)
-            break;
-        }
-
-      } ///< end loop over top space point candidates
+          const size_t it = first + k;
+          int t = data.Tn[it].In; // index of top seed after sorting
+          float Tzt = data.ITkTopTz[it];
+
+          /// Apply a cut on the compatibility between the r-z slope of the two seed segments.
+          /// This is done by comparing the squared difference between slopes, and comparing
+          /// to the squared uncertainty in this difference - we keep a seed if the difference
+          /// is compatible within the assumed uncertainties.
+          /// The squared difference in 1/tanTheta minus the space-point-related squared error
+          /// (SSS uses arithmetic average, PPP geometric average of the slopes in the error)
+          /// has been computed by pixelTriplets.
+          float remainingSquaredDelta = block.remainingSquaredDelta[k];
+
+          /// First, we test using a generous scattering term calculated assuming the minimum pt we expect
+          /// to reconstruct.
+          if (remainingSquaredDelta - sigmaSquaredScatteringMinPt > 0)
+          {
+            if (Tzb - Tzt < 0.)
+            {
+              endOfTops = true;
+              break;
+            }
+            it0 = it + 1 ;
+            continue;
+          }
+
+          /**
+            * The following exploits the transformation u:=x/(x²+y²); v:=y/(x²+y²); 
+            * This is applied on the x,y coordinates in the frame described above, where the 
+            * origin is put in the central SP and the x axis defined to point directly away from the IP.
+            * 
+            * In this transformed u,v frame, what would be our circle in x-y space takes the form of  
+            * a linear function V = (-x0/y0) x U + 1/(2y0) =: A x U + B/2.
+            * Here, x0 and y0 describe the center point of the circle in the x-y frame. 
+            * As the origin of the x-y frame (the middle space point of our seed) is on the circle, 
+            * we have x0²+y0²=R² with circle radius R. 
+            * 
+            * For our seed, we can experimentally obtain A as the slope of the linear function, 
+            * delta V / delta U, 
+            * estimated using the delta U and delta V between the top and bottom space point. 
+            * 
+            * B is then obtained by inserting the obtained A into the 
+            * linear equation for the bottom SP, A x U + B/2 = V --> B = 2(V - A x U0 
+            * 
+            * With x0²+y0²=R², and x0=-A/B and y0=1/B, the radius of the circle is 
+            * then obtained as R²=(1+A²)/B². 
+            **/
+
+          if (block.dU[k] == 0.)
+            continue;
+          float onePlusAsquare = block.onePlusAsquare[k];
+          float B = block.B[k];
+          float BSquare = B * B;
+
+          /** With this radius (and pT) estimate, we can apply our pt cut.
+             * Reminder, ipt2K is 1 / (K x 0.9 x pt-cut)², where K translates pt into 2R. 
+             * So here we can apply the pt cut directly on the (2R)² estimate without
+             * the extra overhead of conversion / division.
+             * The second check is a refinement of the above Tz compatibility cut,
+             * replacing the sigmaSquaredScatteringMinPt scattering contribution which assumes the lowest pt 
+             * by one based on the actual estimated pt. 
+             * 
+             * The second term in this if-statement applies a second version of the 
+             * 1/tan(theta) compatibility, this time using a scattering term scaled by the actual measured
+             * pt. This refines the cut applied above, following the same logic ("delta² - sigma² ?<=0")
+             **/
+          if (BSquare > ipt2K * onePlusAsquare)
+            continue;
+          if (remainingSquaredDelta * onePlusAsquare > BSquare * sigmaSquaredScatteringPtDependent)
+          {
+            if (Tzb - Tzt < 0.)
+            {
+              endOfTops = true;
+              break;
+            }
+            it0 = it;
+            continue;
+          }
+
+          /** This is an estimate of the transverse impact parameter.
+            * The reasoning is that, in the x-y frame with the central SP as origin and 
+            * the x axis pointing away from the IP, we have for the distance between
+            * the IP and the middle of the circle: 
+            * (x0 - r_central)²+y0² = (R + d0)², 
+            * with R being the circle radius and r_central 
+            * the radial location of the central SP, placing the IP at IP at (-r_central, 0). 
+            * 
+            * First simplify using R² =x0²+y0², then apply the approximation d0²/R² ~ 0. 
+            * 
+            * Finally, consider that locally close to the central SP, the circle is parallel to the x axis, 
+            * so A = 0 --> expand (2R)²=(1+A²)/B² around this point to obtain 
+            * d0 = r_central x (r_central x B - A). 
+            * Note that R is the radial coordinate fo the central SP, 
+            * corresponding to r_central in the notation above. 
+            **/
+          float d0 = block.d0[k];
+
+          /// apply d0 cut to seed
+          if (d0 <= d0max)
+          {
+            /// evaluate distance the two closest-by SP in this seed candidate
+            float dr = data.R[b];
+            if (data.R[t] < data.R[b])
+              dr = data.R[t];
+            /// obtain a quality score - start from the d0 estimate, and add
+            /// a penalty term corresponding to how far the seed segments
+            /// deviate from a straight line in r-z
+            data.ITkSP[t]->setScorePenalty(std::abs((Tzb - Tzt) / (dr * sTzb2)));
+            data.ITkSP[t]->setParam(d0);
+
+            /// record one possible seed candidate, sort by the curvature
+            data.ITkCmSp.emplace_back(B / std::sqrt(onePlusAsquare), data.ITkSP[t]);
+            /// store the transverse IP, will later be used as a quality estimator
+            if (data.ITkCmSp.size() == 500)
+            {
+              endOfTops = true;
+              break;
+            }
+          }
+
+        } ///< end loop over top space point candidates in the block
+      } ///< end loop over blocks of top space point candidates
       /// now apply further cleaning on the seed candidates for this central+bottom pair.
 
       if (data.ITkCmSp.size() > Nc)
       {
-        newOneSeedWithCurvaturesComparisonPPP(data, data.ITkSP[b], (*iter_centralSP), Z - R * Tzb);
+        newOneSeedWithCurvaturesComparisonPPP(data, data.ITkSP[b], data.rfz_ITkSP[centralSP], Z - R * Tzb);
       }
       data.ITkCmSp.clear(); /// cleared in newOneSeedWithCurvaturesComparisonPPP but need to also be cleared in case previous conditional statement isn't fulfilled
     }                        ///< end loop over bottom space points
@@ -2054,10 +2055,10 @@ void SiSpacePointsSeedMaker::production3SpPPP(EventData &data,
 ///////////////////////////////////////////////////////////////////
 
 void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
-                                              std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &iter_bottomCands,
-                                              std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &iter_endBottomCands,
-                                              std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &iter_topCands,
-                                              std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &iter_endTopCands,
+                                              std::array<int, arraySizeNeighbourBins> &bottomCands,
+                                              std::array<int, arraySizeNeighbourBins> &endBottomCands,
+                                              std::array<int, arraySizeNeighbourBins> &topCands,
+                                              std::array<int, arraySizeNeighbourBins> &endTopCands,
                                               const int numberBottomCells, const int numberTopCells, int &nseed) const
 {
 
@@ -2067,9 +2068,12 @@ void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
      * to come from either the same or a range of neighbouring cells. 
      **/
 
-  /// iterator across the candidates for the central space point.
-  std::vector<SiSpacePointForSeed *>::iterator iter_centralSP = iter_bottomCands[0];
-  std::vector<SiSpacePointForSeed *>::iterator iter_otherSP; ///< will be used for iterating over top/bottom SP
+  /// radii of the space points in the grid
+  const float *spR = data.rfz_ITkR.data();
+
+  /// index of the candidates for the central space point.
+  int centralSP = bottomCands[0];
+  int otherSP; ///< will be used for iterating over top/bottom SP
 
   /** 
      * Next, we work out where we are within the ATLAS geometry.
@@ -2078,15 +2082,14 @@ void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
      **/
 
   /// find the first central SP candidate above the minimum radius.
-  for (; iter_centralSP != iter_endBottomCands[0]; ++iter_centralSP)
+  for (; centralSP != endBottomCands[0]; ++centralSP)
   {
-    if((*iter_centralSP)->radius() > data.RTmin) break;
+    if(spR[centralSP] > data.RTmin) break;
   }
 
   /// for the top candidates in the central phi-Z bin, we do not need to start at a smaller
   /// radius than the lowest-r valid central SP candidate
-  iter_topCands[0] = iter_centralSP;
-  ++iter_topCands[0];
+  topCands[0] = centralSP + 1;
 
   /// prepare cut values
   const float ipt2K = data.ipt2K;
@@ -2100,18 +2103,40 @@ void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
   /// Extend it needed (should rarely be the case)
   size_t SPcapacity = data.ITkSP.size();
 
+  /// copy the links accepted by stripLinks for the n space points from first in the grid
+  /// into the tables of the seed search, N being the running index in the tables
+  auto addLinks = [&data, &SPcapacity](int first, int n, size_t &N)
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      if (!data.ITkLinkPass[i])
+        continue;
+      /// add SP to the list
+      data.ITkSP[N] = data.rfz_ITkSP[first + i];
+      data.ITkSP[N]->setDZDR(data.ITkLinkDZDR[i]);
+      /// if we are exceeding the SP capacity of our data object,
+      /// make it resize its vectors. Will add 50 slots by default,
+      /// so rarely should happen more than once per event.
+      if (++N == SPcapacity)
+      {
+        data.resizeSPCont(50, EventData::ToolType::ITk);
+        SPcapacity = data.ITkSP.size();
+      }
+    }
+  };
+
   /// Loop through all central space point candidates
-  for (; iter_centralSP != iter_endBottomCands[0]; ++iter_centralSP)
+  for (; centralSP != endBottomCands[0]; ++centralSP)
   {
 
-    const float &R = (*iter_centralSP)->radius();
+    const float R = spR[centralSP];
     
     if(R > data.RTmax) break; ///< stop if we have moved outside our radial region of interest.
 
     /// global coordinates of the central SP
-    const float &X = (*iter_centralSP)->x();
-    const float &Y = (*iter_centralSP)->y();
-    const float &Z = (*iter_centralSP)->z();
+    const float X = data.rfz_ITkX[centralSP];
+    const float Y = data.rfz_ITkY[centralSP];
+    const float Z = data.rfz_ITkZ[centralSP];
 
     /// for the central SP, we veto locations on the last disk -
     /// there would be no "outer" hits to complete a seed.
@@ -2129,48 +2154,27 @@ void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
     for (int cell = 0; cell < numberTopCells; ++cell)
     {
 
-      for (iter_otherSP = iter_topCands[cell]; iter_otherSP != iter_endTopCands[cell]; ++iter_otherSP)
+      for (otherSP = topCands[cell]; otherSP != endTopCands[cell]; ++otherSP)
       {
         /// evaluate the radial distance,
-        float Rt = (*iter_otherSP)->radius();
+        float Rt = spR[otherSP];
         float dR = Rt - R;
         if (dR >= m_drminSSS)
           break;
       }
-      iter_topCands[cell] = iter_otherSP;
+      topCands[cell] = otherSP;
 
-      /// loop over each SP in each cell
-      for (iter_otherSP = iter_topCands[cell]; iter_otherSP != iter_endTopCands[cell]; ++iter_otherSP)
+      /// if we are to far, the next ones will be even farther, so stop
+      int otherSPend = otherSP;
+      for (; otherSPend != endTopCands[cell]; ++otherSPend)
       {
-
-        /// evaluate the radial distance,
-        float Rt = (*iter_otherSP)->radius();
-        float dR = Rt - R;
-        /// if we are to far, the next ones will be even farther, so abort
-        if (dR > m_drmaxSSS)
+        if (spR[otherSPend] - R > m_drmaxSSS)
           break;
+      }
 
-        const float dz = (*iter_otherSP)->z() - Z;
-        const float dZdR = dz / dR;
-
-        /// Comparison with vertices Z coordinates
-        /// straight line extrapolation to r=0
-        const float z0 = Z - R * dZdR;
-        if (std::abs(dz) > m_dzmaxSSS || std::abs(z0) > zmax)
-          continue;
-
-        /// add SP to the list
-        data.ITkSP[Nt] = (*iter_otherSP);
-        data.ITkSP[Nt]->setDZDR(dZdR);
-        /// if we are exceeding the SP capacity of our data object,
-        /// make it resize its vectors. Will add 50 slots by default,
-        /// so rarely should happen more than once per event.
-        if (++Nt == SPcapacity)
-        {
-          data.resizeSPCont();
-          SPcapacity = data.ITkSP.size();
-        }
-      } ///< end of loop over SP within top candidate cell
+      /// Comparison with vertices Z coordinates for all SP in the range, then keep those passing
+      stripLinks(data, otherSP, otherSPend - otherSP, 1., Z, R, m_dzmaxSSS, zmax);
+      addLinks(otherSP, otherSPend - otherSP, Nt);
     }   ///< end of loop over top candidate cells
 
     /// if we did not find ANY top SP, or if we exceed the storage capacity, we abort this seed candidate.
@@ -2187,43 +2191,22 @@ void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
     for (int cell = 0; cell < numberBottomCells; ++cell)
     {
 
-      for(iter_otherSP=iter_bottomCands[cell]; iter_otherSP!=iter_endBottomCands[cell]; ++iter_otherSP) {
-        if((R-(*iter_otherSP)->radius()) <= m_drmaxSSS) break;
+      for(otherSP=bottomCands[cell]; otherSP!=endBottomCands[cell]; ++otherSP) {
+        if((R-spR[otherSP]) <= m_drmaxSSS) break;
       }  
-      iter_bottomCands[cell]=iter_otherSP;
+      bottomCands[cell]=otherSP;
 
-      /// in each cell, loop over the space points
-      for (; iter_otherSP != iter_endBottomCands[cell]; ++iter_otherSP)
+      /// if the points are too close in r, stop (future ones will be even closer).
+      int otherSPend = otherSP;
+      for (; otherSPend != endBottomCands[cell]; ++otherSPend)
       {
-
-        /// evaluate the radial distance between the central and bottom SP
-        const float &Rb = (*iter_otherSP)->radius();
-        float dR = R - Rb;
-
-        /// if the points are too close in r, abort (future ones will be even closer).
-        if (dR < m_drminSSS)
+        if (R - spR[otherSPend] < m_drminSSS)
           break;
+      }
 
-        const float dz = Z - (*iter_otherSP)->z();
-        const float dZdR = dz / dR;
-
-        /// Comparison with vertices Z coordinates
-        /// straight line extrapolation to r=0
-        const float z0 = Z - R * dZdR;
-        if (std::abs(dz) > m_dzmaxSSS || std::abs(z0) > zmax)
-          continue;
-        /// found a bottom SP candidate, write it into the data object
-        data.ITkSP[Nb] = (*iter_otherSP);
-        data.ITkSP[Nb]->setDZDR(dZdR);
-        /// if we are exceeding the SP capacity of our data object,
-        /// make it resize its vectors. Will add 50 slots by default,
-        /// so rarely should happen more than once per event.
-        if (++Nb == SPcapacity)
-        {
-          data.resizeSPCont();
-          SPcapacity = data.ITkSP.size();
-        }
-      } ///< end of loop over SP in bottom candidate cell
+      /// Comparison with vertices Z coordinates for all SP in the range, then keep those passing
+      stripLinks(data, otherSP, otherSPend - otherSP, -1., Z, R, m_dzmaxSSS, zmax);
+      addLinks(otherSP, otherSPend - otherSP, Nb);
     }   ///< end of loop over bottom candidate cells
 
     /// if we found no bottom candidates (remember, Nb starts counting at Nt), abort
@@ -2231,8 +2214,8 @@ void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
       continue;
 
     /// get covariance on r and z for the central SP
-    float covr0 = (*iter_centralSP)->covr();
-    float covz0 = (*iter_centralSP)->covz();
+    float covr0 = data.rfz_ITkCovr[centralSP];
+    float covz0 = data.rfz_ITkCovz[centralSP];
 
     /// build a unit direction vector pointing from the IP to the central SP
     float ax = X / R;
@@ -2345,7 +2328,7 @@ void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
 
         float dn[3] = {Sx - Sy * A0, Sx * A0 + Sy, Cn};
         float rn[3];
-        if (!(*iter_centralSP)->coordinates(dn, rn))
+        if (!data.rfz_ITkSP[centralSP]->coordinates(dn, rn))
           continue;
 
         // Bottom  point
@@ -2477,7 +2460,7 @@ void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
       /// now apply further cleaning on the seed candidates for this central+bottom pair.
       if (!data.ITkCmSp.empty())
       {
-        newOneSeedWithCurvaturesComparisonSSS(data, data.ITkSP[b], (*iter_centralSP), Zob);
+        newOneSeedWithCurvaturesComparisonSSS(data, data.ITkSP[b], data.rfz_ITkSP[centralSP], Zob);
       }
     } ///< end loop over bottom space points
     ///record seeds found in this run
@@ -2492,10 +2475,10 @@ void SiSpacePointsSeedMaker::production3SpSSS(EventData &data,
 ///////////////////////////////////////////////////////////////////
 
 void SiSpacePointsSeedMaker::production3SpTrigger(EventData &/*data*/,
-                                                  std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &/*rb*/,
-                                                  std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &/*rbe*/,
-                                                  std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &/*rt*/,
-                                                  std::array<std::vector<SiSpacePointForSeed *>::iterator, arraySizeNeighbourBins> &/*rte*/,
+                                                  std::array<int, arraySizeNeighbourBins> &/*rb*/,
+                                                  std::array<int, arraySizeNeighbourBins> &/*rbe*/,
+                                                  std::array<int, arraySizeNeighbourBins> &/*rt*/,
+                                                  std::array<int, arraySizeNeighbourBins> &/*rte*/,
                                                   const int /*numberBottomCells*/, const int /*numberTopCells*/, int &/*nseed*/) const
 {
    ATH_MSG_WARNING("ITk::SiSpacePointsSeedMaker::production3SpTrigger not implemented!");
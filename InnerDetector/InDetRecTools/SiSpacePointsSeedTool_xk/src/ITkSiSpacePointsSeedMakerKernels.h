@@ -0,0 +1,289 @@
+// -*- C++ -*-
+
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+/////////////////////////////////////////////////////////////////////////////////
+// Compatibility cuts of ITk::SiSpacePointsSeedMaker computed on arrays
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ITkSiSpacePointsSeedMakerKernels_H
+#define ITkSiSpacePointsSeedMakerKernels_H
+
+#include "SiSPSeededTrackFinderData/SiSpacePointsSeedMakerEventData.h"
+#include "CxxUtils/restrict.h"
+#include "CxxUtils/vectorize.h"
+
+#include <cmath>
+#include <cstddef>
+
+ATH_ENABLE_VECTORIZATION;
+
+namespace ITk
+{
+  /**
+   * The loops over the space points of the phi-z grid used by ITk::SiSpacePointsSeedMaker
+   * for the first compatibility cuts of the links and for the pixel triplets.
+   *
+   * They have no branches, so that they are vectorised. The links are computed by
+   * blocks of EventData::ITkLinkBlockSize: the complete blocks in place, the last,
+   * partial, one on a copy padded with a point at 1 mm from the central space point
+   * in the radial direction, so that no entry outside the range is read and no
+   * floating point exception is raised by the padding.
+   * The expressions are those of the scalar code they replace, so the results are identical.
+   */
+  namespace SeedMakerKernels
+  {
+    using EventData = InDet::SiSpacePointsSeedMakerEventData;
+
+    /// central space point and cuts for the pixel link search
+    struct LinkFrame
+    {
+      float X, Y, Z, R;   ///< central space point
+      float ax, ay;       ///< direction of the central space point in the transverse plane
+      float VR;           ///< maximum impact parameter over R^2
+      float maxd0cut;
+      float ipt2K;
+      float zmax;
+    };
+
+    /** First compatibility cuts (z0 and pt) of the pixel links between the central space point
+      * and one block of space points.
+      * The links are towards the top space points for sign=1, the bottom ones for sign=-1.
+      * The cuts needing square roots are left to the caller, for the links passing these ones.
+      **/
+    inline void pixelLinkBlock(float sign, const LinkFrame &f,
+                               const float *ATH_RESTRICT xs, const float *ATH_RESTRICT ys,
+                               const float *ATH_RESTRICT zs, const float *ATH_RESTRICT rs,
+                               int *ATH_RESTRICT pass, float *ATH_RESTRICT outU, float *ATH_RESTRICT outV,
+                               float *ATH_RESTRICT outR2, float *ATH_RESTRICT outDXY,
+                               float *ATH_RESTRICT outDZ, float *ATH_RESTRICT outDZDR)
+    {
+      for (int i = 0; i < EventData::ITkLinkBlockSize; ++i)
+      {
+        const float dR = sign * (rs[i] - f.R);
+        const float dz = sign * (zs[i] - f.Z);
+        const float dZdR = dz / dR;
+        /// straight line extrapolation to r=0
+        const float z0 = f.Z - f.R * dZdR;
+
+        /// frame centered on the central SP, with the x axis pointing away from the IP
+        const float dx = xs[i] - f.X;
+        const float dy = ys[i] - f.Y;
+        const float x = dx * f.ax + dy * f.ay;
+        const float y = dy * f.ax - dx * f.ay;
+        const float dxy = x * x + y * y;
+        const float r2 = 1. / dxy;
+        const float u = x * r2;
+        const float v = y * r2;
+
+        /// pt cut, for links not pointing to the beam line within maxd0cut
+        const float V0 = (sign * y < 0.) ? f.VR : -f.VR;
+        const float A = (v - V0) / (u + 1. / f.R);
+        const float B = V0 + A / f.R;
+        const bool lowPt = (std::abs(f.R * y) > sign * f.maxd0cut * x) & ((B * B) > (f.ipt2K * (1. + A * A)));
+
+        /// bitwise operations, to keep the loop free of branches
+        pass[i] = !(std::abs(z0) > f.zmax) & !lowPt;
+        outU[i] = u;
+        outV[i] = v;
+        outR2[i] = r2;
+        outDXY[i] = dxy;
+        outDZ[i] = dz;
+        outDZDR[i] = dZdR;
+      }
+    }
+
+    /// Pixel link cuts for n space points, the results are stored from index 0
+    inline void pixelLinks(int n, float sign, const LinkFrame &f,
+                           const float *xs, const float *ys, const float *zs, const float *rs,
+                           int *pass, float *outU, float *outV, float *outR2,
+                           float *outDXY, float *outDZ, float *outDZDR)
+    {
+      constexpr int blockSize = EventData::ITkLinkBlockSize;
+      const int nFull = n - n % blockSize;
+      for (int first = 0; first < nFull; first += blockSize)
+      {
+        pixelLinkBlock(sign, f, xs + first, ys + first, zs + first, rs + first,
+                       pass + first, outU + first, outV + first, outR2 + first,
+                       outDXY + first, outDZ + first, outDZDR + first);
+      }
+      if (nFull == n)
+        return;
+
+      float x[blockSize], y[blockSize], z[blockSize], r[blockSize];
+      int p[blockSize];
+      float u[blockSize], v[blockSize], r2[blockSize], dxy[blockSize], dz[blockSize], dzdr[blockSize];
+      for (int i = 0; i < blockSize; ++i)
+      {
+        const bool inRange = nFull + i < n;
+        x[i] = inRange ? xs[nFull + i] : f.X + sign * f.ax;
+        y[i] = inRange ? ys[nFull + i] : f.Y + sign * f.ay;
+        z[i] = inRange ? zs[nFull + i] : f.Z;
+        r[i] = inRange ? rs[nFull + i] : f.R + sign;
+      }
+      pixelLinkBlock(sign, f, x, y, z, r, p, u, v, r2, dxy, dz, dzdr);
+      for (int i = 0; nFull + i < n; ++i)
+      {
+        pass[nFull + i] = p[i];
+        outU[nFull + i] = u[i];
+        outV[nFull + i] = v[i];
+        outR2[nFull + i] = r2[i];
+        outDXY[nFull + i] = dxy[i];
+        outDZ[nFull + i] = dz[i];
+        outDZDR[nFull + i] = dzdr[i];
+      }
+    }
+
+    /** Pixel link cuts for the space points [first, first+n) of the phi-z grid.
+      * The results are stored in the ITkLink arrays, indexed from 0.
+      **/
+    inline void pixelLinks(EventData &data, int first, int n, float sign, const LinkFrame &f)
+    {
+      pixelLinks(n, sign, f,
+                 data.rfz_ITkX.data() + first, data.rfz_ITkY.data() + first,
+                 data.rfz_ITkZ.data() + first, data.rfz_ITkR.data() + first,
+                 data.ITkLinkPass.data(), data.ITkLinkU.data(), data.ITkLinkV.data(),
+                 data.ITkLinkR2.data(), data.ITkLinkDXY.data(), data.ITkLinkDZ.data(), data.ITkLinkDZDR.data());
+    }
+
+    /** Compatibility cuts (dz and z0) of the strip links between the central space point (Z,R)
+      * and one block of space points, as pixelLinkBlock.
+      **/
+    inline void stripLinkBlock(float sign, float Z, float R, float dzmax, float zmax,
+                               const float *ATH_RESTRICT zs, const float *ATH_RESTRICT rs,
+                               int *ATH_RESTRICT pass, float *ATH_RESTRICT outDZDR)
+    {
+      for (int i = 0; i < EventData::ITkLinkBlockSize; ++i)
+      {
+        const float dR = sign * (rs[i] - R);
+        const float dz = sign * (zs[i] - Z);
+        const float dZdR = dz / dR;
+        /// straight line extrapolation to r=0
+        const float z0 = Z - R * dZdR;
+        pass[i] = !((std::abs(dz) > dzmax) | (std::abs(z0) > zmax));
+        outDZDR[i] = dZdR;
+      }
+    }
+
+    /// Strip link cuts for n space points, the results are stored from index 0
+    inline void stripLinks(int n, float sign, float Z, float R, float dzmax, float zmax,
+                           const float *zs, const float *rs, int *pass, float *outDZDR)
+    {
+      constexpr int blockSize = EventData::ITkLinkBlockSize;
+      const int nFull = n - n % blockSize;
+      for (int first = 0; first < nFull; first += blockSize)
+      {
+        stripLinkBlock(sign, Z, R, dzmax, zmax, zs + first, rs + first, pass + first, outDZDR + first);
+      }
+      if (nFull == n)
+        return;
+
+      float z[blockSize], r[blockSize];
+      int p[blockSize];
+      float dzdr[blockSize];
+      for (int i = 0; i < blockSize; ++i)
+      {
+        const bool inRange = nFull + i < n;
+        z[i] = inRange ? zs[nFull + i] : Z;
+        r[i] = inRange ? rs[nFull + i] : R + sign;
+      }
+      stripLinkBlock(sign, Z, R, dzmax, zmax, z, r, p, dzdr);
+      for (int i = 0; nFull + i < n; ++i)
+      {
+        pass[nFull + i] = p[i];
+        outDZDR[nFull + i] = dzdr[i];
+      }
+    }
+
+    /// Strip link cuts for the space points [first, first+n) of the phi-z grid, as pixelLinks.
+    inline void stripLinks(EventData &data, int first, int n, float sign, float Z, float R, float dzmax, float zmax)
+    {
+      stripLinks(n, sign, Z, R, dzmax, zmax, data.rfz_ITkZ.data() + first, data.rfz_ITkR.data() + first,
+                 data.ITkLinkPass.data(), data.ITkLinkDZDR.data());
+    }
+
+    /// number of top links for which the pixel triplet compatibility is computed at once
+    constexpr size_t tripletBlockSize = 16;
+
+    /// quantities of the pixel triplets made of one bottom link and a block of top links
+    struct TripletBlock
+    {
+      float remainingSquaredDelta[tripletBlockSize];
+      float dU[tripletBlockSize];
+      float A[tripletBlockSize];
+      float onePlusAsquare[tripletBlockSize];
+      float B[tripletBlockSize];
+      float d0[tripletBlockSize];
+    };
+
+    /// bottom link of the pixel triplets
+    struct BottomLink
+    {
+      float Tzb, Erb, Rb2r, Rb2z, Ub, Vb;
+      float R; ///< radius of the central space point
+    };
+
+    /** Pixel triplet quantities for one block of top links.
+      * The triplets with dU = 0 are rejected by the caller, their A, B and d0 are not meaningful.
+      **/
+    inline void pixelTripletBlock(const BottomLink &b,
+                                  const float *ATH_RESTRICT Tzt, const float *ATH_RESTRICT Rt, const float *ATH_RESTRICT Ert,
+                                  const float *ATH_RESTRICT Ut, const float *ATH_RESTRICT Vt, TripletBlock &out)
+    {
+      for (size_t k = 0; k < tripletBlockSize; ++k)
+      {
+        /// average value of 1/tan(theta), approximate the slope at the location of the central space point
+        const float meanOneOverTanThetaSquare = b.Tzb * Tzt[k];
+        /// squared error on the difference in tan(theta) due to space point position errors.
+        const float sigmaSquaredSpacePointErrors = b.Erb + Ert[k] + 2 * b.Rb2z * Rt[k] + 2 * b.Rb2r * Rt[k] * meanOneOverTanThetaSquare;
+        out.remainingSquaredDelta[k] = (b.Tzb - Tzt[k]) * (b.Tzb - Tzt[k]) - sigmaSquaredSpacePointErrors;
+
+        /// circle through the three points in the u,v frame, see production3SpPPP
+        const float dU = Ut[k] - b.Ub;
+        const float A = (Vt[k] - b.Vb) / (dU + static_cast<float>(dU == 0.f));
+        const float B = b.Vb - A * b.Ub;
+        out.dU[k] = dU;
+        out.A[k] = A;
+        out.onePlusAsquare[k] = 1. + A * A;
+        out.B[k] = B;
+        out.d0[k] = std::abs((A - B * b.R) * b.R);
+      }
+    }
+
+    /** Pixel triplet quantities for n <= tripletBlockSize top links.
+      * A partial block is computed on a copy padded with links at 1 in u from the bottom one.
+      **/
+    inline void pixelTriplets(size_t n, const BottomLink &b,
+                              const float *Tzt, const float *Rt, const float *Ert,
+                              const float *Ut, const float *Vt, TripletBlock &out)
+    {
+      if (n == tripletBlockSize)
+      {
+        pixelTripletBlock(b, Tzt, Rt, Ert, Ut, Vt, out);
+        return;
+      }
+      float tz[tripletBlockSize], r[tripletBlockSize], er[tripletBlockSize], u[tripletBlockSize], v[tripletBlockSize];
+      for (size_t k = 0; k < tripletBlockSize; ++k)
+      {
+        const bool inRange = k < n;
+        tz[k] = inRange ? Tzt[k] : 0.f;
+        r[k] = inRange ? Rt[k] : 0.f;
+        er[k] = inRange ? Ert[k] : 0.f;
+        u[k] = inRange ? Ut[k] : b.Ub + 1.f;
+        v[k] = inRange ? Vt[k] : b.Vb;
+      }
+      pixelTripletBlock(b, tz, r, er, u, v, out);
+    }
+
+    /// Pixel triplet quantities for the top links [first, first+n), stored in slope order in the ITkTop arrays
+    inline void pixelTriplets(const EventData &data, size_t first, size_t n, const BottomLink &b, TripletBlock &out)
+    {
+      pixelTriplets(n, b, data.ITkTopTz.data() + first, data.ITkTopR.data() + first, data.ITkTopEr.data() + first,
+                    data.ITkTopU.data() + first, data.ITkTopV.data() + first, out);
+    }
+  }
+}
+
+#endif // ITkSiSpacePointsSeedMakerKernels_H
@@ -0,0 +1,369 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file SiSpacePointsSeedTool_xk/test/ITkSiSpacePointsSeedMakerKernels_test.cxx
+ * @date Oct, 2026
+ * @brief Regression tests for the link and triplet cuts of ITk::SiSpacePointsSeedMaker.
+ *
+ * The vectorised cuts are compared with the scalar code of the seed maker they
+ * replace, on random space points: the accepted links and all the values stored
+ * for them must be identical. No floating point exception may be raised, in
+ * particular by the entries of the grid following the range of the links.
+ */
+
+#undef NDEBUG
+
+#include "../src/ITkSiSpacePointsSeedMakerKernels.h"
+#include "CxxUtils/checker_macros.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cfenv>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+ATLAS_NO_CHECK_FILE_THREAD_SAFETY;
+
+using namespace ITk::SeedMakerKernels;
+
+namespace {
+
+  constexpr int fpeMask = FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW;
+
+  /// cuts, with the default values of the PPP and SSS seeds
+  constexpr float drminPPP = 6.;
+  constexpr float drmaxPPP = 150.;
+  constexpr float drminSSS = 20.;
+  constexpr float drmaxSSS = 300.;
+  constexpr float dzmaxSSS = 900.;
+  constexpr float maxd0cut = 2.;
+  constexpr float ipt2K = 1.e-6;
+  constexpr float zmax = 250.;
+  constexpr float dzdrmax = 27.;
+
+  struct Point
+  {
+    float x, y, z, r, covr, covz;
+  };
+
+  /// values stored for an accepted link
+  struct Link
+  {
+    int index;
+    float R, U, V, Er, Tz, DR, DZDR;
+  };
+
+  bool same (float a, float b)
+  {
+    return std::memcmp (&a, &b, sizeof(float)) == 0;
+  }
+
+  bool same (const std::vector<Link>& a, const std::vector<Link>& b)
+  {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+      if (a[i].index != b[i].index || !same (a[i].R, b[i].R) || !same (a[i].U, b[i].U) ||
+          !same (a[i].V, b[i].V) || !same (a[i].Er, b[i].Er) || !same (a[i].Tz, b[i].Tz) ||
+          !same (a[i].DR, b[i].DR) || !same (a[i].DZDR, b[i].DZDR))
+        return false;
+    }
+    return true;
+  }
+
+  /// one phi-z bin of space points, sorted in radius, and its copy in the grid
+  std::vector<Point> makeBin (std::mt19937& gen, EventData& data)
+  {
+    std::uniform_real_distribution<float> flat (-1., 1.);
+    std::vector<Point> points (400);
+    for (Point& p : points) {
+      const float phi = 0.5 + 0.05 * flat (gen);
+      p.r = 40. + 260. * std::abs (flat (gen));
+      p.x = p.r * std::cos (phi);
+      p.y = p.r * std::sin (phi);
+      p.z = 300. * flat (gen);
+      p.covr = 0.01 * std::abs (flat (gen));
+      p.covz = 0.02 * std::abs (flat (gen));
+    }
+    std::sort (points.begin(), points.end(),
+               [] (const Point& a, const Point& b) { return a.r < b.r; });
+
+    data.rfz_ITkX.clear();
+    data.rfz_ITkY.clear();
+    data.rfz_ITkZ.clear();
+    data.rfz_ITkR.clear();
+    for (const Point& p : points) {
+      data.rfz_ITkX.push_back (p.x);
+      data.rfz_ITkY.push_back (p.y);
+      data.rfz_ITkZ.push_back (p.z);
+      data.rfz_ITkR.push_back (p.r);
+    }
+    const size_t size = points.size();
+    data.ITkLinkPass.resize (size);
+    data.ITkLinkU.resize (size);
+    data.ITkLinkV.resize (size);
+    data.ITkLinkR2.resize (size);
+    data.ITkLinkDXY.resize (size);
+    data.ITkLinkDZ.resize (size);
+    data.ITkLinkDZDR.resize (size);
+    return points;
+  }
+
+  /// pixel links of the central space point c, as in the scalar seed maker
+  std::vector<Link> pixelReference (const std::vector<Point>& points, int c, bool top, bool innerSlopeCut)
+  {
+    std::vector<Link> links;
+    const Point& sp = points[c];
+    const float R = sp.r, X = sp.x, Y = sp.y, Z = sp.z;
+    const float Ri = 1. / R;
+    const float ax = X * Ri;
+    const float ay = Y * Ri;
+    const float VR = maxd0cut / (R * R);
+    const int n = points.size();
+
+    int i = top ? c + 1 : 0;
+    if (top) {
+      for (; i < n; ++i) if ((points[i].r - R) >= drminPPP) break;
+    }
+    else {
+      for (; i < n; ++i) if ((R - points[i].r) <= drmaxPPP) break;
+    }
+    for (; i < n; ++i) {
+      const Point& o = points[i];
+      const float dR = top ? o.r - R : R - o.r;
+      if (!top && dR < drminPPP) break;
+      const float dz = top ? o.z - Z : Z - o.z;
+      const float dZdR = dz / dR;
+      const float z0 = Z - R * dZdR;
+      if (std::abs (z0) > zmax) continue;
+
+      float dx = o.x - X;
+      float dy = o.y - Y;
+      float x = dx * ax + dy * ay;
+      float y = dy * ax - dx * ay;
+      float dxy = x * x + y * y;
+      float r2 = 1. / dxy;
+      float u = x * r2;
+      float v = y * r2;
+
+      if (top ? std::abs (R * y) > maxd0cut * x : std::abs (R * y) > -maxd0cut * x) {
+        float V0;
+        if (top) y < 0. ? V0 = VR : V0 = -VR;
+        else     y > 0. ? V0 = VR : V0 = -VR;
+        float A = (v - V0) / (u + 1. / R);
+        float B = V0 + A / R;
+        if ((B * B) > (ipt2K * (1. + A * A))) continue;
+      }
+
+      const float dr = std::sqrt (r2);
+      const float tz = dz * dr;
+      if (std::abs (tz) > dzdrmax) continue;
+      if (innerSlopeCut && o.r < 50. && std::abs (tz) > 1.5) continue;
+
+      links.push_back ({i, dr, u, v,
+                        ((sp.covz + o.covz) + (tz * tz) * (sp.covr + o.covr)) * r2,
+                        tz, std::sqrt (dxy + dz * dz), dZdR});
+    }
+    return links;
+  }
+
+  /// pixel links of the central space point c, as in the vectorised seed maker
+  std::vector<Link> pixelKernel (const std::vector<Point>& points, EventData& data, int c, bool top, bool innerSlopeCut)
+  {
+    std::vector<Link> links;
+    const Point& sp = points[c];
+    const float R = sp.r, X = sp.x, Y = sp.y, Z = sp.z;
+    const float Ri = 1. / R;
+    const LinkFrame frame{X, Y, Z, R, X * Ri, Y * Ri, maxd0cut / (R * R), maxd0cut, ipt2K, zmax};
+    const int n = points.size();
+
+    int first = top ? c + 1 : 0;
+    int end = n;
+    if (top) {
+      for (; first < n; ++first) if ((points[first].r - R) >= drminPPP) break;
+    }
+    else {
+      for (; first < n; ++first) if ((R - points[first].r) <= drmaxPPP) break;
+      for (end = first; end < n; ++end) if (R - points[end].r < drminPPP) break;
+    }
+
+    std::feclearexcept (FE_ALL_EXCEPT);
+    pixelLinks (data, first, end - first, top ? 1. : -1., frame);
+    assert (!std::fetestexcept (fpeMask));
+
+    for (int i = 0; i < end - first; ++i) {
+      if (!data.ITkLinkPass[i]) continue;
+      const Point& o = points[first + i];
+      const float r2 = data.ITkLinkR2[i];
+      const float dz = data.ITkLinkDZ[i];
+      const float dr = std::sqrt (r2);
+      const float tz = dz * dr;
+      if (std::abs (tz) > dzdrmax) continue;
+      if (innerSlopeCut && o.r < 50. && std::abs (tz) > 1.5) continue;
+      links.push_back ({first + i, dr, data.ITkLinkU[i], data.ITkLinkV[i],
+                        ((sp.covz + o.covz) + (tz * tz) * (sp.covr + o.covr)) * r2,
+                        tz, std::sqrt (data.ITkLinkDXY[i] + dz * dz), data.ITkLinkDZDR[i]});
+    }
+    return links;
+  }
+
+  /// strip links of the central space point c, as in the scalar seed maker
+  std::vector<Link> stripReference (const std::vector<Point>& points, int c, bool top)
+  {
+    std::vector<Link> links;
+    const float R = points[c].r, Z = points[c].z;
+    const int n = points.size();
+    int i = top ? c + 1 : 0;
+    for (; i < n; ++i) {
+      if (top ? points[i].r - R >= drminSSS : R - points[i].r <= drmaxSSS) break;
+    }
+    for (; i < n; ++i) {
+      const float dR = top ? points[i].r - R : R - points[i].r;
+      if (top ? dR > drmaxSSS : dR < drminSSS) break;
+      const float dz = top ? points[i].z - Z : Z - points[i].z;
+      const float dZdR = dz / dR;
+      const float z0 = Z - R * dZdR;
+      if (std::abs (dz) > dzmaxSSS || std::abs (z0) > zmax) continue;
+      links.push_back ({i, 0, 0, 0, 0, 0, 0, dZdR});
+    }
+    return links;
+  }
+
+  /// strip links of the central space point c, as in the vectorised seed maker
+  std::vector<Link> stripKernel (const std::vector<Point>& points, EventData& data, int c, bool top)
+  {
+    std::vector<Link> links;
+    const float R = points[c].r, Z = points[c].z;
+    const int n = points.size();
+    int first = top ? c + 1 : 0;
+    for (; first < n; ++first) {
+      if (top ? points[first].r - R >= drminSSS : R - points[first].r <= drmaxSSS) break;
+    }
+    int end = first;
+    for (; end < n; ++end) {
+      if (top ? points[end].r - R > drmaxSSS : R - points[end].r < drminSSS) break;
+    }
+
+    std::feclearexcept (FE_ALL_EXCEPT);
+    stripLinks (data, first, end - first, top ? 1. : -1., Z, R, dzmaxSSS, zmax);
+    assert (!std::fetestexcept (fpeMask));
+
+    for (int i = 0; i < end - first; ++i) {
+      if (data.ITkLinkPass[i]) links.push_back ({first + i, 0, 0, 0, 0, 0, 0, data.ITkLinkDZDR[i]});
+    }
+    return links;
+  }
+
+} // anonymous namespace
+
+
+// Pixel links.
+void test1()
+{
+  std::cout << "test1\n";
+  std::mt19937 gen (1);
+  EventData data;
+  size_t nlinks = 0;
+  for (int ibin = 0; ibin < 5; ++ibin) {
+    const std::vector<Point> points = makeBin (gen, data);
+    for (int c = 0; c < static_cast<int>(points.size()); ++c) {
+      for (bool innerSlopeCut : {false, true}) {
+        const std::vector<Link> top = pixelReference (points, c, true, innerSlopeCut);
+        assert (same (top, pixelKernel (points, data, c, true, innerSlopeCut)));
+        const std::vector<Link> bottom = pixelReference (points, c, false, innerSlopeCut);
+        assert (same (bottom, pixelKernel (points, data, c, false, innerSlopeCut)));
+        nlinks += top.size() + bottom.size();
+      }
+    }
+  }
+  assert (nlinks > 0);
+}
+
+
+// Strip links.
+void test2()
+{
+  std::cout << "test2\n";
+  std::mt19937 gen (2);
+  EventData data;
+  size_t nlinks = 0;
+  for (int ibin = 0; ibin < 5; ++ibin) {
+    const std::vector<Point> points = makeBin (gen, data);
+    for (int c = 0; c < static_cast<int>(points.size()); ++c) {
+      const std::vector<Link> top = stripReference (points, c, true);
+      assert (same (top, stripKernel (points, data, c, true)));
+      const std::vector<Link> bottom = stripReference (points, c, false);
+      assert (same (bottom, stripKernel (points, data, c, false)));
+      nlinks += top.size() + bottom.size();
+    }
+  }
+  assert (nlinks > 0);
+}
+
+
+// Pixel triplets.
+void test3()
+{
+  std::cout << "test3\n";
+  std::mt19937 gen (3);
+  std::uniform_real_distribution<float> flat (-1., 1.);
+  EventData data;
+  const size_t n = 100;
+  data.ITkTopTz.resize (n);
+  data.ITkTopR.resize (n);
+  data.ITkTopEr.resize (n);
+  data.ITkTopU.resize (n);
+  data.ITkTopV.resize (n);
+
+  for (int ibottom = 0; ibottom < 100; ++ibottom) {
+    const BottomLink b{0.3f * flat (gen), 1.e-4f, 1.e-3f, 2.e-3f, 0.01f * flat (gen), 0.01f * flat (gen), 100.f};
+    for (size_t k = 0; k < n; ++k) {
+      data.ITkTopTz[k] = 0.3 * flat (gen);
+      data.ITkTopR[k] = 0.01 * std::abs (flat (gen));
+      data.ITkTopEr[k] = 1.e-4 * std::abs (flat (gen));
+      data.ITkTopU[k] = 0.01 * flat (gen);
+      data.ITkTopV[k] = 0.01 * flat (gen);
+    }
+    /// a top link with the same u as the bottom one
+    data.ITkTopU[ibottom % n] = b.Ub;
+
+    for (size_t first = 0; first < n; first += tripletBlockSize) {
+      const size_t nt = std::min (tripletBlockSize, n - first);
+      TripletBlock block;
+      std::feclearexcept (FE_ALL_EXCEPT);
+      pixelTriplets (data, first, nt, b, block);
+      assert (!std::fetestexcept (fpeMask));
+
+      for (size_t k = 0; k < nt; ++k) {
+        const size_t t = first + k;
+        const float Tzt = data.ITkTopTz[t];
+        const float meanOneOverTanThetaSquare = b.Tzb * Tzt;
+        const float sigmaSquaredSpacePointErrors = b.Erb + data.ITkTopEr[t] + 2 * b.Rb2z * data.ITkTopR[t]
+                                                   + 2 * b.Rb2r * data.ITkTopR[t] * meanOneOverTanThetaSquare;
+        assert (same (block.remainingSquaredDelta[k], (b.Tzb - Tzt) * (b.Tzb - Tzt) - sigmaSquaredSpacePointErrors));
+        const float dU = data.ITkTopU[t] - b.Ub;
+        assert (same (block.dU[k], dU));
+        if (dU == 0.) continue;
+        const float A = (data.ITkTopV[t] - b.Vb) / dU;
+        const float B = b.Vb - A * b.Ub;
+        assert (same (block.A[k], A));
+        assert (same (block.onePlusAsquare[k], 1. + A * A));
+        assert (same (block.B[k], B));
+        assert (same (block.d0[k], std::abs ((A - B * b.R) * b.R)));
+      }
+    }
+  }
+}
+
+
+int main()
+{
+  std::cout << "SiSpacePointsSeedTool_xk/ITkSiSpacePointsSeedMakerKernels_test\n";
+  test1();
+  test2();
+  test3();
+  return 0;
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef MAGFIELDCONDITIONS_ATLASMTFIELDMAPCONDOBJ
@@ -8,6 +8,7 @@
 // MagField includes
 #include "AthenaKernel/CondCont.h" 
 #include "MagFieldElements/AtlasFieldMap.h"
+#include <memory>
 
 class AtlasFieldMapCondObj {
 
@@ -21,10 +22,12 @@ public:
 
     // setter
     void setFieldMap(std::unique_ptr<MagField::AtlasFieldMap> fieldMap);
-    
+    // setter for a map shared with other conditions objects (other IOVs)
+    void setFieldMap(std::shared_ptr<const MagField::AtlasFieldMap> fieldMap);
+
 private:
     // field map 
-    std::unique_ptr<MagField::AtlasFieldMap> m_fieldMap;
+    std::shared_ptr<const MagField::AtlasFieldMap> m_fieldMap;
 };
 
 
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 #include "MagFieldConditions/AtlasFieldMapCondObj.h"
 
@@ -21,3 +21,8 @@ AtlasFieldMapCondObj::setFieldMap(std::unique_ptr<MagField::AtlasFieldMap> field
     m_fieldMap = std::move(fieldMap);
 }
 
+void
+AtlasFieldMapCondObj::setFieldMap(std::shared_ptr<const MagField::AtlasFieldMap> fieldMap)
+{
+    m_fieldMap = std::move(fieldMap);
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -76,6 +76,29 @@ public:
                   double* ATH_RESTRICT bxyz,
                   double* ATH_RESTRICT deriv = nullptr);
 
+  /** get B field values at n positions, same as calling getField
+   * for each of them.
+   * Points falling into the same cell of the map are interpolated
+   * together, using the cell cached for the first of them.
+   * xyz[n][3] is in mm, bxyz[n][3] is in kT
+   * if deriv[n][9] is given, field derivatives are returned in kT/mm
+   * */
+  void getFieldN(int n,
+                 const double (*ATH_RESTRICT xyz)[3],
+                 double (*ATH_RESTRICT bxyz)[3],
+                 double (*ATH_RESTRICT deriv)[9] = nullptr);
+
+  /** get B field values on the z-r plane at n positions,
+   * same as calling getFieldZR for each of them.
+   * Consecutive points staying in the cached cell are interpolated together.
+   * xyz[n][3] is in mm, bxyz[n][3] is in kT
+   * if deriv[n][9] is given, field derivatives are returned in kT/mm
+   * */
+  void getFieldZRN(int n,
+                   const double (*ATH_RESTRICT xyz)[3],
+                   double (*ATH_RESTRICT bxyz)[3],
+                   double (*ATH_RESTRICT deriv)[9] = nullptr);
+
   /** status of the magnets */
   bool solenoidOn() const;
   bool toroidOn() const;
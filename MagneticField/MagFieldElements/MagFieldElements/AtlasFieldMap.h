@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -41,10 +41,13 @@ public:
   AtlasFieldMap() = default;
   ~AtlasFieldMap() { delete m_meshZR; }
 
-  // initialize map from root file
+  // initialize map from root file.
+  // With compactZR, the fast 2d map is stored with 16-bit values
+  // (see BFieldMeshZR::compact)
   bool initializeMap(TFile* rootfile,
                      float solenoidCurrent,
-                     float toroidCurrent);
+                     float toroidCurrent,
+                     bool compactZR = false);
 
   // Functions used by getField[ZR] in AtlasFieldCache
   // search for a "zone" to which the point (z,r,phi) belongs
@@ -61,6 +64,13 @@ public:
   float toroidCurrent() const { return m_toroidCurrent; }
   int solenoidZoneId() const { return m_solenoidZoneId; }
 
+  /** approximate memory footprint in bytes */
+  int memSize() const;
+
+  /** compute the fast 2d map from the 3d map, as stored by initializeMap
+   * without compactZR. Used to validate the stored one. */
+  std::unique_ptr<BFieldMeshZR> makeMeshZR() const;
+
 private:
   AtlasFieldMap& operator=(AtlasFieldMap&& other) = delete;
   AtlasFieldMap(const AtlasFieldMap& other) = delete;
@@ -74,10 +84,9 @@ private:
   int read_packed_data(std::istream& input, std::vector<int>& data) const;
   int read_packed_int(std::istream& input, int& n) const;
   void buildLUT();
-  void buildZR();
-
-  /** approximate memory footprint in bytes */
-  int memSize() const;
+  void buildZR(bool compact);
+  // zone used for the fast 2d map
+  const BFieldZone* solenoidZone() const;
 
   /** Data Members **/
 
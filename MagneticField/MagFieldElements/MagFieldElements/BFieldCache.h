@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -55,6 +55,15 @@ public:
             double phi,
             double* ATH_RESTRICT B,
             double* ATH_RESTRICT deriv = nullptr) const;
+  // interpolate the field at n points, all inside this bin, and return
+  // B[n][3]. r[n] and phi[n] are the cylindrical coordinates of the points.
+  // also compute field derivatives if deriv[n][9] is given.
+  void getBN(int n,
+             const double (*ATH_RESTRICT xyz)[3],
+             const double* ATH_RESTRICT r,
+             const double* ATH_RESTRICT phi,
+             double (*ATH_RESTRICT B)[3],
+             double (*ATH_RESTRICT deriv)[9] = nullptr) const;
 
 private:
   // bin range in z
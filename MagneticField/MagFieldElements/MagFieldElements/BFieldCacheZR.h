@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //
@@ -36,6 +36,14 @@ public:
             double r,
             double* ATH_RESTRICT B,
             double* ATH_RESTRICT deriv = nullptr) const;
+  // interpolate the field at n points, all inside this bin, and return
+  // B[n][3]. r[n] is the radius of the points.
+  // also compute field derivatives if deriv[n][9] is given.
+  void getBN(int n,
+             const double (*ATH_RESTRICT xyz)[3],
+             const double* ATH_RESTRICT r,
+             double (*ATH_RESTRICT B)[3],
+             double (*ATH_RESTRICT deriv)[9] = nullptr) const;
 
 private:
   // default unphysical boundaries, so that inside() will fail
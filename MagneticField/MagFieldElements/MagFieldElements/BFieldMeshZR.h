@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /*
@@ -7,6 +7,11 @@
  *
  * A 2-dim z-r mesh inside the solenoid field map
  *
+ * The field is filled in double precision. compact() replaces it by
+ * 16-bit values in units of a given scale, normally the one of the
+ * solenoid zone the mesh is computed from, which makes the mesh four
+ * times smaller.
+ *
  * Masahiro Morii, Harvard University
  *
  * AthenaMT : RD Schaffer , Christos Anastopoulos
@@ -32,6 +37,11 @@ public:
   void appendField(const BFieldVectorZR& field);
   // build LUT
   void buildLUT();
+  // store the field as 16-bit values in units of bscale.
+  // returns false, keeping the double precision field, if a value
+  // does not fit.
+  bool compact(double bscale);
+  bool isCompact() const;
   // test if a point is inside this zone
   bool inside(double z, double r) const;
   // find the bin
@@ -49,7 +59,7 @@ public:
   unsigned nmesh(size_t i) const;
   double mesh(size_t i, size_t j) const;
   unsigned nfield() const;
-  const BFieldVectorZR& field(size_t i) const;
+  BFieldVectorZR field(size_t i) const;
   int memSize() const;
 
 private:
@@ -57,6 +67,9 @@ private:
   std::array<double, 2> m_max;
   std::array<std::vector<double>, 2> m_mesh;
   std::vector<BFieldVectorZR> m_field;
+  // compact storage: (Bz,Br) in units of m_compactScale
+  std::vector<std::array<short, 2>> m_compactField;
+  double m_compactScale{ 0 };
   // look-up table and related variables
   std::array<std::vector<int>, 2> m_LUT;
   std::array<double, 2> m_invUnit; // inverse unit size in the LUT
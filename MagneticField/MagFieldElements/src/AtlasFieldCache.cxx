@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //
@@ -11,6 +11,7 @@
 //
 #include "MagFieldElements/AtlasFieldCache.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -26,6 +27,23 @@ namespace {
  * So 0.1 Gauss in Units of kT (which is what we return)
  */
 constexpr double defaultB = 0.1 * Gaudi::Units::gauss;
+
+/* getFieldN handles the points in blocks of this size,
+ * so that the bookkeeping of the groups fits on the stack
+ */
+constexpr int blockSize = 16;
+
+void
+setDefault(double* ATH_RESTRICT bxyz, double* ATH_RESTRICT deriv)
+{
+  bxyz[0] = bxyz[1] = bxyz[2] = defaultB;
+  // return zero gradient if requested
+  if (deriv) {
+    for (int i = 0; i < 9; i++) {
+      deriv[i] = 0.;
+    }
+  }
+}
 }
 
 // We compile this package with optimization, even in debug builds; otherwise,
@@ -131,3 +149,141 @@ MagField::AtlasFieldCache::getFieldZR(const double* ATH_RESTRICT xyz,
   m_cacheZR.getB(xyz, r, bxyz, deriv);
 }
 
+
+ATH_FLATTEN
+void
+MagField::AtlasFieldCache::getFieldN(int n,
+                                     const double (*ATH_RESTRICT xyz)[3],
+                                     double (*ATH_RESTRICT bxyz)[3],
+                                     double (*ATH_RESTRICT deriv)[9])
+{
+  // Allow for the case of no map for testing
+  if (m_fieldMap == nullptr) {
+    for (int i = 0; i < n; ++i) {
+      setDefault(bxyz[i], deriv ? deriv[i] : nullptr);
+    }
+    return;
+  }
+
+  double r[blockSize];
+  double phi[blockSize];
+  // points of the block still to be done
+  int pending[blockSize];
+  // the points of one cell, gathered
+  double gxyz[blockSize][3];
+  double gr[blockSize];
+  double gphi[blockSize];
+  double gbxyz[blockSize][3];
+  double gderiv[blockSize][9];
+  int gindex[blockSize];
+
+  for (int first = 0; first < n; first += blockSize) {
+    const int m = std::min(blockSize, n - first);
+    const double(*pos)[3] = xyz + first;
+    for (int i = 0; i < m; ++i) {
+      const double x = pos[i][0];
+      const double y = pos[i][1];
+      r[i] = std::sqrt(x * x + y * y);
+      phi[i] = std::atan2(y, x);
+      pending[i] = i;
+    }
+
+    int npending = m;
+    while (npending > 0) {
+      // the cached cell must contain the first pending point
+      const int i0 = pending[0];
+      if (!m_cache3d.inside(pos[i0][2], r[i0], phi[i0]) &&
+          !fillFieldCache(pos[i0][2], r[i0], phi[i0])) {
+        // outside the valid map volume
+        setDefault(bxyz[first + i0], deriv ? deriv[first + i0] : nullptr);
+        std::copy(pending + 1, pending + npending, pending);
+        --npending;
+        continue;
+      }
+
+      // take all the pending points inside the cell, keep the others
+      int ngroup = 0;
+      int nleft = 0;
+      for (int k = 0; k < npending; ++k) {
+        const int i = pending[k];
+        if (m_cache3d.inside(pos[i][2], r[i], phi[i])) {
+          gindex[ngroup] = i;
+          gxyz[ngroup][0] = pos[i][0];
+          gxyz[ngroup][1] = pos[i][1];
+          gxyz[ngroup][2] = pos[i][2];
+          gr[ngroup] = r[i];
+          gphi[ngroup] = phi[i];
+          ++ngroup;
+        } else {
+          pending[nleft++] = i;
+        }
+      }
+      npending = nleft;
+
+      // do interpolation (cache3d has correct scale factor)
+      m_cache3d.getBN(ngroup, gxyz, gr, gphi, gbxyz, deriv ? gderiv : nullptr);
+
+      for (int k = 0; k < ngroup; ++k) {
+        const int i = first + gindex[k];
+        std::copy(gbxyz[k], gbxyz[k] + 3, bxyz[i]);
+        if (deriv) {
+          std::copy(gderiv[k], gderiv[k] + 9, deriv[i]);
+        }
+        if (!m_cond) {
+          continue;
+        }
+        // add biot savart component, as in getField
+        for (const BFieldCond& cond : *m_cond) {
+          cond.addBiotSavart(m_scaleToUse, xyz[i], bxyz[i], deriv ? deriv[i] : nullptr);
+        }
+      }
+    }
+  }
+}
+
+void
+MagField::AtlasFieldCache::getFieldZRN(int n,
+                                       const double (*ATH_RESTRICT xyz)[3],
+                                       double (*ATH_RESTRICT bxyz)[3],
+                                       double (*ATH_RESTRICT deriv)[9])
+{
+  // Allow for the case of no map for testing
+  if (m_fieldMap == nullptr) {
+    for (int i = 0; i < n; ++i) {
+      setDefault(bxyz[i], deriv ? deriv[i] : nullptr);
+    }
+    return;
+  }
+
+  double r[blockSize];
+  for (int first = 0; first < n; first += blockSize) {
+    const int m = std::min(blockSize, n - first);
+    for (int i = 0; i < m; ++i) {
+      const double x = xyz[first + i][0];
+      const double y = xyz[first + i][1];
+      r[i] = std::sqrt(x * x + y * y);
+    }
+    // the points follow each other along a track: interpolate together
+    // the consecutive points staying in the cached cell
+    int i = 0;
+    while (i < m) {
+      const double z = xyz[first + i][2];
+      if (!m_cacheZR.inside(z, r[i]) && !fillFieldCacheZR(z, r[i])) {
+        // outside the valid z-r map volume, use the full version
+        getField(xyz[first + i], bxyz[first + i], deriv ? deriv[first + i] : nullptr);
+        ++i;
+        continue;
+      }
+      int end = i + 1;
+      while (end < m && m_cacheZR.inside(xyz[first + end][2], r[end])) {
+        ++end;
+      }
+      m_cacheZR.getBN(end - i,
+                      xyz + first + i,
+                      r + i,
+                      bxyz + first + i,
+                      deriv ? deriv + first + i : nullptr);
+      i = end;
+    }
+  }
+}
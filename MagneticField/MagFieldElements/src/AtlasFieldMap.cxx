@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 ///////////////////////////////////////////////////////////////////
@@ -25,7 +25,8 @@
 bool
 MagField::AtlasFieldMap::initializeMap(TFile* rootfile,
                                        float solenoidCurrent,
-                                       float toroidCurrent)
+                                       float toroidCurrent,
+                                       bool compactZR)
 {
   // save currents
   m_solenoidCurrent = solenoidCurrent;
@@ -191,7 +192,7 @@ MagField::AtlasFieldMap::initializeMap(TFile* rootfile,
   delete[] fieldphi;
   // build the LUTs
   buildLUT();
-  buildZR();
+  buildZR(compactZR);
 
   // setup id for solenoid bfield zone
   BFieldZone* solezone = findZoneSlow(0.0, 0.0, 0.0);
@@ -322,20 +323,32 @@ MagField::AtlasFieldMap::buildLUT()
 // Build the z-r 2d map for fast solenoid field
 //
 void
-MagField::AtlasFieldMap::buildZR()
+MagField::AtlasFieldMap::buildZR(bool compact)
 {
   // delete if previously allocated
   delete m_meshZR;
+  m_meshZR = makeMeshZR().release();
 
-  // find the solenoid zone
-  // solenoid zone always covers 100 < R < 1000, but not necessarily R < 100
-  // so we search for the zone that contains a point at R = 200, Z = 0
-  const BFieldZone* solezone = findBFieldZone(0.0, 200.0, 0.0);
+  // the phi averages are within the 16-bit range of the solenoid zone values,
+  // so they can be stored in the same units, rounding them by at most half
+  // of the granularity of the map itself
+  if (compact) {
+    m_meshZR->compact(solenoidZone()->bscale());
+  }
+}
+
+//
+// Compute the z-r 2d map from the phi-averaged solenoid field
+//
+std::unique_ptr<BFieldMeshZR>
+MagField::AtlasFieldMap::makeMeshZR() const
+{
+  const BFieldZone* solezone = solenoidZone();
 
   // instantiate the new ZR map with the same external coverage as the solenoid
   // zone make sure R = 0 is covered
-  m_meshZR =
-    new BFieldMeshZR(solezone->zmin(), solezone->zmax(), 0.0, solezone->rmax());
+  auto meshZR = std::make_unique<BFieldMeshZR>(
+    solezone->zmin(), solezone->zmax(), 0.0, solezone->rmax());
 
   // reserve the right amount of memroy
   unsigned nmeshz = solezone->nmesh(0);
@@ -343,25 +356,25 @@ MagField::AtlasFieldMap::buildZR()
   if (solezone->rmin() > 0.0) {
     nmeshr++;
   }
-  m_meshZR->reserve(nmeshz, nmeshr);
+  meshZR->reserve(nmeshz, nmeshr);
 
   // copy the mesh structure in z/r
   // take care of R = 0 first
   if (solezone->rmin() > 0.0) {
-    m_meshZR->appendMesh(1, 0.0);
+    meshZR->appendMesh(1, 0.0);
   }
   // copy the rest
   for (int i = 0; i < 2; i++) {                         // z, r
     for (unsigned j = 0; j < solezone->nmesh(i); j++) { // loop over mesh points
-      m_meshZR->appendMesh(i, solezone->mesh(i, j));
+      meshZR->appendMesh(i, solezone->mesh(i, j));
     }
   }
 
   // loop through the mesh and compute the phi-averaged field
-  for (unsigned iz = 0; iz < m_meshZR->nmesh(0); iz++) { // loop over z
-    double z = m_meshZR->mesh(0, iz);
-    for (unsigned ir = 0; ir < m_meshZR->nmesh(1); ir++) { // loop over r
-      double r = m_meshZR->mesh(1, ir);
+  for (unsigned iz = 0; iz < meshZR->nmesh(0); iz++) { // loop over z
+    double z = meshZR->mesh(0, iz);
+    for (unsigned ir = 0; ir < meshZR->nmesh(1); ir++) { // loop over r
+      double r = meshZR->mesh(1, ir);
       const int nphi(200); // number of phi slices to average
       double Br = 0.0;
       double Bz = 0.0;
@@ -378,12 +391,25 @@ MagField::AtlasFieldMap::buildZR()
       }
       Br *= 1.0 / double(nphi);
       Bz *= 1.0 / double(nphi);
-      m_meshZR->appendField(BFieldVectorZR(Bz, Br));
+      meshZR->appendField(BFieldVectorZR(Bz, Br));
     }
   }
 
   // build the internal LUT
-  m_meshZR->buildLUT();
+  meshZR->buildLUT();
+
+  return meshZR;
+}
+
+//
+// The solenoid zone
+//
+const BFieldZone*
+MagField::AtlasFieldMap::solenoidZone() const
+{
+  // solenoid zone always covers 100 < R < 1000, but not necessarily R < 100
+  // so we search for the zone that contains a point at R = 200, Z = 0
+  return findBFieldZone(0.0, 200.0, 0.0);
 }
 
 //
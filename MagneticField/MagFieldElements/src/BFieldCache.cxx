@@ -1,9 +1,10 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "MagFieldElements/BFieldCache.h"
 #include "CxxUtils/vec.h"
+#include <algorithm>
 #include <cmath>
 
 void
@@ -181,3 +182,98 @@ BFieldCache::getB(const double* ATH_RESTRICT xyz,
   }
 }
 
+
+void
+BFieldCache::getBN(int n,
+                   const double (*ATH_RESTRICT xyz)[3],
+                   const double* ATH_RESTRICT r,
+                   const double* ATH_RESTRICT phi,
+                   double (*ATH_RESTRICT B)[3],
+                   double (*ATH_RESTRICT deriv)[9]) const
+{
+  // the derivatives are only needed for the field gradient,
+  // use the one point interpolation for them
+  if (deriv) {
+    for (int i = 0; i < n; ++i) {
+      getB(xyz[i], r[i], phi[i], B[i], deriv[i]);
+    }
+    return;
+  }
+
+  /*
+   Same calculation as getB, but the "lanes" are now 4 points:
+   the 8 corners of the bin are common to all the points,
+   while the fractional positions are vectors.
+   The order of the operations is the one of getB.
+  */
+  using vec4 = CxxUtils::vec<double, 4>;
+  constexpr int W = CxxUtils::vec_size<vec4>();
+
+  vec4 phimin;
+  CxxUtils::vbroadcast(phimin, m_phimin);
+  vec4 zero;
+  CxxUtils::vbroadcast(zero, 0.0);
+  vec4 one;
+  CxxUtils::vbroadcast(one, 1.0);
+
+  for (int i = 0; i < n; i += W) {
+    // the last block is padded with copies of the last point
+    vec4 x;
+    vec4 y;
+    vec4 z;
+    vec4 rv;
+    vec4 phiv;
+    for (int k = 0; k < W; ++k) {
+      const int j = std::min(i + k, n - 1);
+      x[k] = xyz[j][0];
+      y[k] = xyz[j][1];
+      z[k] = xyz[j][2];
+      rv[k] = r[j];
+      phiv[k] = phi[j];
+    }
+
+    // make sure phi is inside [m_phimin,m_phimax]
+    const vec4 phiShifted = phiv + 2 * M_PI;
+    CxxUtils::vselect(phiv, phiShifted, phiv, phiv < phimin);
+    // fractional position inside this bin
+    const vec4 fz = (z - m_zmin) * m_invz;
+    const vec4 gz = 1.0 - fz;
+    const vec4 fr = (rv - m_rmin) * m_invr;
+    const vec4 gr = 1.0 - fr;
+    const vec4 fphi = (phiv - m_phimin) * m_invphi;
+    const vec4 gphi = 1.0 - fphi;
+
+    vec4 Bzrphi[3];
+    for (int j = 0; j < 3; ++j) { // Bz, Br, Bphi components
+      const double* field = m_field[j];
+      const vec4 interp0 = (field[0] * gphi + field[4] * fphi) * gr;
+      const vec4 interp1 = (field[1] * gphi + field[5] * fphi) * fr;
+      const vec4 interp2 = (field[2] * gphi + field[6] * fphi) * gr;
+      const vec4 interp3 = (field[3] * gphi + field[7] * fphi) * fr;
+      Bzrphi[j] = ((interp0 + interp1) * gz + (interp2 + interp3) * fz) * m_scale;
+    }
+
+    // convert (Bz,Br,Bphi) to (Bx,By,Bz).
+    // Points on the axis are redone below with the one point interpolation
+    vec4 rsafe;
+    CxxUtils::vselect(rsafe, rv, one, rv > zero);
+    const vec4 invr = 1.0 / rsafe;
+    const vec4 c = x * invr;
+    const vec4 s = y * invr;
+    const vec4 Bx = Bzrphi[1] * c - Bzrphi[2] * s;
+    const vec4 By = Bzrphi[1] * s + Bzrphi[2] * c;
+
+    const int m = std::min(W, n - i);
+    for (int k = 0; k < m; ++k) {
+      B[i + k][0] = Bx[k];
+      B[i + k][1] = By[k];
+      B[i + k][2] = Bzrphi[0][k];
+    }
+  }
+
+  for (int i = 0; i < n; ++i) {
+    if (!(r[i] > 0.0)) {
+      getB(xyz[i], r[i], phi[i], B[i]);
+    }
+  }
+}
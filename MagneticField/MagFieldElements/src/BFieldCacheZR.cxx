@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "MagFieldElements/BFieldCacheZR.h"
@@ -68,3 +68,36 @@ BFieldCacheZR::getB(const double* ATH_RESTRICT xyz,
   }
 }
 
+
+void
+BFieldCacheZR::getBN(int n,
+                     const double (*ATH_RESTRICT xyz)[3],
+                     const double* ATH_RESTRICT r,
+                     double (*ATH_RESTRICT B)[3],
+                     double (*ATH_RESTRICT deriv)[9]) const
+{
+  // the derivatives are only needed for the field gradient,
+  // use the one point interpolation for them
+  if (deriv) {
+    for (int i = 0; i < n; ++i) {
+      getB(xyz[i], r[i], B[i], deriv[i]);
+    }
+    return;
+  }
+  // same calculation as getB, with the 4 corners of the bin
+  // common to all the points
+  for (int i = 0; i < n; ++i) {
+    const double fz = (xyz[i][2] - m_zmin) * m_invz;
+    const double gz = 1.0 - fz;
+    const double fr = (r[i] - m_rmin) * m_invr;
+    const double gr = 1.0 - fr;
+    const double Bz = gz * (gr * m_field[0][0] + fr * m_field[0][1]) +
+                      fz * (gr * m_field[0][2] + fr * m_field[0][3]);
+    const double Br = gz * (gr * m_field[1][0] + fr * m_field[1][1]) +
+                      fz * (gr * m_field[1][2] + fr * m_field[1][3]);
+    const double invr = r[i] > 0.0 ? 1.0 / r[i] : 0.0;
+    B[i][0] = Br * (xyz[i][0] * invr);
+    B[i][1] = Br * (xyz[i][1] * invr);
+    B[i][2] = Bz;
+  }
+}
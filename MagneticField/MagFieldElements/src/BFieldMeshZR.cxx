@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 //
@@ -11,6 +11,8 @@
 //
 #include "MagFieldElements/BFieldMeshZR.h"
 
+#include <limits>
+
 //
 // Construct the look-up table to accelerate bin-finding.
 //
@@ -41,6 +43,36 @@ BFieldMeshZR::buildLUT()
   m_zoff = m_mesh[1].size(); // index offset for incrementing z by 1
 }
 
+//
+// Replace the field by 16-bit values in units of bscale.
+//
+bool
+BFieldMeshZR::compact(double bscale)
+{
+  if (!(bscale > 0.0) || isCompact()) {
+    return false;
+  }
+  const double maxValue = std::numeric_limits<short>::max();
+  std::vector<std::array<short, 2>> field;
+  field.reserve(m_field.size());
+  for (const BFieldVectorZR& f : m_field) {
+    std::array<short, 2> q;
+    for (int i = 0; i < 2; i++) { // z, r
+      const double v = std::round(f[i] / bscale);
+      if (!(std::abs(v) <= maxValue)) {
+        return false;
+      }
+      q[i] = static_cast<short>(v);
+    }
+    field.push_back(q);
+  }
+  m_compactField = std::move(field);
+  m_compactScale = bscale;
+  // release the double precision field
+  std::vector<BFieldVectorZR>().swap(m_field);
+  return true;
+}
+
 int
 BFieldMeshZR::memSize() const
 {
@@ -52,5 +84,6 @@ BFieldMeshZR::memSize() const
     size += sizeof(int) * m_LUT[i].capacity();
   }
   size += sizeof(BFieldVectorZR) * m_field.capacity();
+  size += sizeof(std::array<short, 2>) * m_compactField.capacity();
   return size;
 }
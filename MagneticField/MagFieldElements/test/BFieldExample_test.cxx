@@ -1,8 +1,9 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "MagFieldElements/BFieldCache.h"
+#include "MagFieldElements/BFieldMeshZR.h"
 #include "MagFieldElements/BFieldZone.h"
 #include <iostream>
 #include <unistd.h>
@@ -182,6 +183,12 @@ public:
     // get field std: i, bxyz_std 9 -2.6281e-07, -8.34762e-08, -0.00165093
     // get field new: i, bxyz_new 9 -2.6281e-07, -8.34762e-08, -0.00165093
 
+    // points and field, kept for the comparison with getBN
+    double xyzN[10][3];
+    double rN[10];
+    double phiN[10];
+    double bxyzOne[10][3];
+
     for (unsigned int i = 0; i < 10; ++i) {
       double r1 = r0 + 5 + i * 10.;
 
@@ -193,6 +200,13 @@ public:
       zone.getCache(z, r, phi, cache3d, 1);
       cache3d.getB(xyz, r1, phi, bxyz, nullptr);
 
+      for (int k = 0; k < 3; ++k) {
+        xyzN[i][k] = xyz[k];
+        bxyzOne[i][k] = bxyz[k];
+      }
+      rN[i] = r1;
+      phiN[i] = phi;
+
       std::cout << "get field std: i, bxyz " << i << " " << bxyz[0] << ", "
                 << bxyz[1] << ", " << bxyz[2] << " fractional diff gt 10^-5: "
                 << int(fabs(bxyz[0] - bxyz_std[0][i]) / bxyz[0] > 0.00001)
@@ -221,11 +235,96 @@ public:
       }
     }
 
+    // the same points interpolated together must give the same field
+    double bxyzN[10][3];
+    cache3d.getBN(10, xyzN, rN, phiN, bxyzN);
+    for (unsigned int i = 0; i < 10; ++i) {
+      for (int k = 0; k < 3; ++k) {
+        if (fabs(bxyzN[i][k] - bxyzOne[i][k]) >
+            1e-9 * fabs(bxyzOne[i][k]) + 1e-15) {
+          std::cout << "failed getBN comparison - i, k, b, b std " << i
+                    << ", " << k << ", " << bxyzN[i][k] << ", "
+                    << bxyzOne[i][k] << '\n';
+          status = 1;
+        }
+      }
+    }
+
     std::cout << "runTest: status " << status << '\n';
 
     return status;
   }
 
+  // compare a z-r mesh with its 16-bit version
+  static int runCompactZRTest()
+  {
+    const double bscale{ 1e-7 };
+    const int nmeshz{ 4 }, nmeshr{ 5 };
+    double meshz[] = { -1400, -466.93, 466.14, 1400 };
+    double meshr[] = { 0, 300, 600, 900, 1200 };
+
+    BFieldMeshZR mesh(meshz[0], meshz[nmeshz - 1], meshr[0], meshr[nmeshr - 1]);
+    mesh.reserve(nmeshz, nmeshr);
+    for (int j = 0; j < nmeshz; j++) {
+      mesh.appendMesh(0, meshz[j]);
+    }
+    for (int j = 0; j < nmeshr; j++) {
+      mesh.appendMesh(1, meshr[j]);
+    }
+    // smooth solenoid-like field, not on the 16-bit grid
+    for (int iz = 0; iz < nmeshz; iz++) {
+      for (int ir = 0; ir < nmeshr; ir++) {
+        const double z = meshz[iz];
+        const double r = meshr[ir];
+        mesh.appendField(BFieldVectorZR(0.002 - 1e-9 * r * r + 3.3e-11 * z,
+                                        -2e-10 * r * z + 1.7e-11));
+      }
+    }
+    mesh.buildLUT();
+
+    BFieldMeshZR compactMesh = mesh;
+    int status{ 0 };
+    if (!compactMesh.compact(bscale) || !compactMesh.isCompact() ||
+        compactMesh.nfield() != mesh.nfield()) {
+      std::cout << "failed to compact the z-r mesh" << '\n';
+      return 1;
+    }
+
+    // the field anywhere is within half a unit of the original
+    BFieldCacheZR cache;
+    BFieldCacheZR compactCache;
+    for (int i = 0; i <= 20; ++i) {
+      for (int j = 0; j <= 20; ++j) {
+        const double xyz[3] = { 60. * j, 0., -1400. + 140. * i };
+        double b[3];
+        double bCompact[3];
+        mesh.getCache(xyz[2], xyz[0], cache);
+        cache.getB(xyz, xyz[0], b);
+        compactMesh.getCache(xyz[2], xyz[0], compactCache);
+        compactCache.getB(xyz, xyz[0], bCompact);
+        for (int k = 0; k < 3; ++k) {
+          if (fabs(bCompact[k] - b[k]) > 0.5 * bscale * (1 + 1e-9)) {
+            std::cout << "failed compact z-r comparison - z, r, k, b, b std "
+                      << xyz[2] << ", " << xyz[0] << ", " << k << ", "
+                      << bCompact[k] << ", " << b[k] << '\n';
+            status = 1;
+          }
+        }
+      }
+    }
+
+    // values out of the 16-bit range are not compacted
+    BFieldMeshZR largeMesh = mesh;
+    if (largeMesh.compact(bscale * 1e-3) || largeMesh.isCompact()) {
+      std::cout << "compacted a mesh with values out of range" << '\n';
+      status = 1;
+    }
+
+    std::cout << "runCompactZRTest: status " << status << '\n';
+
+    return status;
+  }
+
 private:
 };
 
@@ -236,6 +335,7 @@ main()
   std::cout << "start BFieldExample test" << '\n';
 
   int status = BFieldTest::runTest(true);
+  status |= BFieldTest::runCompactZRTest();
 
   if (status == 0) {
     std::cout << "Test passed OK" << '\n';
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -375,6 +375,24 @@ MagField::AtlasFieldMapCondAlg::updateFieldMap(const EventContext& ctx,
                   << resolvedMapFile << "' does not end with .root");
     return StatusCode::FAILURE;
   }
+
+  // Share the map of a previous IOV if it is the same and still in use
+  const std::string mapKey = resolvedMapFile + " " +
+                             std::to_string(cache.m_mapSoleCurrent) + " " +
+                             std::to_string(cache.m_mapToroCurrent) + " " +
+                             std::to_string(m_compactFastMap.value());
+  {
+    std::lock_guard<std::mutex> lock(m_lastMapMutex);
+    if (m_lastMap.m_key == mapKey) {
+      cache.m_fieldMap = m_lastMap.m_fieldMap.lock();
+      if (cache.m_fieldMap) {
+        ATH_MSG_INFO("updateFieldMap: sharing the field map already read from "
+                     << resolvedMapFile);
+        return StatusCode::SUCCESS;
+      }
+    }
+  }
+
   TFile* rootfile = new TFile(resolvedMapFile.c_str(), "OLD");
   if (!rootfile) {
     ATH_MSG_ERROR("updateFieldMap: failed to open " << resolvedMapFile);
@@ -400,11 +418,13 @@ MagField::AtlasFieldMapCondAlg::updateFieldMap(const EventContext& ctx,
   }
 
   // create map
-  cache.m_fieldMap = std::make_unique<MagField::AtlasFieldMap>();
+  auto fieldMap = std::make_unique<MagField::AtlasFieldMap>();
 
   // initialize map
-  if (!cache.m_fieldMap->initializeMap(
-        rootfile, cache.m_mapSoleCurrent, cache.m_mapToroCurrent)) {
+  if (!fieldMap->initializeMap(rootfile,
+                               cache.m_mapSoleCurrent,
+                               cache.m_mapToroCurrent,
+                               m_compactFastMap)) {
     // failed to initialize the map
     ATH_MSG_ERROR(
       "updateFieldMap: unable to initialize the map for AtlasFieldMap for file "
@@ -418,7 +438,15 @@ MagField::AtlasFieldMapCondAlg::updateFieldMap(const EventContext& ctx,
   delete rootfile;
 
   ATH_MSG_INFO("updateFieldMap: Initialized the field map from "
-               << resolvedMapFile);
+               << resolvedMapFile << ", size " << fieldMap->memSize()
+               << " bytes");
+
+  cache.m_fieldMap = std::move(fieldMap);
+  {
+    std::lock_guard<std::mutex> lock(m_lastMapMutex);
+    m_lastMap.m_key = mapKey;
+    m_lastMap.m_fieldMap = cache.m_fieldMap;
+  }
 
   return StatusCode::SUCCESS;
 }
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 ///////////////////////////////////////////////////////////////////
@@ -12,11 +12,16 @@
 // FrameWork includes
 #include "AthenaBaseComps/AthReentrantAlgorithm.h"
 #include "AthenaPoolUtilities/CondAttrListCollection.h"
+#include "CxxUtils/checker_macros.h"
 #include "StoreGate/ReadCondHandleKey.h"
 #include "StoreGate/WriteCondHandleKey.h"
 
 #include "MagFieldConditions/AtlasFieldMapCondObj.h"
 
+#include <memory>
+#include <mutex>
+#include <string>
+
 namespace MagField {
 
 class AtlasFieldMapCondAlg : public AthReentrantAlgorithm
@@ -52,7 +57,7 @@ private:
       "MagneticFieldMaps/bfieldmap_0_20400_14m.root"
     }; // toroid on / solenoid off
     // field map - pointer and event id range
-    std::unique_ptr<MagField::AtlasFieldMap> m_fieldMap;
+    std::shared_ptr<const MagField::AtlasFieldMap> m_fieldMap;
 
     //"infinite in case we do not update from COOL"
     EventIDRange m_mapCondObjOutputRange{
@@ -120,6 +125,15 @@ private:
     "Load the magnetic field map at start"
   };
 
+  // flag to store the fast z-r solenoid map with 16-bit values
+  Gaudi::Property<bool> m_compactFastMap{
+    this,
+    "CompactFastMap",
+    false,
+    "Store the z-r solenoid map used by getFieldZR with 16-bit values, in "
+    "the units of the 3d map"
+  };
+
   // flag to read magnet map filenames from COOL
   Gaudi::Property<bool> m_useMapsFromCOOL{
     this,
@@ -156,6 +170,18 @@ private:
     "Name of the COOL folder containing magnet currents"
   };
 
+  /*
+   * The last map read. A new IOV needing the same map file and currents
+   * shares it, as long as a conditions object still holds it, instead of
+   * reading another copy.
+   */
+  struct LastMap
+  {
+    std::string m_key;
+    std::weak_ptr<const MagField::AtlasFieldMap> m_fieldMap;
+  };
+  mutable std::mutex m_lastMapMutex;
+  mutable LastMap m_lastMap ATLAS_THREAD_SAFE; // guarded by m_lastMapMutex
 };
 }
 
@@ -0,0 +1,107 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "FieldMapValidation.h"
+
+#include "MagFieldElements/BFieldCacheZR.h"
+#include "MagFieldElements/BFieldMeshZR.h"
+
+#include <algorithm>
+#include <cmath>
+
+MagField::FieldMapValidation::FieldMapValidation(const std::string& name, ISvcLocator* pSvcLocator) :
+  AthReentrantAlgorithm(name, pSvcLocator)
+{}
+
+StatusCode MagField::FieldMapValidation::initialize()
+{
+  ATH_CHECK(m_fieldMapKey.initialize());
+  if (m_stepsPerCell < 1) {
+    ATH_MSG_ERROR("StepsPerCell must be at least 1");
+    return StatusCode::FAILURE;
+  }
+
+  return StatusCode::SUCCESS;
+}
+
+StatusCode MagField::FieldMapValidation::execute(const EventContext& ctx) const
+{
+  if (m_done.exchange(true)) {
+    return StatusCode::SUCCESS;
+  }
+
+  SG::ReadCondHandle<AtlasFieldMapCondObj> rh{m_fieldMapKey, ctx};
+  const AtlasFieldMapCondObj* mapCondObj{*rh};
+  if (mapCondObj == nullptr) {
+    ATH_MSG_ERROR("Failed to retrieve AtlasFieldMapCondObj with key " << m_fieldMapKey.key());
+    return StatusCode::FAILURE;
+  }
+  const AtlasFieldMap* fieldMap = mapCondObj->fieldMap();
+  if (fieldMap == nullptr || fieldMap->getBFieldMesh() == nullptr) {
+    ATH_MSG_INFO("No field map (magnets off), nothing to validate");
+    return StatusCode::SUCCESS;
+  }
+
+  const BFieldMeshZR& mesh = *fieldMap->getBFieldMesh();
+  const std::unique_ptr<BFieldMeshZR> reference = fieldMap->makeMeshZR();
+  ATH_MSG_INFO("Field map size " << fieldMap->memSize() << " bytes, z-r map size " << mesh.memSize()
+               << " bytes (" << (mesh.isCompact() ? "16-bit" : "double") << "), double z-r map size "
+               << reference->memSize() << " bytes");
+
+  // largest difference of the Bz, Br components, at the nodes and everywhere
+  double maxNodeDiff[2] = {0, 0};
+  double maxDiff[2] = {0, 0};
+  double sumDiff2[2] = {0, 0};
+  long npoints = 0;
+  BFieldCacheZR cache;
+  BFieldCacheZR referenceCache;
+  const int nsteps = m_stepsPerCell;
+  for (unsigned iz = 0; iz + 1 < reference->nmesh(0); ++iz) {
+    const double z0 = reference->mesh(0, iz);
+    const double z1 = reference->mesh(0, iz + 1);
+    for (unsigned ir = 0; ir + 1 < reference->nmesh(1); ++ir) {
+      const double r0 = reference->mesh(1, ir);
+      const double r1 = reference->mesh(1, ir + 1);
+      // the last cells also take their upper edge
+      const int lastz = (iz + 2 == reference->nmesh(0)) ? nsteps : nsteps - 1;
+      const int lastr = (ir + 2 == reference->nmesh(1)) ? nsteps : nsteps - 1;
+      for (int i = 0; i <= lastz; ++i) {
+        for (int j = 0; j <= lastr; ++j) {
+          // point at phi = 0, so that Bx is Br
+          const double xyz[3] = {r0 + (r1 - r0) * j / nsteps, 0., z0 + (z1 - z0) * i / nsteps};
+          double b[3];
+          double bReference[3];
+          mesh.getCache(xyz[2], xyz[0], cache);
+          cache.getB(xyz, xyz[0], b);
+          reference->getCache(xyz[2], xyz[0], referenceCache);
+          referenceCache.getB(xyz, xyz[0], bReference);
+          const double diff[2] = {std::abs(b[2] - bReference[2]), std::abs(b[0] - bReference[0])};
+          for (int k = 0; k < 2; ++k) {
+            if (i == 0 && j == 0) {
+              maxNodeDiff[k] = std::max(maxNodeDiff[k], diff[k]);
+            }
+            maxDiff[k] = std::max(maxDiff[k], diff[k]);
+            sumDiff2[k] += diff[k] * diff[k];
+          }
+          ++npoints;
+        }
+      }
+    }
+  }
+
+  const double gauss = Gaudi::Units::gauss;
+  ATH_MSG_INFO("Compared " << npoints << " points of the z-r map (" << reference->nmesh(0) << " x "
+               << reference->nmesh(1) << " nodes)");
+  ATH_MSG_INFO("Bz difference (gauss): max at nodes " << maxNodeDiff[0] / gauss << ", max " << maxDiff[0] / gauss
+               << ", rms " << std::sqrt(sumDiff2[0] / npoints) / gauss);
+  ATH_MSG_INFO("Br difference (gauss): max at nodes " << maxNodeDiff[1] / gauss << ", max " << maxDiff[1] / gauss
+               << ", rms " << std::sqrt(sumDiff2[1] / npoints) / gauss);
+
+  if (maxDiff[0] > m_tolerance || maxDiff[1] > m_tolerance) {
+    ATH_MSG_ERROR("z-r map differs from the 3d map by more than " << m_tolerance / gauss << " gauss");
+    return StatusCode::FAILURE;
+  }
+
+  return StatusCode::SUCCESS;
+}
@@ -0,0 +1,45 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef MAGFIELDUTILS_FIELDMAPVALIDATION_H
+#define MAGFIELDUTILS_FIELDMAPVALIDATION_H
+
+#include "AthenaBaseComps/AthReentrantAlgorithm.h"
+#include "Gaudi/Property.h"
+#include "GaudiKernel/SystemOfUnits.h"
+#include "MagFieldConditions/AtlasFieldMapCondObj.h"
+#include "StoreGate/ReadCondHandleKey.h"
+
+#include <atomic>
+
+namespace MagField {
+
+  /**
+   * Validation of the fast z-r solenoid map stored in the field map
+   * conditions object (e.g. with AtlasFieldMapCondAlg.CompactFastMap)
+   * against the same map computed in double precision from the 3d map.
+   * The field is compared at the mesh nodes and inside the cells, once per job.
+   */
+  class FieldMapValidation : public AthReentrantAlgorithm {
+
+  public:
+    FieldMapValidation(const std::string& name, ISvcLocator* pSvcLocator);
+    StatusCode initialize() override;
+    StatusCode execute(const EventContext& ctx) const override;
+
+  private:
+    SG::ReadCondHandleKey<AtlasFieldMapCondObj> m_fieldMapKey{
+        this, "AtlasFieldMapCondObj", "fieldMapCondObj", "Magnetic field map conditions object key"};
+
+    Gaudi::Property<int> m_stepsPerCell{
+        this, "StepsPerCell", 4, "Number of points compared along z and r in each cell of the mesh"};
+    Gaudi::Property<double> m_tolerance{
+        this, "Tolerance", 1. * Gaudi::Units::gauss, "Maximum difference allowed for each field component"};
+
+    mutable std::atomic<bool> m_done{false};
+  };
+
+} // namespace MagField
+
+#endif
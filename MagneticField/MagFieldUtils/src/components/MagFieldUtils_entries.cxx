@@ -2,8 +2,10 @@
 #include "../SolenoidTest.h"
 #include "../IdentityManipulator.h"
 #include "../MagFieldCondReader.h"
+#include "../FieldMapValidation.h"
 
 DECLARE_COMPONENT( MagField::MagFieldTestbedAlg )
 DECLARE_COMPONENT( MagField::SolenoidTest )
 DECLARE_COMPONENT( MagField::IdentityManipulator )
 DECLARE_COMPONENT( MagField::CondReader )
+DECLARE_COMPONENT( MagField::FieldMapValidation )
@@ -1,4 +1,4 @@
-# Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 import sys
 
@@ -130,6 +130,9 @@ def fromRunArgs(runArgs):
     if flags.PerfMon.doFullMonMT or flags.PerfMon.doFastMonMT:
        from PerfMonComps.PerfMonCompsConfig import PerfMonMTSvcCfg
        cfg.merge(PerfMonMTSvcCfg(flags))
+    if flags.PerfMon.doEventTrace:
+       from PerfMonComps.PerfMonCompsConfig import EventTraceSvcCfg
+       cfg.merge(EventTraceSvcCfg(flags))
 
     # Write AMI tag into in-file metadata
     from PyUtils.AMITagHelperConfig import AMITagCfg
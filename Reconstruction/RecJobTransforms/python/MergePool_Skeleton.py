@@ -1,4 +1,4 @@
-# Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 def fromRunArgs(runArgs):
 
@@ -125,6 +125,9 @@ def fromRunArgs(runArgs):
     if flags.PerfMon.doFastMonMT or flags.PerfMon.doFullMonMT:
         from PerfMonComps.PerfMonCompsConfig import PerfMonMTSvcCfg
         cfg.merge(PerfMonMTSvcCfg(flags))
+    if flags.PerfMon.doEventTrace:
+        from PerfMonComps.PerfMonCompsConfig import EventTraceSvcCfg
+        cfg.merge(EventTraceSvcCfg(flags))
 
     # Set EventPrintoutInterval to 100 events
     cfg.getService(cfg.getAppProps()['EventLoop']).EventPrintoutInterval = 100
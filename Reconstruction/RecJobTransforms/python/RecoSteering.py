@@ -1,4 +1,4 @@
-# Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
 from AthenaConfiguration.Enums import Format, MetadataCategory, HIMode
@@ -285,6 +285,9 @@ def RecoSteering(flags):
         from PerfMonComps.PerfMonCompsConfig import PerfMonMTSvcCfg
         acc.merge(PerfMonMTSvcCfg(flags))
         log.info("---------- Configured PerfMon")
+    if flags.PerfMon.doEventTrace:
+        from PerfMonComps.PerfMonCompsConfig import EventTraceSvcCfg
+        acc.merge(EventTraceSvcCfg(flags))
     
     return acc
 
@@ -202,6 +202,9 @@ def DigitizationMainContentCfg(flags):
     if flags.PerfMon.doFastMonMT or flags.PerfMon.doFullMonMT:
         from PerfMonComps.PerfMonCompsConfig import PerfMonMTSvcCfg
         acc.merge(PerfMonMTSvcCfg(flags))
+    if flags.PerfMon.doEventTrace:
+        from PerfMonComps.PerfMonCompsConfig import EventTraceSvcCfg
+        acc.merge(EventTraceSvcCfg(flags))
 
     # Add in-file MetaData
     from xAODMetaDataCnv.InfileMetaDataConfig import SetupMetaDataForStreamCfg
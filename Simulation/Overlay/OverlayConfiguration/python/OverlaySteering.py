@@ -110,6 +110,9 @@ def OverlayMainContentCfg(configFlags):
     if configFlags.PerfMon.doFastMonMT or configFlags.PerfMon.doFullMonMT:
         from PerfMonComps.PerfMonCompsConfig import PerfMonMTSvcCfg
         acc.merge(PerfMonMTSvcCfg(configFlags))
+    if configFlags.PerfMon.doEventTrace:
+        from PerfMonComps.PerfMonCompsConfig import EventTraceSvcCfg
+        acc.merge(EventTraceSvcCfg(configFlags))
 
     # Track overlay
     if configFlags.Overlay.doTrackOverlay:
@@ -1,4 +1,4 @@
-# Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 
 # Possible cases:
 # 1) inputEVNTFile (normal)
@@ -140,6 +140,9 @@ def CommonSimulationCfg(flags, log):
     if flags.PerfMon.doFastMonMT or flags.PerfMon.doFullMonMT:
         from PerfMonComps.PerfMonCompsConfig import PerfMonMTSvcCfg
         cfg.merge(PerfMonMTSvcCfg(flags))
+    if flags.PerfMon.doEventTrace:
+        from PerfMonComps.PerfMonCompsConfig import EventTraceSvcCfg
+        cfg.merge(EventTraceSvcCfg(flags))
 
     # Add in-file MetaData
     from xAODMetaDataCnv.InfileMetaDataConfig import SetupMetaDataForStreamCfg
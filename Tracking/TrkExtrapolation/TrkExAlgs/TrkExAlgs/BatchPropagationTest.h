@@ -0,0 +1,98 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+///////////////////////////////////////////////////////////////////
+// BatchPropagationTest.h, (c) ATLAS Detector software
+///////////////////////////////////////////////////////////////////
+
+#ifndef TRKEXALGS_BATCHPROPAGATIONTEST_H
+#define TRKEXALGS_BATCHPROPAGATIONTEST_H
+
+// Gaudi includes
+#include "AthenaBaseComps/AthReentrantAlgorithm.h"
+#include "AthenaKernel/IAthRNGSvc.h"
+#include "CxxUtils/checker_macros.h"
+#include "Gaudi/Property.h"
+#include "GaudiKernel/ServiceHandle.h"
+#include "GaudiKernel/ToolHandle.h"
+#include "TrkExInterfaces/IPropagator.h"
+#include "TrkSurfaces/CylinderSurface.h"
+#include "TrkSurfaces/DiscSurface.h"
+#include "TrkSurfaces/PerigeeSurface.h"
+// STL
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace ATHRNG {
+  class RNGWrapper;
+}
+
+namespace Trk
+{
+  /** @class BatchPropagationTest
+
+     Benchmark of the propagation of a set of track parameters in one call
+     of the IPropagator (batched propagation) against their propagation one
+     after the other.
+
+     In each event random perigee parameters are propagated to a cylinder,
+     or to the disc closing it on the side of the track, as done for the
+     extrapolation of all the tracks to the calorimeter. The time spent in
+     both ways and the largest difference of the results are reported at
+     the end of the job.
+  */
+
+  class BatchPropagationTest : public AthReentrantAlgorithm
+    {
+    public:
+
+       /** Standard Athena-Algorithm Constructor */
+       BatchPropagationTest(const std::string& name, ISvcLocator* pSvcLocator);
+       /** Default Destructor */
+       ~BatchPropagationTest() = default;
+
+       /** standard Athena-Algorithm method */
+       StatusCode          initialize() override;
+       /** standard Athena-Algorithm method */
+       StatusCode          execute(const EventContext& ctx) const override;
+       /** standard Athena-Algorithm method */
+       StatusCode          finalize() override;
+
+    private:
+
+      /** The propagator to be tested */
+      ToolHandle<IPropagator> m_propagator{this, "Propagator", "Trk::RungeKuttaPropagator/RungeKuttaPropagator"};
+      ServiceHandle<IAthRNGSvc> m_rndmSvc{this, "RndmSvc", "AthRNGSvc"};
+      ATHRNG::RNGWrapper* m_randomEngine = nullptr;
+
+      Gaudi::Property<int>    m_tracksPerEvent{this, "TracksPerEvent", 1000, "Number of tracks propagated in each event"};
+      Gaudi::Property<double> m_sigmaD0{this, "StartPerigeeSigmaD0", 0.017, "Sigma of distribution for D0"};
+      Gaudi::Property<double> m_sigmaZ0{this, "StartPerigeeSigmaZ0", 50., "Sigma of distribution for Z0"};
+      Gaudi::Property<double> m_minEta{this, "StartPerigeeMinEta", -3., "Minimal eta value"};
+      Gaudi::Property<double> m_maxEta{this, "StartPerigeeMaxEta", 3., "Maximal eta value"};
+      Gaudi::Property<double> m_minPt{this, "StartPerigeeMinPt", 1000., "Minimal pt value"};
+      Gaudi::Property<double> m_maxPt{this, "StartPerigeeMaxPt", 100000., "Maximal pt value"};
+      Gaudi::Property<double> m_radius{this, "ReferenceSurfaceRadius", 1500., "Radius of the destination cylinder"};
+      Gaudi::Property<double> m_halfZ{this, "ReferenceSurfaceHalfZ", 3600., "Half length of the destination cylinder"};
+      Gaudi::Property<bool>   m_covariance{this, "TransportCovariance", true, "Propagate with covariance, otherwise parameters only"};
+
+      PerigeeSurface                    m_perigeeSurface;
+      std::unique_ptr<CylinderSurface>  m_cylinder;
+      std::unique_ptr<DiscSurface>      m_negativeDisc;
+      std::unique_ptr<DiscSurface>      m_positiveDisc;
+
+      /** statistics */
+      mutable std::atomic<long long>    m_nTracks{0};
+      mutable std::atomic<long long>    m_scalarNanoseconds{0};
+      mutable std::atomic<long long>    m_batchNanoseconds{0};
+      mutable std::atomic<long long>    m_scalarFailures{0};
+      mutable std::atomic<long long>    m_batchFailures{0};
+      mutable std::atomic<long long>    m_mismatches{0};
+      mutable std::mutex                m_mutex;
+      mutable double                    m_maxDistance ATLAS_THREAD_SAFE = 0.; //!< guarded by m_mutex
+    };
+} // end of namespace
+
+#endif
@@ -0,0 +1,154 @@
+/*
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
+*/
+
+///////////////////////////////////////////////////////////////////
+// BatchPropagationTest.cxx, (c) ATLAS Detector software
+///////////////////////////////////////////////////////////////////
+
+#include "TrkExAlgs/BatchPropagationTest.h"
+
+// Tracking
+#include "TrkEventPrimitives/ParticleHypothesis.h"
+#include "TrkGeometry/MagneticFieldProperties.h"
+#include "TrkParameters/TrackParameters.h"
+#include "AthenaKernel/RNGWrapper.h"
+#include "GaudiKernel/SystemOfUnits.h"
+
+// OTHER
+#include "CLHEP/Random/RandomEngine.h"
+#include "CLHEP/Random/RandGauss.h"
+#include "CLHEP/Random/RandFlat.h"
+
+// STL
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using xclock = std::chrono::steady_clock;
+
+//================ Constructor =================================================
+
+Trk::BatchPropagationTest::BatchPropagationTest(const std::string& name, ISvcLocator* pSvcLocator)
+  :
+  AthReentrantAlgorithm(name,pSvcLocator)
+{}
+
+//================ Initialisation =================================================
+
+StatusCode Trk::BatchPropagationTest::initialize()
+{
+  ATH_CHECK( m_propagator.retrieve() );
+  ATH_CHECK( m_rndmSvc.retrieve() );
+  m_randomEngine = m_rndmSvc->getEngine (this, "BatchPropagationTest");
+
+  m_cylinder = std::make_unique<Trk::CylinderSurface>(Amg::Transform3D(Amg::Translation3D(0.,0.,0.)), m_radius.value(), m_halfZ.value());
+  m_negativeDisc = std::make_unique<Trk::DiscSurface>(Amg::Transform3D(Amg::Translation3D(0.,0.,-m_halfZ.value())), 0., m_radius.value());
+  m_positiveDisc = std::make_unique<Trk::DiscSurface>(Amg::Transform3D(Amg::Translation3D(0.,0., m_halfZ.value())), 0., m_radius.value());
+  ATH_MSG_INFO("Propagating " << m_tracksPerEvent.value() << " tracks per event to R " << m_radius.value() << " Z " << m_halfZ.value());
+  return StatusCode::SUCCESS;
+}
+
+//================ Finalisation =================================================
+
+StatusCode Trk::BatchPropagationTest::finalize()
+{
+  const long long nTracks = m_nTracks;
+  if (nTracks == 0) return StatusCode::SUCCESS;
+  const double scalar = m_scalarNanoseconds * 1e-3 / nTracks;
+  const double batch = m_batchNanoseconds * 1e-3 / nTracks;
+  ATH_MSG_INFO("Propagation of " << nTracks << " tracks, per track: one by one " << scalar
+               << " us, batched " << batch << " us, speed-up " << (batch > 0. ? scalar / batch : 0.));
+  ATH_MSG_INFO("Failed propagations: one by one " << m_scalarFailures << ", batched " << m_batchFailures
+               << "; different outcome " << m_mismatches << ", largest position difference " << m_maxDistance << " mm");
+  return StatusCode::SUCCESS;
+}
+
+//================ Execution ====================================================
+
+StatusCode Trk::BatchPropagationTest::execute(const EventContext& ctx) const
+{
+  CLHEP::HepRandomEngine* engine = m_randomEngine->getEngine(ctx);
+  const Trk::MagneticFieldProperties fieldProperties(Trk::FullField);
+
+  // generate the perigees, sorted by destination surface
+  const double thetaPositive = std::atan2(m_radius.value(), m_halfZ.value());
+  const double thetaNegative = M_PI - thetaPositive;
+  const Trk::Surface* surfaces[3] = {m_negativeDisc.get(), m_cylinder.get(), m_positiveDisc.get()};
+  std::vector<std::unique_ptr<Trk::Perigee>> perigees;
+  std::vector<const Trk::TrackParameters*> parameters[3];
+  perigees.reserve(m_tracksPerEvent.value());
+  for (int track = 0; track < m_tracksPerEvent; ++track) {
+    const double d0 = CLHEP::RandGauss::shoot(engine) * m_sigmaD0.value();
+    const double z0 = CLHEP::RandGauss::shoot(engine) * m_sigmaZ0.value();
+    const double phi = M_PI * (2. * CLHEP::RandFlat::shoot(engine) - 1.);
+    const double eta = m_minEta.value() + CLHEP::RandFlat::shoot(engine) * (m_maxEta.value() - m_minEta.value());
+    const double pt = m_minPt.value() + CLHEP::RandFlat::shoot(engine) * (m_maxPt.value() - m_minPt.value());
+    const double charge = (CLHEP::RandFlat::shoot(engine) > 0.5) ? -1. : 1.;
+    const double theta = 2. * std::atan(std::exp(-eta));
+    const double qOverP = charge * std::sin(theta) / pt;
+
+    std::optional<AmgSymMatrix(5)> covariance = std::nullopt;
+    if (m_covariance) {
+      AmgSymMatrix(5) cov;
+      cov.setZero();
+      cov(0, 0) = 0.01;
+      cov(1, 1) = 0.1;
+      cov(2, 2) = 1e-6;
+      cov(3, 3) = 1e-6;
+      cov(4, 4) = 1e-4 * qOverP * qOverP;
+      covariance = cov;
+    }
+    perigees.push_back(std::make_unique<Trk::Perigee>(d0, z0, phi, theta, qOverP, m_perigeeSurface, std::move(covariance)));
+    const int surface = theta < thetaPositive ? 2 : theta > thetaNegative ? 0 : 1;
+    parameters[surface].push_back(perigees.back().get());
+  }
+
+  for (int surface = 0; surface < 3; ++surface) {
+    const std::vector<const Trk::TrackParameters*>& pars = parameters[surface];
+    if (pars.empty()) continue;
+    const Trk::Surface& destination = *surfaces[surface];
+
+    // one by one
+    std::vector<std::unique_ptr<Trk::TrackParameters>> single;
+    single.reserve(pars.size());
+    auto start = xclock::now();
+    for (const Trk::TrackParameters* par : pars) {
+      if (m_covariance) {
+        single.push_back(m_propagator->propagate(ctx, *par, destination, Trk::alongMomentum, false, fieldProperties, Trk::pion));
+      } else {
+        single.push_back(m_propagator->propagateParameters(ctx, *par, destination, Trk::alongMomentum, false, fieldProperties, Trk::pion));
+      }
+    }
+    auto end = xclock::now();
+    m_scalarNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    // batched
+    start = xclock::now();
+    std::vector<std::unique_ptr<Trk::TrackParameters>> batch = m_covariance ?
+      m_propagator->propagate(ctx, pars, destination, Trk::alongMomentum, false, fieldProperties, Trk::pion) :
+      m_propagator->propagateParameters(ctx, pars, destination, Trk::alongMomentum, false, fieldProperties, Trk::pion);
+    end = xclock::now();
+    m_batchNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    // comparison
+    double maxDistance = 0.;
+    for (size_t i = 0; i < pars.size(); ++i) {
+      if (!single[i]) ++m_scalarFailures;
+      if (!batch[i]) ++m_batchFailures;
+      if (!single[i] || !batch[i]) {
+        if (single[i] || batch[i]) ++m_mismatches;
+        continue;
+      }
+      const double distance = (single[i]->position() - batch[i]->position()).norm();
+      if (distance > maxDistance) maxDistance = distance;
+      ATH_MSG_VERBOSE("Track " << i << " one by one " << single[i]->parameters().transpose()
+                      << " batched " << batch[i]->parameters().transpose());
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (maxDistance > m_maxDistance) m_maxDistance = maxDistance;
+  }
+  m_nTracks += m_tracksPerEvent.value();
+
+  return StatusCode::SUCCESS;
+}
@@ -6,6 +6,7 @@
 #include "TrkExAlgs/EnergyLossExtrapolationValidation.h"
 #include "TrkExAlgs/RiddersAlgorithm.h"
 #include "TrkExAlgs/PropResultRootWriterSvc.h"
+#include "TrkExAlgs/BatchPropagationTest.h"
 
 
 using namespace Trk;
@@ -18,3 +19,4 @@ DECLARE_COMPONENT( EnergyLossExtrapolationValidation )
 DECLARE_COMPONENT( CombinedExtrapolatorTest )
 DECLARE_COMPONENT( CETmaterial )
 DECLARE_COMPONENT( PropResultRootWriterSvc )
+DECLARE_COMPONENT( BatchPropagationTest )
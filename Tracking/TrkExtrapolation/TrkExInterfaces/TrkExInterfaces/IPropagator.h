@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 ///////////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 #include <utility>
 #include <deque>
 #include <optional>
+#include <vector>
 
 namespace Trk {
 
@@ -182,6 +183,55 @@ public:
     bool returnCurv = false,
     const TrackingVolume* tVol = nullptr) const = 0;
 
+  /** Propagation of a set of track parameters to one surface, e.g. all the
+     tracks of an event to a calorimeter layer, with transport of their
+     covariances. Entries for which the propagation fails are nullptr.
+     Implementations may step the tracks together, the default propagates
+     them one after the other.
+    */
+  virtual std::vector<std::unique_ptr<TrackParameters>> propagate(
+    const EventContext& ctx,
+    const std::vector<const TrackParameters*>& parms,
+    const Surface& sf,
+    PropDirection dir,
+    const BoundaryCheck& bcheck,
+    const MagneticFieldProperties& mprop,
+    ParticleHypothesis particle = pion,
+    bool returnCurv = false) const
+  {
+    std::vector<std::unique_ptr<TrackParameters>> result;
+    result.reserve(parms.size());
+    for (const TrackParameters* parm : parms) {
+      result.push_back(parm ? propagate(ctx, *parm, sf, dir, bcheck, mprop,
+                                        particle, returnCurv)
+                            : nullptr);
+    }
+    return result;
+  }
+
+  /** Propagation of a set of track parameters to one surface, parameters
+     only, see above
+    */
+  virtual std::vector<std::unique_ptr<TrackParameters>> propagateParameters(
+    const EventContext& ctx,
+    const std::vector<const TrackParameters*>& parms,
+    const Surface& sf,
+    PropDirection dir,
+    const BoundaryCheck& bcheck,
+    const MagneticFieldProperties& mprop,
+    ParticleHypothesis particle = pion,
+    bool returnCurv = false) const
+  {
+    std::vector<std::unique_ptr<TrackParameters>> result;
+    result.reserve(parms.size());
+    for (const TrackParameters* parm : parms) {
+      result.push_back(parm ? propagateParameters(ctx, *parm, sf, dir, bcheck,
+                                                  mprop, particle, returnCurv)
+                            : nullptr);
+    }
+    return result;
+  }
+
   /** Intersection interface:
      The intersection interface might be used by the material service as well
      to estimate the surfaces (sensitive and nonesensitive) while propagation
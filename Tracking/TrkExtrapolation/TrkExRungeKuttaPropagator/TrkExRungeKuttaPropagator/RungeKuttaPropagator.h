@@ -1,5 +1,5 @@
 /*
-   Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+   Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
  */
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -18,6 +18,7 @@
 #include "TrkNeutralParameters/NeutralParameters.h"
 #include "TrkParameters/TrackParameters.h"
 #include <list>
+#include <vector>
 
 // MagField cache
 #include "MagFieldConditions/AtlasFieldCacheCondObj.h"
@@ -123,6 +124,12 @@ class PatternTrackParameters;
    CM  - charge/momentum            = local CM
 
 
+   A set of track parameters can be propagated to one surface in a single
+   call. The tracks are then stepped together: each stage of the Runge Kutta
+   step is computed for a batch of tracks, with one gathered field lookup per
+   stage, while the step size control stays per track. The result for each
+   track is the one of the single track propagation.
+
    @author Igor.Gavrilenko@cern.ch
    @authors RD Schaffer C Anastopoulos AthenaMT modifications
 */
@@ -226,6 +233,30 @@ public:
     bool,
     const TrackingVolume*) const override final;
 
+  /** Propagation of a set of track parameters and their covariances to one
+   * surface, all the tracks stepped together*/
+  virtual std::vector<std::unique_ptr<TrackParameters>> propagate(
+    const EventContext& ctx,
+    const std::vector<const TrackParameters*>&,
+    const Surface&,
+    const PropDirection,
+    const BoundaryCheck&,
+    const MagneticFieldProperties&,
+    ParticleHypothesis /*not used*/,
+    bool) const override final;
+
+  /** Propagation of a set of track parameters to one surface, parameters
+   * only, all the tracks stepped together*/
+  virtual std::vector<std::unique_ptr<TrackParameters>> propagateParameters(
+    const EventContext& ctx,
+    const std::vector<const TrackParameters*>&,
+    const Surface&,
+    const PropDirection,
+    const BoundaryCheck&,
+    const MagneticFieldProperties&,
+    ParticleHypothesis /*not used*/,
+    bool) const override final;
+
   /** Global position together with direction of the trajectory on the surface
    */
   virtual std::optional<Trk::TrackSurfaceIntersection> intersect(
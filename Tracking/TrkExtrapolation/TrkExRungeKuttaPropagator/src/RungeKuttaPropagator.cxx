@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2026 CERN for the benefit of the ATLAS collaboration
 */
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,9 @@
 
 #include "CxxUtils/restrict.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace {
 /*
  * All internal implementation methods
@@ -828,6 +831,537 @@ bool propagateWithJacobianSwitch(Cache& cache,
   }
 }
 
+/////////////////////////////////////////////////////////////////////////////////
+// Batched propagation of several tracks to one surface.
+// The tracks are stepped together: each Runge Kutta stage is computed for all
+// the tracks of the batch, with one gathered field lookup per stage, while the
+// step size control stays per track, as in propagateWithJacobian.
+/////////////////////////////////////////////////////////////////////////////////
+
+// Max number of tracks in one batched Runge Kutta step
+constexpr int batchWidth = 8;
+
+// State of one track in the batched propagation: the local variables of
+// propagateWithJacobian and the field members of the Cache
+struct BatchLane
+{
+  double P[64];
+  double Su[9];    // surface parameters, modified by the step estimator
+  double R0[3];    // start position, for the cylinder cross point test
+  double field[3]; // field at the end of the last step
+  double W = 0.;
+  double Step = 0.;
+  double S = 0.;
+  double So = 0.;
+  int kind = 0;
+  int iS = 0;
+  int niter = 0;
+  bool dir = true;
+  bool InS = false;
+  bool newfield = true;
+  bool maxPathLimit = false;
+  bool stepping = false;
+  bool status = false;
+};
+
+void
+getFieldN(Cache& cache,
+          int n,
+          const double (*ATH_RESTRICT R)[3],
+          double (*ATH_RESTRICT H)[3])
+{
+  if (cache.m_solenoid) {
+    cache.m_fieldCache.getFieldZRN(n, R, H);
+  } else {
+    cache.m_fieldCache.getFieldN(n, R, H);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+// Runge Kutta step for up to batchWidth tracks, the algorithm of
+// rungeKuttaStep with each quantity stored for all the tracks
+// (index [component][track]), so that the stages are computed for all the
+// tracks in one loop. Steps failing the accuracy test are halved and redone
+// together with the other failed tracks of the batch.
+/////////////////////////////////////////////////////////////////////////////////
+void
+rungeKuttaStepBatch(Cache& cache, bool Jac, int n, BatchLane* const* L)
+{
+  // The stages are computed for all the batchWidth slots, the unused ones
+  // being zero, which gives loops of fixed length the compiler can vectorise
+  constexpr int W = batchWidth;
+  double R[3][W] = {}, A[3][W] = {};
+  double f0[3][W] = {}, f1[3][W], f2[3][W];
+  double H0[3][W], H1[3][W], H2[3][W];
+  double A0[3][W], A1[3][W], A2[3][W], A3[3][W], A4[3][W], A5[3][W], A6[3][W];
+  double S[W] = {}, Pi[W] = {}, dltm[W], EST[W];
+  bool helix[W], pending[W];
+
+  // Points of the gathered field lookups and their track
+  double gP[W][3], gH[W][3];
+  int gI[W];
+  int m = 0;
+
+  int npending = 0;
+  for (int i = 0; i != n; ++i) {
+    const BatchLane& l = *L[i];
+    for (int k = 0; k != 3; ++k) {
+      R[k][i] = l.P[k];
+      A[k][i] = l.P[k + 3];
+    }
+    S[i] = l.S;
+    Pi[i] = 149.89626 * l.P[6]; // Invert mometum/2.
+    dltm[i] = cache.m_dlt * .03;
+    helix[i] = std::abs(S[i]) < cache.m_helixStep;
+    pending[i] = S[i] != 0.;
+    if (pending[i])
+      ++npending;
+    if (l.newfield) {
+      for (int k = 0; k != 3; ++k)
+        gP[m][k] = R[k][i];
+      gI[m++] = i;
+    } else {
+      for (int k = 0; k != 3; ++k)
+        f0[k][i] = l.field[k];
+    }
+  }
+  getFieldN(cache, m, gP, gH);
+  for (int j = 0; j != m; ++j) {
+    for (int k = 0; k != 3; ++k)
+      f0[k][gI[j]] = gH[j][k];
+  }
+  // helix model: field of the start point for the whole step
+  for (int k = 0; k != 3; ++k) {
+    for (int i = 0; i != W; ++i) {
+      f1[k][i] = f0[k][i];
+      f2[k][i] = f0[k][i];
+    }
+  }
+
+  while (npending) {
+
+    // First point
+    //
+    for (int i = 0; i != W; ++i) {
+      const double PS2 = Pi[i] * S[i];
+      H0[0][i] = f0[0][i] * PS2;
+      H0[1][i] = f0[1][i] * PS2;
+      H0[2][i] = f0[2][i] * PS2;
+      A0[0][i] = A[1][i] * H0[2][i] - A[2][i] * H0[1][i];
+      A0[1][i] = A[2][i] * H0[0][i] - A[0][i] * H0[2][i];
+      A0[2][i] = A[0][i] * H0[1][i] - A[1][i] * H0[0][i];
+      for (int k = 0; k != 3; ++k) {
+        A2[k][i] = A0[k][i] + A[k][i];
+        A1[k][i] = A2[k][i] + A[k][i];
+      }
+    }
+
+    // Second point
+    //
+    m = 0;
+    for (int i = 0; i != n; ++i) {
+      if (!pending[i] || helix[i])
+        continue;
+      const double S4 = .25 * S[i];
+      for (int k = 0; k != 3; ++k)
+        gP[m][k] = R[k][i] + A1[k][i] * S4;
+      gI[m++] = i;
+    }
+    getFieldN(cache, m, gP, gH);
+    for (int j = 0; j != m; ++j) {
+      for (int k = 0; k != 3; ++k)
+        f1[k][gI[j]] = gH[j][k];
+    }
+
+    for (int i = 0; i != W; ++i) {
+      const double PS2 = Pi[i] * S[i];
+      H1[0][i] = f1[0][i] * PS2;
+      H1[1][i] = f1[1][i] * PS2;
+      H1[2][i] = f1[2][i] * PS2;
+      A3[0][i] = (A[0][i] + A2[1][i] * H1[2][i]) - A2[2][i] * H1[1][i];
+      A3[1][i] = (A[1][i] + A2[2][i] * H1[0][i]) - A2[0][i] * H1[2][i];
+      A3[2][i] = (A[2][i] + A2[0][i] * H1[1][i]) - A2[1][i] * H1[0][i];
+      A4[0][i] = (A[0][i] + A3[1][i] * H1[2][i]) - A3[2][i] * H1[1][i];
+      A4[1][i] = (A[1][i] + A3[2][i] * H1[0][i]) - A3[0][i] * H1[2][i];
+      A4[2][i] = (A[2][i] + A3[0][i] * H1[1][i]) - A3[1][i] * H1[0][i];
+      for (int k = 0; k != 3; ++k)
+        A5[k][i] = 2. * A4[k][i] - A[k][i];
+    }
+
+    // Last point
+    //
+    m = 0;
+    for (int i = 0; i != n; ++i) {
+      if (!pending[i] || helix[i])
+        continue;
+      for (int k = 0; k != 3; ++k)
+        gP[m][k] = R[k][i] + S[i] * A4[k][i];
+      gI[m++] = i;
+    }
+    getFieldN(cache, m, gP, gH);
+    for (int j = 0; j != m; ++j) {
+      for (int k = 0; k != 3; ++k)
+        f2[k][gI[j]] = gH[j][k];
+    }
+
+    for (int i = 0; i != W; ++i) {
+      const double PS2 = Pi[i] * S[i];
+      H2[0][i] = f2[0][i] * PS2;
+      H2[1][i] = f2[1][i] * PS2;
+      H2[2][i] = f2[2][i] * PS2;
+      A6[0][i] = A5[1][i] * H2[2][i] - A5[2][i] * H2[1][i];
+      A6[1][i] = A5[2][i] * H2[0][i] - A5[0][i] * H2[2][i];
+      A6[2][i] = A5[0][i] * H2[1][i] - A5[1][i] * H2[0][i];
+
+      // Test approximation quality on give step
+      //
+      EST[i] = std::abs((A1[0][i] + A6[0][i]) - (A3[0][i] + A4[0][i])) +
+               std::abs((A1[1][i] + A6[1][i]) - (A3[1][i] + A4[1][i])) +
+               std::abs((A1[2][i] + A6[2][i]) - (A3[2][i] + A4[2][i]));
+    }
+
+    for (int i = 0; i != n; ++i) {
+      if (!pending[i])
+        continue;
+
+      // Possible step reduction
+      //
+      if (EST[i] > cache.m_dlt) {
+        S[i] *= .5;
+        dltm[i] = 0.;
+        if (S[i] == 0.) {
+          L[i]->S = 0.;
+          pending[i] = false;
+          --npending;
+        }
+        continue;
+      }
+
+      // Parameters calculation
+      //
+      BatchLane& l = *L[i];
+      double* P = l.P;
+      double* Rl = &P[0];
+      double* Al = &P[3];
+      double* sA = &P[42];
+      l.InS = EST[i] < dltm[i];
+
+      const double S3 = (1. / 3.) * S[i];
+      Al[0] = 2. * A3[0][i] + (A0[0][i] + A5[0][i] + A6[0][i]);
+      Al[1] = 2. * A3[1][i] + (A0[1][i] + A5[1][i] + A6[1][i]);
+      Al[2] = 2. * A3[2][i] + (A0[2][i] + A5[2][i] + A6[2][i]);
+
+      double D = (Al[0] * Al[0] + Al[1] * Al[1]) + (Al[2] * Al[2] - 9.);
+      const double Sl = 2. / S[i];
+      D = (1. / 3.) - ((1. / 648.) * D) * (12. - D);
+
+      for (int k = 0; k != 3; ++k) {
+        Rl[k] += (A2[k][i] + A3[k][i] + A4[k][i]) * S3;
+        Al[k] *= D;
+        sA[k] = A6[k][i] * Sl;
+        l.field[k] = f2[k][i];
+      }
+      l.newfield = false;
+      l.S = S[i];
+      pending[i] = false;
+      --npending;
+
+      if (!Jac)
+        continue;
+
+      // Jacobian calculation, as in rungeKuttaStep
+      const double Aarr[3]{ A[0][i], A[1][i], A[2][i] };
+      const double A0arr[3]{ A0[0][i], A0[1][i], A0[2][i] };
+      const double A3arr[3]{ A3[0][i], A3[1][i], A3[2][i] };
+      const double A4arr[3]{ A4[0][i], A4[1][i], A4[2][i] };
+      const double A6arr[3]{ A6[0][i], A6[1][i], A6[2][i] };
+      const double H0arr[3]{ H0[0][i], H0[1][i], H0[2][i] };
+      const double H1arr[3]{ H1[0][i], H1[1][i], H1[2][i] };
+      const double H2arr[3]{ H2[0][i], H2[1][i], H2[2][i] };
+      Trk::propJacobian(
+        P, H0arr, H1arr, H2arr, Aarr, A0arr, A3arr, A4arr, A6arr, S3);
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+// Start of the batched propagation of one track, see propagateWithJacobian
+/////////////////////////////////////////////////////////////////////////////////
+void
+startBatchLane(Cache& cache, BatchLane& l)
+{
+  const double Smax = 1000.; // max. step allowed
+  double* SA = &l.P[42];
+  SA[0] = SA[1] = SA[2] = 0.;
+  l.maxPathLimit = false;
+  l.stepping = false;
+  l.status = false;
+
+  if (cache.m_mcondition && std::abs(l.P[6]) > .1)
+    return;
+
+  // Step estimation until surface
+  //
+  bool Q = false;
+  l.Step = Trk::RungeKuttaUtils::stepEstimator(l.kind, l.Su, l.P, Q);
+  if (!Q)
+    return;
+
+  l.dir = true;
+  if (cache.m_mcondition && cache.m_direction && cache.m_direction * l.Step < 0.) {
+    l.Step = -l.Step;
+    l.dir = false;
+  }
+
+  l.Step > Smax ? l.S = Smax : l.Step < -Smax ? l.S = -Smax : l.S = l.Step;
+  l.So = std::abs(l.S);
+  l.iS = 0;
+  l.niter = 0;
+  l.InS = false;
+  l.newfield = true;
+  l.stepping = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+// Step size control of one track after a batched step, see
+// propagateWithJacobian. Returns 1 to go on stepping, 0 when the last straight
+// step to the surface is to be done, -1 if the surface can not be reached
+/////////////////////////////////////////////////////////////////////////////////
+int
+stepBatchLane(Cache& cache, BatchLane& l)
+{
+  const double Wwrong = 500.; // Max way with wrong direction
+
+  bool Q = false;
+  l.Step = stepEstimatorWithCurvature(cache, l.kind, l.Su, l.P, Q);
+  if (!Q)
+    return -1;
+
+  if (!l.dir) {
+    if (cache.m_direction && cache.m_direction * l.Step < 0.)
+      l.Step = -l.Step;
+    else
+      l.dir = true;
+  }
+
+  if (l.S * l.Step < 0.) {
+    l.S = -l.S;
+    ++l.iS;
+  }
+
+  const double aS = std::abs(l.S);
+  const double aStep = std::abs(l.Step);
+  if (aS > aStep)
+    l.S = l.Step;
+  else if (!l.iS && l.InS && aS * 2. < aStep)
+    l.S *= 2.;
+  if (!l.dir && std::abs(l.W) > Wwrong)
+    return -1;
+
+  if (l.iS > 10 || (l.iS > 3 && std::abs(l.S) >= l.So)) {
+    if (!l.kind)
+      return 0;
+    return -1;
+  }
+  const double dW = cache.m_maxPath - std::abs(l.W);
+  if (std::abs(l.S) > dW) {
+    l.S > 0. ? l.S = dW : l.S = -dW;
+    l.Step = l.S;
+    l.maxPathLimit = true;
+  }
+  l.So = std::abs(l.S);
+  return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+// Last straight step of one track to the surface, see propagateWithJacobian
+/////////////////////////////////////////////////////////////////////////////////
+void
+finishBatchLane(BatchLane& l)
+{
+  l.stepping = false;
+  l.status = true;
+  l.W += l.Step;
+
+  if (std::abs(l.Step) < .001)
+    return;
+
+  const double Step = l.Step;
+  double* R = &l.P[0];
+  double* A = &l.P[3];
+  const double* SA = &l.P[42];
+  A[0] += (SA[0] * Step);
+  A[1] += (SA[1] * Step);
+  A[2] += (SA[2] * Step);
+  const double CBA = 1. / std::sqrt(A[0] * A[0] + A[1] * A[1] + A[2] * A[2]);
+
+  R[0] += Step * (A[0] - .5 * Step * SA[0]);
+  A[0] *= CBA;
+  R[1] += Step * (A[1] - .5 * Step * SA[1]);
+  A[1] *= CBA;
+  R[2] += Step * (A[2] - .5 * Step * SA[2]);
+  A[2] *= CBA;
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+// Test of the loop condition of propagateWithJacobian for one track: returns
+// true if it needs a further step, otherwise the track is finished or failed
+/////////////////////////////////////////////////////////////////////////////////
+bool
+nextStepBatchLane(Cache& cache, BatchLane& l)
+{
+  if (!(std::abs(l.Step) > cache.m_straightStep)) {
+    finishBatchLane(l);
+    return false;
+  }
+  if (++l.niter > 10000) {
+    l.stepping = false;
+    return false;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+// Runge Kutta main program for the batched propagation with or without
+// Jacobian. Up to batchWidth tracks are stepped together; a track which
+// reached the surface, or failed, is replaced by the next one, so that the
+// batch stays full and each track keeps the locality of its field lookups.
+// The field gradient variant of the step is not supported.
+/////////////////////////////////////////////////////////////////////////////////
+void
+propagateWithJacobianBatch(Cache& cache, bool Jac, const std::vector<BatchLane*>& lanes)
+{
+  BatchLane* active[batchWidth];
+  int n = 0;
+  size_t next = 0;
+  while (true) {
+
+    while (n != batchWidth && next != lanes.size()) {
+      BatchLane* l = lanes[next++];
+      startBatchLane(cache, *l);
+      if (l->stepping && nextStepBatchLane(cache, *l))
+        active[n++] = l;
+    }
+    if (!n)
+      break;
+
+    if (cache.m_mcondition) {
+      rungeKuttaStepBatch(cache, Jac, n, active);
+    } else {
+      for (int i = 0; i != n; ++i)
+        straightLineStep(Jac, active[i]->S, active[i]->P);
+    }
+
+    int m = 0;
+    for (int i = 0; i != n; ++i) {
+      BatchLane* l = active[i];
+      l->W += l->S;
+      const int control = stepBatchLane(cache, *l);
+      if (control < 0)
+        l->stepping = false;
+      else if (control == 0)
+        finishBatchLane(*l);
+      else if (nextStepBatchLane(cache, *l))
+        active[m++] = l;
+    }
+    n = m;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+// Batched propagation to the surface Su, the counterpart of
+// propagateWithJacobianSwitch. The status of each track tells whether it
+// reached the surface, W holds its path length
+/////////////////////////////////////////////////////////////////////////////////
+void
+propagateWithJacobianSwitchBatch(Cache& cache,
+                                 const Trk::Surface& Su,
+                                 bool useJac,
+                                 const std::vector<BatchLane*>& lanes)
+{
+  const Amg::Transform3D& T = Su.transform();
+  double s[9] = {};
+  int kind = 0;
+
+  switch (Su.type()) {
+    case Trk::SurfaceType::Line:
+    case Trk::SurfaceType::Perigee: {
+      const double sl[6] = {T(0, 3), T(1, 3), T(2, 3), T(0, 2), T(1, 2), T(2, 2)};
+      std::copy(sl, sl + 6, s);
+      kind = 0;
+      break;
+    }
+    case Trk::SurfaceType::Plane:
+    case Trk::SurfaceType::Disc: {
+      const double d =
+          T(0, 3) * T(0, 2) + T(1, 3) * T(1, 2) + T(2, 3) * T(2, 2);
+
+      if (d >= 0.) {
+        s[0] = T(0, 2);
+        s[1] = T(1, 2);
+        s[2] = T(2, 2);
+        s[3] = d;
+      } else {
+        s[0] = -T(0, 2);
+        s[1] = -T(1, 2);
+        s[2] = -T(2, 2);
+        s[3] = -d;
+      }
+      kind = 1;
+      break;
+    }
+    case Trk::SurfaceType::Cylinder: {
+      const Trk::CylinderSurface* cyl =
+          static_cast<const Trk::CylinderSurface*>(&Su);
+      const double sc[9] = {T(0, 3),           T(1, 3),           T(2, 3),
+                            T(0, 2),           T(1, 2),           T(2, 2),
+                            cyl->bounds().r(), cache.m_direction, 0.};
+      std::copy(sc, sc + 9, s);
+      kind = 2;
+      break;
+    }
+    case Trk::SurfaceType::Cone: {
+      double k = static_cast<const Trk::ConeSurface*>(&Su)->bounds().tanAlpha();
+      k = k * k + 1.;
+      const double sc[9] = {T(0, 3), T(1, 3), T(2, 3),           T(0, 2), T(1, 2),
+                            T(2, 2), k,       cache.m_direction, 0.};
+      std::copy(sc, sc + 9, s);
+      kind = 3;
+      break;
+    }
+    default: {
+      for (BatchLane* l : lanes)
+        l->status = false;
+      return;
+    }
+  }
+
+  for (BatchLane* l : lanes) {
+    std::copy(s, s + 9, l->Su);
+    std::copy(l->P, l->P + 3, l->R0);
+    l->kind = kind;
+    l->W = 0.;
+  }
+  propagateWithJacobianBatch(cache, useJac, lanes);
+
+  // For cylinder we do test for next cross point
+  if (kind == 2) {
+    const Trk::CylinderSurface* cyl =
+        static_cast<const Trk::CylinderSurface*>(&Su);
+    if (cyl->bounds().halfPhiSector() < 3.1) {
+      std::vector<BatchLane*> cross;
+      for (BatchLane* l : lanes) {
+        if (l->status && newCrossPoint(*cyl, l->R0, l->P)) {
+          l->Su[8] = 0.;
+          cross.push_back(l);
+        }
+      }
+      if (!cross.empty())
+        propagateWithJacobianBatch(cache, useJac, cross);
+    }
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 // Main function for neutral track parameters propagation with or without jacobian
 /////////////////////////////////////////////////////////////////////////////////
@@ -1146,49 +1680,21 @@ globalTwoSidePositions(Cache& cache,
   }
 }
 /////////////////////////////////////////////////////////////////////////////////
-// Main function for charged track parameters propagation with or without
-// jacobian
+// Track parameters on the destination surface from the propagated global
+// parameters P, common to the single track and the batched propagation
 /////////////////////////////////////////////////////////////////////////////////
 std::unique_ptr<Trk::TrackParameters>
-propagateRungeKutta(Cache& cache,
-                    bool useJac,
-                    const Trk::TrackParameters& Tp,
-                    const Trk::Surface& Su,
-                    Trk::PropDirection D,
-                    const Trk::BoundaryCheck& B,
-                    const Trk::MagneticFieldProperties& M,
-                    double* Jac,
-                    bool returnCurv)
+trackParametersOnSurface(bool useJac,
+                         bool maxPathLimit,
+                         const Trk::TrackParameters& Tp,
+                         const Trk::Surface& Su,
+                         const Trk::BoundaryCheck& B,
+                         double* ATH_RESTRICT P,
+                         double* ATH_RESTRICT Jac,
+                         bool returnCurv)
 {
   const Trk::Surface* su = &Su;
 
-  cache.m_direction = D;
-
-  M.magneticFieldMode() == Trk::FastField ? cache.m_solenoid = true
-                                          : cache.m_solenoid = false;
-  (useJac && cache.m_usegradient) ? cache.m_needgradient = true
-                                  : cache.m_needgradient = false;
-  M.magneticFieldMode() != Trk::NoField ? cache.m_mcondition = true
-                                        : cache.m_mcondition = false;
-
-  if (su == &Tp.associatedSurface())
-    return buildTrackParametersWithoutPropagation(Tp, Jac);
-
-  double P[64];
-  double Step = 0.;
-  if (!Trk::RungeKuttaUtils::transformLocalToGlobal(useJac, Tp, P)){
-    return nullptr;
-  }
-
-  if (!propagateWithJacobianSwitch(cache,Su,useJac,P,Step)){
-    return nullptr;
-  }
-
-  if (cache.m_direction && (cache.m_direction * Step) < 0.) {
-    return nullptr;
-  }
-  cache.m_step = Step;
-
   // Common transformation for all surfaces (angles and momentum)
   //
   if (useJac) {
@@ -1201,7 +1707,7 @@ propagateRungeKutta(Cache& cache,
     P[40] *= p;
   }
 
-  if (cache.m_maxPathLimit)
+  if (maxPathLimit)
     returnCurv = true;
 
   bool uJ = useJac;
@@ -1251,6 +1757,117 @@ propagateRungeKutta(Cache& cache,
   }
 }
 
+/////////////////////////////////////////////////////////////////////////////////
+// Main function for charged track parameters propagation with or without
+// jacobian
+/////////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<Trk::TrackParameters>
+propagateRungeKutta(Cache& cache,
+                    bool useJac,
+                    const Trk::TrackParameters& Tp,
+                    const Trk::Surface& Su,
+                    Trk::PropDirection D,
+                    const Trk::BoundaryCheck& B,
+                    const Trk::MagneticFieldProperties& M,
+                    double* Jac,
+                    bool returnCurv)
+{
+  const Trk::Surface* su = &Su;
+
+  cache.m_direction = D;
+
+  M.magneticFieldMode() == Trk::FastField ? cache.m_solenoid = true
+                                          : cache.m_solenoid = false;
+  (useJac && cache.m_usegradient) ? cache.m_needgradient = true
+                                  : cache.m_needgradient = false;
+  M.magneticFieldMode() != Trk::NoField ? cache.m_mcondition = true
+                                        : cache.m_mcondition = false;
+
+  if (su == &Tp.associatedSurface())
+    return buildTrackParametersWithoutPropagation(Tp, Jac);
+
+  double P[64];
+  double Step = 0.;
+  if (!Trk::RungeKuttaUtils::transformLocalToGlobal(useJac, Tp, P)){
+    return nullptr;
+  }
+
+  if (!propagateWithJacobianSwitch(cache,Su,useJac,P,Step)){
+    return nullptr;
+  }
+
+  if (cache.m_direction && (cache.m_direction * Step) < 0.) {
+    return nullptr;
+  }
+  cache.m_step = Step;
+
+  return trackParametersOnSurface(
+    useJac, cache.m_maxPathLimit, Tp, Su, B, P, Jac, returnCurv);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+// Main function for the batched charged track parameters propagation with or
+// without jacobian, giving for each track the result of propagateRungeKutta
+/////////////////////////////////////////////////////////////////////////////////
+std::vector<std::unique_ptr<Trk::TrackParameters>>
+propagateRungeKuttaBatch(Cache& cache,
+                         bool useJac,
+                         const std::vector<const Trk::TrackParameters*>& Tp,
+                         const Trk::Surface& Su,
+                         Trk::PropDirection D,
+                         const Trk::BoundaryCheck& B,
+                         const Trk::MagneticFieldProperties& M,
+                         bool returnCurv)
+{
+  std::vector<std::unique_ptr<Trk::TrackParameters>> result(Tp.size());
+  double Jac[25];
+
+  // The field gradient variant of the step is not batched
+  if (useJac && cache.m_usegradient) {
+    for (size_t i = 0; i != Tp.size(); ++i) {
+      if (Tp[i])
+        result[i] = propagateRungeKutta(cache, useJac, *Tp[i], Su, D, B, M, Jac, returnCurv);
+    }
+    return result;
+  }
+
+  cache.m_direction = D;
+  cache.m_needgradient = false;
+
+  M.magneticFieldMode() == Trk::FastField ? cache.m_solenoid = true
+                                          : cache.m_solenoid = false;
+  M.magneticFieldMode() != Trk::NoField ? cache.m_mcondition = true
+                                        : cache.m_mcondition = false;
+
+  std::vector<BatchLane> lanes(Tp.size());
+  std::vector<BatchLane*> toPropagate;
+  toPropagate.reserve(Tp.size());
+  for (size_t i = 0; i != Tp.size(); ++i) {
+    if (!Tp[i])
+      continue;
+    if (&Su == &Tp[i]->associatedSurface()) {
+      result[i] = buildTrackParametersWithoutPropagation(*Tp[i], Jac);
+      continue;
+    }
+    if (!Trk::RungeKuttaUtils::transformLocalToGlobal(useJac, *Tp[i], lanes[i].P))
+      continue;
+    toPropagate.push_back(&lanes[i]);
+  }
+
+  propagateWithJacobianSwitchBatch(cache, Su, useJac, toPropagate);
+
+  for (size_t i = 0; i != Tp.size(); ++i) {
+    BatchLane& l = lanes[i];
+    if (!l.status)
+      continue;
+    if (cache.m_direction && (cache.m_direction * l.W) < 0.)
+      continue;
+    result[i] = trackParametersOnSurface(
+      useJac, l.maxPathLimit, *Tp[i], Su, B, l.P, Jac, returnCurv);
+  }
+  return result;
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 // Main function for simple track propagation with or without jacobian
 // Ta->Su = Tb for pattern track parameters
@@ -1460,28 +2077,27 @@ Trk::RungeKuttaPropagator::multiStatePropagate(
 {
   Cache cache = getInitializedCache(ctx);
 
+  // The components are propagated together
+  std::vector<const Trk::TrackParameters*> parameters;
+  parameters.reserve(multiComponentState.size());
+  for (const Trk::ComponentParameters& component : multiComponentState) {
+    parameters.push_back(component.params.get());
+  }
+  std::vector<std::unique_ptr<Trk::TrackParameters>> propagatedParameters =
+      propagateRungeKuttaBatch(cache, true, parameters, surface, direction,
+                               boundaryCheck, fieldProperties, false);
+
   Trk::MultiComponentState propagatedState{};
   propagatedState.reserve(multiComponentState.size());
   double sumw(0);  // sum of the weights of the propagated parameters
-  double J[25];
-  Trk::MultiComponentState::const_iterator component =
-      multiComponentState.begin();
-  for (; component != multiComponentState.end(); ++component) {
-    const Trk::TrackParameters* currentParameters = component->params.get();
-    if (!currentParameters) {
-      continue;
-    }
-    auto propagatedParameters =
-        propagateRungeKutta(cache, true, *currentParameters, surface, direction,
-                            boundaryCheck, fieldProperties, J, false);
-
-    if (!propagatedParameters) {
+  for (size_t i = 0; i != multiComponentState.size(); ++i) {
+    if (!propagatedParameters[i]) {
       continue;
     }
-    sumw += component->weight;
+    sumw += multiComponentState[i].weight;
     // Propagation does not affect the weightings of the states
-    propagatedState.push_back({std::move(propagatedParameters),
-                                 component->weight});
+    propagatedState.push_back({std::move(propagatedParameters[i]),
+                                 multiComponentState[i].weight});
   }
   // Protect low weight propagation
   constexpr double minPropWeight = (1./12.);
@@ -1773,6 +2389,42 @@ Trk::RungeKuttaPropagator::propagateParameters(const ::EventContext& ctx,
   return Tpn;
 }
 
+/////////////////////////////////////////////////////////////////////////////////
+// Main function for the propagation of a set of track parameters and their
+// covariance matrices to one surface, the tracks being stepped together
+/////////////////////////////////////////////////////////////////////////////////
+std::vector<std::unique_ptr<Trk::TrackParameters>>
+Trk::RungeKuttaPropagator::propagate(const ::EventContext& ctx,
+                                     const std::vector<const TrackParameters*>& Tp,
+                                     const Trk::Surface& Su,
+                                     Trk::PropDirection D,
+                                     const Trk::BoundaryCheck& B,
+                                     const MagneticFieldProperties& M,
+                                     ParticleHypothesis,
+                                     bool returnCurv) const
+{
+  Cache cache = getInitializedCache(ctx);
+  return propagateRungeKuttaBatch(cache, true, Tp, Su, D, B, M, returnCurv);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+// Main function for the propagation of a set of track parameters without
+// covariance matrix to one surface, the tracks being stepped together
+/////////////////////////////////////////////////////////////////////////////////
+std::vector<std::unique_ptr<Trk::TrackParameters>>
+Trk::RungeKuttaPropagator::propagateParameters(const ::EventContext& ctx,
+                                               const std::vector<const TrackParameters*>& Tp,
+                                               const Trk::Surface& Su,
+                                               Trk::PropDirection D,
+                                               const Trk::BoundaryCheck& B,
+                                               const MagneticFieldProperties& M,
+                                               ParticleHypothesis,
+                                               bool returnCurv) const
+{
+  Cache cache = getInitializedCache(ctx);
+  return propagateRungeKuttaBatch(cache, false, Tp, Su, D, B, M, returnCurv);
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 // Global positions calculation inside CylinderBounds
 // where mS - max step allowed if mS > 0 propagate along    momentum